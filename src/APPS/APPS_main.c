@@ -8,6 +8,10 @@
 
 #include "APPS_main.h"
 #include "../COTS/MCAL/RCC/RCC_interface.h"
+#include "../COTS/MCAL/NVIC/NVIC_interface.h"
+#include "../COTS/MCAL/DWT/DWT_interface.h"
+#include "../COTS/OS/CRASH/CRASH_interface.h"
+#include "diag/Trace.h"
 
 /**
  * @brief This macro is used to define the main function of the application
@@ -17,15 +21,54 @@
 #define TESTING_APPLICATION_MAIN_FUNC(APP_NAME) vTestApp_##APP_NAME##_main()
 
 #define TestingGPIO
+// #define TestingEXTI
+// #define BenchmarkDualADC
+// #define TestingScheduler
+// #define TestingRTOS
+// #define BenchmarkRAMFUNC
+// #define TestingFLASH
 
 #if defined TestingGPIO
 #include "TestingGPIO/TestApp_TestingGPIO_main.h"
+#elif defined TestingEXTI
+#include "TestingEXTI/TestApp_TestingEXTI_main.h"
+#elif defined BenchmarkDualADC
+#include "BenchmarkDualADC/TestApp_BenchmarkDualADC_main.h"
+#elif defined TestingScheduler
+#include "TestingScheduler/TestApp_TestingScheduler_main.h"
+#elif defined TestingRTOS
+#include "TestingRTOS/TestApp_TestingRTOS_main.h"
+#elif defined BenchmarkRAMFUNC
+#include "BenchmarkRAMFUNC/TestApp_BenchmarkRAMFUNC_main.h"
+#elif defined TestingFLASH
+#include "TestingFLASH/TestApp_TestingFLASH_main.h"
 #endif
 
 void vAPPS_main(void)
 {
+	trace_printf("reset to main: %lu cycles\n", (unsigned long)DWT_u32GetStartupCycles());
+
+	/* Report the fault that ended the previous run, if any */
+	CRASH_vInit();
+
 	RCC_vInit();
+	NVIC_vInit();
+
+#if defined TestingGPIO
 	TESTING_APPLICATION_MAIN_FUNC(TestingGPIO);
+#elif defined TestingEXTI
+	TESTING_APPLICATION_MAIN_FUNC(TestingEXTI);
+#elif defined BenchmarkDualADC
+	TESTING_APPLICATION_MAIN_FUNC(BenchmarkDualADC);
+#elif defined TestingScheduler
+	TESTING_APPLICATION_MAIN_FUNC(TestingScheduler);
+#elif defined TestingRTOS
+	TESTING_APPLICATION_MAIN_FUNC(TestingRTOS);
+#elif defined BenchmarkRAMFUNC
+	TESTING_APPLICATION_MAIN_FUNC(BenchmarkRAMFUNC);
+#elif defined TestingFLASH
+	TESTING_APPLICATION_MAIN_FUNC(TestingFLASH);
+#endif
 
 	for (;;)
 	{
@@ -0,0 +1,126 @@
+/**
+ * @file TestApp_BenchmarkDualADC_main.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main implementation for the TestApp_BenchmarkDualADC application.
+ * @details This file contains the main implementation for the TestApp_BenchmarkDualADC application.
+ * @date 2026-10-19
+ */
+
+#include "TestApp_BenchmarkDualADC_main.h"
+#include "../../COTS/LIB/LSTD_TYPES.h"
+#include "../../COTS/LIB/LSTD_COMPILER.h"
+#include "../../COTS/LIB/LSTD_VALUES.h"
+#include "../../COTS/LIB/LSTD_CPU.h"
+#include "../../COTS/MCAL/RCC/RCC_interface.h"
+#include "../../COTS/MCAL/DWT/DWT_interface.h"
+#include "../../COTS/MCAL/ADC/ADC_interface.h"
+#include "diag/Trace.h"
+
+/**
+ * @brief The number of pairs of each half of the ping-pong buffer
+ */
+#define BENCHMARK_HALF_COUNT (64U)
+
+/**
+ * @brief The number of channels converted by each ADC
+ */
+#define BENCHMARK_SEQUENCE_LENGTH (2U)
+
+/**
+ * @brief The dual mode ping-pong buffer
+ */
+STATIC t_u32 au32BenchmarkBuffer[2U * BENCHMARK_HALF_COUNT];
+
+/**
+ * @brief The number of conversions (of both ADCs) since the last report
+ */
+STATIC VOLATILE t_u32 u32BenchmarkSamples = 0;
+
+/**
+ * @brief The last received pair, kept to check the packing
+ */
+STATIC VOLATILE t_u32 u32BenchmarkLastPair = 0;
+
+/**
+ * @brief This function gets every filled half of the ping-pong buffer
+ * @details Each pair holds two conversions
+ * @param[in] pu32Samples The filled half
+ * @param[in] u16Count The number of pairs
+ */
+STATIC void vTestApp_BenchmarkDualADC_Callback(P2CONST(t_u32) pu32Samples, t_u16 u16Count)
+{
+	u32BenchmarkSamples += 2U * (t_u32)u16Count;
+	u32BenchmarkLastPair = pu32Samples[u16Count - 1U];
+}
+
+void vTestApp_BenchmarkDualADC_main(void)
+{
+	CONST t_ADC_Channels atADC1Channels[BENCHMARK_SEQUENCE_LENGTH] = {ADC_Channels_0, ADC_Channels_2};
+	CONST t_ADC_Channels atADC2Channels[BENCHMARK_SEQUENCE_LENGTH] = {ADC_Channels_1, ADC_Channels_3};
+	t_u32 u32CyclesPerSecond = RCC_u32GetSystemClockFrequency();
+	t_u32 u32Start = 0;
+	t_u32 u32Elapsed = 0;
+	t_u32 u32Samples = 0;
+	t_u32 u32Pair = 0;
+	t_u32 u32Milliseconds = 0;
+	t_u8 u8Index = 0;
+
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTA);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_ADC1);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_ADC2);
+	RCC_vEnablePeripheralAHB(RCC_AHBPeripherals_DMA1);
+	DWT_vInit();
+
+	ADC_vInit(ADC_Peripherals_ADC1);
+	ADC_vInit(ADC_Peripherals_ADC2);
+
+	/* Shortest sample time: 1.5 + 12.5 cycles of the 9 MHz ADC clock per conversion */
+	for (u8Index = 0; u8Index < BENCHMARK_SEQUENCE_LENGTH; u8Index++)
+	{
+		ADC_vSetSampleTime(ADC_Peripherals_ADC1, atADC1Channels[u8Index], ADC_SampleTime_1_5Cycles);
+		ADC_vSetSampleTime(ADC_Peripherals_ADC2, atADC2Channels[u8Index], ADC_SampleTime_1_5Cycles);
+	}
+
+	ADC_vSetSequence(ADC_Peripherals_ADC1, atADC1Channels, BENCHMARK_SEQUENCE_LENGTH);
+	ADC_vSetSequence(ADC_Peripherals_ADC2, atADC2Channels, BENCHMARK_SEQUENCE_LENGTH);
+
+	if (ADC_bStartDualSampling(ADC_Trigger_Software, au32BenchmarkBuffer, BENCHMARK_HALF_COUNT, vTestApp_BenchmarkDualADC_Callback) == FALSE)
+	{
+		trace_puts("Dual ADC sampling could not be started");
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	u32Start = DWT_u32GetCycleCount();
+
+	for (;;)
+	{
+		/* Sleep until the next DMA half */
+		CPU_WFI();
+
+		u32Elapsed = DWT_u32GetCycleCount() - u32Start;
+
+		if (u32Elapsed >= u32CyclesPerSecond)
+		{
+			/* Take the counter and restart the window */
+			u32Start += u32Elapsed;
+			u32Samples = u32BenchmarkSamples;
+			u32BenchmarkSamples = 0U;
+			u32Pair = u32BenchmarkLastPair;
+
+			/* Scale to exactly one second in case the window overshot (split to stay within 32 bits) */
+			u32Milliseconds = u32Elapsed / (u32CyclesPerSecond / 1000U);
+			u32Samples = ((u32Samples / u32Milliseconds) * 1000U) + (((u32Samples % u32Milliseconds) * 1000U) / u32Milliseconds);
+
+			trace_printf("Dual ADC: %lu samples/s (ADC1 = %u, ADC2 = %u)\n", (unsigned long)u32Samples,
+						 (unsigned)ADC_DUAL_SAMPLE_ADC1(u32Pair), (unsigned)ADC_DUAL_SAMPLE_ADC2(u32Pair));
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+}
@@ -0,0 +1,33 @@
+/**
+ * @file TestApp_BenchmarkDualADC_main.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main header file for the TestApp_BenchmarkDualADC application.
+ * @details This file contains the main header file for the TestApp_BenchmarkDualADC application.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir BenchmarkDualADC
+ * @brief This directory contains the benchmark application for the ADC dual mode
+ * @details This directory contains the benchmark application for the ADC dual mode
+ */
+
+#ifndef _TestApp_BenchmarkDualADC_MAIN_H_
+#define _TestApp_BenchmarkDualADC_MAIN_H_
+
+/**
+ * @addtogroup testing_applications
+ * @{
+ */
+
+/**
+ * @brief This function is the main function for the TestApp_BenchmarkDualADC application
+ * @details This function samples PA0/PA2 on ADC1 and PA1/PA3 on ADC2 in regular simultaneous mode as fast as possible
+ * and reports the achieved samples per second over the trace channel once every second
+ */
+void vTestApp_BenchmarkDualADC_main(void);
+
+/** @} */
+
+#endif /* _TestApp_BenchmarkDualADC_MAIN_H_ */
@@ -0,0 +1,148 @@
+/**
+ * @file TestApp_BenchmarkRAMFUNC_main.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main implementation for the TestApp_BenchmarkRAMFUNC application.
+ * @details This file contains the main implementation for the TestApp_BenchmarkRAMFUNC application.
+ * @date 2026-10-19
+ */
+
+#include "TestApp_BenchmarkRAMFUNC_main.h"
+#include "../../COTS/LIB/LSTD_TYPES.h"
+#include "../../COTS/LIB/LSTD_COMPILER.h"
+#include "../../COTS/LIB/LSTD_VALUES.h"
+#include "../../COTS/MCAL/RCC/RCC_interface.h"
+#include "../../COTS/MCAL/GPIO/GPIO_interface.h"
+#include "../../COTS/MCAL/EXTI/EXTI_interface.h"
+#include "../../COTS/MCAL/DWT/DWT_interface.h"
+#include "diag/Trace.h"
+
+/**
+ * @brief The word sent by the bit-banged loops
+ */
+#define BENCHMARK_WORD (0xA5C3F00FU)
+
+/**
+ * @brief The number of the bits of the word
+ */
+#define BENCHMARK_BITS (32U)
+
+/**
+ * @brief The BSRR bit that sets PA0 (clock), the reset bit is 16 bits above
+ */
+#define BENCHMARK_CLOCK_BIT ((t_u32)1U << GPIO_Pins_0)
+
+/**
+ * @brief The BSRR bit that sets PA1 (data), the reset bit is 16 bits above
+ */
+#define BENCHMARK_DATA_BIT ((t_u32)1U << GPIO_Pins_1)
+
+/**
+ * @brief The cycle count taken right before the software EXTI request
+ */
+STATIC VOLATILE t_u32 u32BenchmarkTriggerCycles = 0;
+
+/**
+ * @brief The cycles from the software EXTI request to its callback
+ */
+STATIC VOLATILE t_u32 u32BenchmarkDispatchCycles = 0;
+
+/**
+ * @brief This function bit-bangs a word from the flash
+ * @param[in] pu32BSRR The BSRR register of the port
+ * @param[in] u32Word The word, sent MSB first
+ */
+STATIC void vTestApp_BenchmarkRAMFUNC_SendFromFlash(P2VAR(VOLATILE t_u32) pu32BSRR, t_u32 u32Word)
+{
+	t_u8 u8Bit = 0;
+
+	for (u8Bit = 0; u8Bit < BENCHMARK_BITS; u8Bit++)
+	{
+		*pu32BSRR = ((u32Word & 0x80000000U) != 0U) ? BENCHMARK_DATA_BIT : (BENCHMARK_DATA_BIT << 16U);
+		*pu32BSRR = BENCHMARK_CLOCK_BIT;
+		*pu32BSRR = BENCHMARK_CLOCK_BIT << 16U;
+		u32Word <<= 1U;
+	}
+}
+
+/**
+ * @brief This function bit-bangs a word from the SRAM, it is the same loop as vTestApp_BenchmarkRAMFUNC_SendFromFlash()
+ * @param[in] pu32BSRR The BSRR register of the port
+ * @param[in] u32Word The word, sent MSB first
+ */
+STATIC RAMFUNC void vTestApp_BenchmarkRAMFUNC_SendFromRAM(P2VAR(VOLATILE t_u32) pu32BSRR, t_u32 u32Word)
+{
+	t_u8 u8Bit = 0;
+
+	for (u8Bit = 0; u8Bit < BENCHMARK_BITS; u8Bit++)
+	{
+		*pu32BSRR = ((u32Word & 0x80000000U) != 0U) ? BENCHMARK_DATA_BIT : (BENCHMARK_DATA_BIT << 16U);
+		*pu32BSRR = BENCHMARK_CLOCK_BIT;
+		*pu32BSRR = BENCHMARK_CLOCK_BIT << 16U;
+		u32Word <<= 1U;
+	}
+}
+
+/**
+ * @brief This function takes the cycle count of the software EXTI request
+ */
+STATIC void vTestApp_BenchmarkRAMFUNC_EdgeCallback(void)
+{
+	u32BenchmarkDispatchCycles = DWT_u32GetCycleCount() - u32BenchmarkTriggerCycles;
+}
+
+void vTestApp_BenchmarkRAMFUNC_main(void)
+{
+	t_u32 u32BSRRAddress = GPIO_u32GetBSRRAddress(GPIO_Ports_A);
+	P2VAR(VOLATILE t_u32) pu32BSRR = (P2VAR(VOLATILE t_u32))u32BSRRAddress;
+	t_u32 u32CyclesPerSecond = RCC_u32GetSystemClockFrequency();
+	t_u32 u32Start = 0;
+	t_u32 u32FlashCycles = 0;
+	t_u32 u32RAMCycles = 0;
+	t_u32 u32SetPinCycles = 0;
+	t_u32 u32LastReport = 0;
+
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_AFIO);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTA);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTB);
+	GPIO_vSetPinDirection(GPIO_Ports_A, GPIO_Pins_0, GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinDirection(GPIO_Ports_A, GPIO_Pins_1, GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinDirection(GPIO_Ports_B, GPIO_Pins_5, GPIO_Direction_Input);
+	GPIO_vSetPinInputType(GPIO_Ports_B, GPIO_Pins_5, GPIO_Input_Type_Pull_Up);
+	DWT_vInit();
+
+	/* PB5 stays idle, its line is only requested by software to time the shared lines 5 to 9 dispatcher */
+	EXTI_vEnablePinInterrupt(GPIO_Ports_B, GPIO_Pins_5, EXTI_Triggers_Rising, vTestApp_BenchmarkRAMFUNC_EdgeCallback);
+
+	u32LastReport = DWT_u32GetCycleCount();
+
+	for (;;)
+	{
+		u32Start = DWT_u32GetCycleCount();
+		vTestApp_BenchmarkRAMFUNC_SendFromFlash(pu32BSRR, BENCHMARK_WORD);
+		u32FlashCycles = DWT_u32GetCycleCount() - u32Start;
+
+		u32Start = DWT_u32GetCycleCount();
+		vTestApp_BenchmarkRAMFUNC_SendFromRAM(pu32BSRR, BENCHMARK_WORD);
+		u32RAMCycles = DWT_u32GetCycleCount() - u32Start;
+
+		u32Start = DWT_u32GetCycleCount();
+		GPIO_vSetPinValue(GPIO_Ports_A, GPIO_Pins_1, GPIO_Value_High);
+		u32SetPinCycles = DWT_u32GetCycleCount() - u32Start;
+
+		u32BenchmarkTriggerCycles = DWT_u32GetCycleCount();
+		EXTI_vGenerateSoftwareInterrupt(GPIO_Pins_5);
+
+		if ((DWT_u32GetCycleCount() - u32LastReport) >= u32CyclesPerSecond)
+		{
+			u32LastReport = DWT_u32GetCycleCount();
+			trace_printf("32 bits: flash %lu cycles, ram %lu cycles; set pin %lu cycles; EXTI request to callback %lu cycles\n",
+						 (unsigned long)u32FlashCycles, (unsigned long)u32RAMCycles, (unsigned long)u32SetPinCycles,
+						 (unsigned long)u32BenchmarkDispatchCycles);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+}
@@ -0,0 +1,34 @@
+/**
+ * @file TestApp_BenchmarkRAMFUNC_main.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main header file for the TestApp_BenchmarkRAMFUNC application.
+ * @details This file contains the main header file for the TestApp_BenchmarkRAMFUNC application.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir BenchmarkRAMFUNC
+ * @brief This directory contains the benchmark application for the RAM-resident code
+ * @details This directory contains the benchmark application for the RAM-resident code
+ */
+
+#ifndef _TestApp_BenchmarkRAMFUNC_MAIN_H_
+#define _TestApp_BenchmarkRAMFUNC_MAIN_H_
+
+/**
+ * @addtogroup testing_applications
+ * @{
+ */
+
+/**
+ * @brief This function is the main function for the TestApp_BenchmarkRAMFUNC application
+ * @details This function bit-bangs the same 32-bit word on PA0 (clock) and PA1 (data) from a flash copy and from a SRAM copy
+ * of the same loop, times GPIO_vSetPinValue() and the EXTI dispatcher (both RAM-resident), and reports the cycles over the
+ * trace channel once every second
+ */
+void vTestApp_BenchmarkRAMFUNC_main(void);
+
+/** @} */
+
+#endif /* _TestApp_BenchmarkRAMFUNC_MAIN_H_ */
@@ -0,0 +1,45 @@
+/**
+ * @file TestApp_TestingEXTI_main.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main implementation for the TestApp_TestingEXTI application.
+ * @details This file contains the main implementation for the TestApp_TestingEXTI application.
+ * @date 2026-10-19
+ */
+
+#include "TestApp_TestingEXTI_main.h"
+#include "../../COTS/LIB/LSTD_TYPES.h"
+#include "../../COTS/LIB/LSTD_COMPILER.h"
+#include "../../COTS/LIB/LSTD_CPU.h"
+#include "../../COTS/MCAL/RCC/RCC_interface.h"
+#include "../../COTS/MCAL/GPIO/GPIO_interface.h"
+#include "../../COTS/MCAL/EXTI/EXTI_interface.h"
+
+/**
+ * @brief This function is called on every edge of PB7
+ * @details This function mirrors the value of PB7 onto PA1
+ */
+STATIC void vTestApp_TestingEXTI_PB7Callback(void)
+{
+	GPIO_vSetPinValue(GPIO_Ports_A, GPIO_Pins_1, GPIO_tGetPinValue(GPIO_Ports_B, GPIO_Pins_7));
+}
+
+void vTestApp_TestingEXTI_main(void)
+{
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_AFIO);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTA);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTB);
+	GPIO_vSetPinDirection(GPIO_Ports_A, GPIO_Pins_1, GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinDirection(GPIO_Ports_B, GPIO_Pins_7, GPIO_Direction_Input);
+	GPIO_vSetPinInputType(GPIO_Ports_B, GPIO_Pins_7, GPIO_Input_Type_Pull_Up);
+
+	/* Sync the output with the current input value before waiting for the edges */
+	vTestApp_TestingEXTI_PB7Callback();
+	EXTI_vEnablePinInterrupt(GPIO_Ports_B, GPIO_Pins_7, EXTI_Triggers_Both, vTestApp_TestingEXTI_PB7Callback);
+
+	for (;;)
+	{
+		/* Sleep until the next edge */
+		CPU_WFI();
+	}
+}
@@ -0,0 +1,32 @@
+/**
+ * @file TestApp_TestingEXTI_main.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main header file for the TestApp_TestingEXTI application.
+ * @details This file contains the main header file for the TestApp_TestingEXTI application.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir TestingEXTI
+ * @brief This directory contains the testing application for the EXTI driver
+ * @details This directory contains the testing application for the EXTI driver
+ */
+
+#ifndef _TestApp_TestingEXTI_MAIN_H_
+#define _TestApp_TestingEXTI_MAIN_H_
+
+/**
+ * @addtogroup testing_applications
+ * @{
+ */
+
+/**
+ * @brief This function is the main function for the TestApp_TestingEXTI application
+ * @details This function mirrors PB7 onto PA1 from the EXTI callback and sleeps between the edges
+ */
+void vTestApp_TestingEXTI_main(void);
+
+/** @} */
+
+#endif /* _TestApp_TestingEXTI_MAIN_H_ */
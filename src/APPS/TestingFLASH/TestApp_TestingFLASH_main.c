@@ -0,0 +1,84 @@
+/**
+ * @file TestApp_TestingFLASH_main.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main implementation for the TestApp_TestingFLASH application.
+ * @details This file contains the main implementation for the TestApp_TestingFLASH application.
+ * @date 2026-10-19
+ */
+
+#include "TestApp_TestingFLASH_main.h"
+#include "../../COTS/LIB/LSTD_TYPES.h"
+#include "../../COTS/LIB/LSTD_COMPILER.h"
+#include "../../COTS/LIB/LSTD_VALUES.h"
+#include "../../COTS/MCAL/CRC/CRC_interface.h"
+#include "../../COTS/MCAL/FLASH/FLASH_interface.h"
+#include "../../COTS/MCAL/DWT/DWT_interface.h"
+#include "diag/Trace.h"
+
+/**
+ * @brief The address of the last page of the 64 KiB flash, far from the application code
+ */
+#define TESTING_FLASH_PAGE_ADDRESS ((t_u32)0x0800FC00U)
+
+/**
+ * @brief The number of the half-words of a page
+ */
+#define TESTING_FLASH_HALF_WORDS (FLASH_PAGE_SIZE / 2U)
+
+/**
+ * @brief The pattern programmed in the page
+ */
+STATIC t_u16 au16TestingFLASHData[TESTING_FLASH_HALF_WORDS] = {0};
+
+void vTestApp_TestingFLASH_main(void)
+{
+	t_u32 u32Index = 0;
+	t_u32 u32Start = 0;
+	t_u32 u32EraseCycles = 0;
+	t_u32 u32ProgramCycles = 0;
+	t_u32 u32SkipCycles = 0;
+	t_u32 u32VerifyCycles = 0;
+	t_FLASH_Status tErase = FLASH_Status_OK;
+	t_FLASH_Status tProgram = FLASH_Status_OK;
+	t_FLASH_Status tSkip = FLASH_Status_OK;
+	t_FLASH_Status tVerify = FLASH_Status_OK;
+
+	for (u32Index = 0; u32Index < TESTING_FLASH_HALF_WORDS; u32Index++)
+	{
+		au16TestingFLASHData[u32Index] = (t_u16)((u32Index * 0x9E37U) ^ 0x5A5AU);
+	}
+
+	CRC_vInit();
+	DWT_vInit();
+	FLASH_vUnlock();
+
+	u32Start = DWT_u32GetCycleCount();
+	tErase = FLASH_tErasePage(TESTING_FLASH_PAGE_ADDRESS);
+	u32EraseCycles = DWT_u32GetCycleCount() - u32Start;
+
+	u32Start = DWT_u32GetCycleCount();
+	tProgram = FLASH_tProgram(TESTING_FLASH_PAGE_ADDRESS, au16TestingFLASHData, TESTING_FLASH_HALF_WORDS);
+	u32ProgramCycles = DWT_u32GetCycleCount() - u32Start;
+
+	u32Start = DWT_u32GetCycleCount();
+	tSkip = FLASH_tProgram(TESTING_FLASH_PAGE_ADDRESS, au16TestingFLASHData, TESTING_FLASH_HALF_WORDS);
+	u32SkipCycles = DWT_u32GetCycleCount() - u32Start;
+
+	FLASH_vLock();
+
+	u32Start = DWT_u32GetCycleCount();
+	tVerify = FLASH_tVerify(TESTING_FLASH_PAGE_ADDRESS, au16TestingFLASHData, TESTING_FLASH_HALF_WORDS);
+	u32VerifyCycles = DWT_u32GetCycleCount() - u32Start;
+
+	trace_printf("erase: status %d, %lu cycles\n", (int)tErase, (unsigned long)u32EraseCycles);
+	trace_printf("program %lu half-words: status %d, %lu cycles\n", (unsigned long)TESTING_FLASH_HALF_WORDS, (int)tProgram,
+				 (unsigned long)u32ProgramCycles);
+	trace_printf("program again: status %d, %lu cycles\n", (int)tSkip, (unsigned long)u32SkipCycles);
+	trace_printf("verify: status %d, %lu cycles\n", (int)tVerify, (unsigned long)u32VerifyCycles);
+
+	for (;;)
+	{
+		/* Do nothing */
+	}
+}
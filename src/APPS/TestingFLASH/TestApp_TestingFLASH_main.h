@@ -0,0 +1,34 @@
+/**
+ * @file TestApp_TestingFLASH_main.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main header file for the TestApp_TestingFLASH application.
+ * @details This file contains the main header file for the TestApp_TestingFLASH application.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir TestingFLASH
+ * @brief This directory contains the testing application for the FLASH driver
+ * @details This directory contains the testing application for the FLASH driver
+ */
+
+#ifndef _TestApp_TestingFLASH_MAIN_H_
+#define _TestApp_TestingFLASH_MAIN_H_
+
+/**
+ * @addtogroup testing_applications
+ * @{
+ */
+
+/**
+ * @brief This function is the main function for the TestApp_TestingFLASH application
+ * @details This function erases the last page of the flash, programs it with a pattern, programs the same pattern again
+ * (every half-word is skipped), verifies it with the CRC unit and reports the status and the cycles of each step over the
+ * trace channel. It runs once per reset to spare the flash endurance
+ */
+void vTestApp_TestingFLASH_main(void);
+
+/** @} */
+
+#endif /* _TestApp_TestingFLASH_MAIN_H_ */
@@ -0,0 +1,224 @@
+/**
+ * @file TestApp_TestingRTOS_main.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main implementation for the TestApp_TestingRTOS application.
+ * @details This file contains the main implementation for the TestApp_TestingRTOS application.
+ * @date 2026-10-19
+ */
+
+#include "TestApp_TestingRTOS_main.h"
+#include "../../COTS/LIB/LSTD_TYPES.h"
+#include "../../COTS/LIB/LSTD_COMPILER.h"
+#include "../../COTS/LIB/LSTD_VALUES.h"
+#include "../../COTS/MCAL/RCC/RCC_interface.h"
+#include "../../COTS/MCAL/NVIC/NVIC_interface.h"
+#include "../../COTS/MCAL/GPIO/GPIO_interface.h"
+#include "../../COTS/MCAL/EXTI/EXTI_interface.h"
+#include "../../COTS/MCAL/DWT/DWT_interface.h"
+#include "../../COTS/OS/RTOS/RTOS_interface.h"
+#include "../../COTS/OS/RTOS/RTOS_config.h"
+#include "../../COTS/OS/STACK/STACK_interface.h"
+#include "diag/Trace.h"
+
+/**
+ * @brief The number of the round trips of each ping-pong measure
+ */
+#define RTOS_APP_ROUND_TRIPS (1000U)
+
+/**
+ * @brief The size of the stacks of the tasks in words
+ */
+#define RTOS_APP_STACK_WORDS (128U)
+
+/**
+ * @struct t_RTOSAppReport
+ * @brief A measure sent to the report task
+ */
+typedef struct
+{
+	/**
+	 * @brief The cycles of one switch with its semaphore operations
+	 */
+	t_u32 u32SwitchCycles;
+	/**
+	 * @brief The cycles from the last PB7 edge interrupt to the mirror task
+	 */
+	t_u32 u32WakeUpCycles;
+} t_RTOSAppReport;
+
+RTOS_STACK_DEFINE(au32MirrorStack, RTOS_APP_STACK_WORDS);
+RTOS_STACK_DEFINE(au32PongStack, RTOS_APP_STACK_WORDS);
+RTOS_STACK_DEFINE(au32PingStack, RTOS_APP_STACK_WORDS);
+RTOS_STACK_DEFINE(au32ReportStack, RTOS_APP_STACK_WORDS);
+RTOS_STACK_DEFINE(au32BlinkStack, RTOS_APP_STACK_WORDS);
+
+/**
+ * @brief The PB7 edges signaled to the mirror task
+ */
+STATIC t_RTOS_Semaphore tEdgeSemaphore = RTOS_SEMAPHORE_INIT(0U, 1U);
+
+/**
+ * @brief The answers to the ping task
+ */
+STATIC t_RTOS_Semaphore tPingSemaphore = RTOS_SEMAPHORE_INIT(0U, 1U);
+
+/**
+ * @brief The requests to the pong task
+ */
+STATIC t_RTOS_Semaphore tPongSemaphore = RTOS_SEMAPHORE_INIT(0U, 1U);
+
+/**
+ * @brief The measures sent to the report task
+ */
+RTOS_QUEUE_DEFINE(tReportQueue, t_RTOSAppReport, 4U);
+
+/**
+ * @brief The cycle count of the last PB7 edge interrupt
+ */
+STATIC VOLATILE t_u32 u32EdgeCycles = 0;
+
+/**
+ * @brief The cycles from the last PB7 edge interrupt to the mirror task
+ */
+STATIC VOLATILE t_u32 u32WakeUpCycles = 0;
+
+/**
+ * @brief This function is called on every edge of PB7, it wakes the mirror task up
+ */
+STATIC void vTestApp_TestingRTOS_EdgeCallback(void)
+{
+	u32EdgeCycles = DWT_u32GetCycleCount();
+	RTOS_vGiveSemaphore(&tEdgeSemaphore);
+}
+
+/**
+ * @brief This function mirrors PB7 onto PA1 on every edge, it is the task of the highest priority
+ * @param[in] pvArgument Not used
+ */
+STATIC void vTestApp_TestingRTOS_Mirror(P2VAR(void) pvArgument)
+{
+	(void)pvArgument;
+
+	for (;;)
+	{
+		(void)RTOS_bTakeSemaphore(&tEdgeSemaphore, RTOS_WAIT_FOREVER);
+		GPIO_vSetPinValue(GPIO_Ports_A, GPIO_Pins_1, GPIO_tGetPinValue(GPIO_Ports_B, GPIO_Pins_7));
+		u32WakeUpCycles = DWT_u32GetCycleCount() - u32EdgeCycles;
+	}
+}
+
+/**
+ * @brief This function answers every ping
+ * @param[in] pvArgument Not used
+ */
+STATIC void vTestApp_TestingRTOS_Pong(P2VAR(void) pvArgument)
+{
+	(void)pvArgument;
+
+	for (;;)
+	{
+		(void)RTOS_bTakeSemaphore(&tPongSemaphore, RTOS_WAIT_FOREVER);
+		RTOS_vGiveSemaphore(&tPingSemaphore);
+	}
+}
+
+/**
+ * @brief This function measures the ping-pong round trips once every second
+ * @details Each round trip switches to the pong task and back, so it costs two switches and two pairs of semaphore operations
+ * @param[in] pvArgument Not used
+ */
+STATIC void vTestApp_TestingRTOS_Ping(P2VAR(void) pvArgument)
+{
+	t_RTOSAppReport tReport;
+	t_u32 u32Start = 0;
+	t_u32 u32Trip = 0;
+
+	(void)pvArgument;
+
+	for (;;)
+	{
+		u32Start = DWT_u32GetCycleCount();
+
+		for (u32Trip = 0; u32Trip < RTOS_APP_ROUND_TRIPS; u32Trip++)
+		{
+			RTOS_vGiveSemaphore(&tPongSemaphore);
+			(void)RTOS_bTakeSemaphore(&tPingSemaphore, RTOS_WAIT_FOREVER);
+		}
+
+		tReport.u32SwitchCycles = (DWT_u32GetCycleCount() - u32Start) / (2U * RTOS_APP_ROUND_TRIPS);
+		tReport.u32WakeUpCycles = u32WakeUpCycles;
+		(void)RTOS_bSendQueue(&tReportQueue, &tReport, 0U);
+		RTOS_vDelay(RTOS_TICK_FREQUENCY);
+	}
+}
+
+/**
+ * @brief This function prints the measures and the high-water marks of the stacks
+ * @param[in] pvArgument Not used
+ */
+STATIC void vTestApp_TestingRTOS_Report(P2VAR(void) pvArgument)
+{
+	t_RTOSAppReport tReport;
+
+	(void)pvArgument;
+
+	for (;;)
+	{
+		(void)RTOS_bReceiveQueue(&tReportQueue, &tReport, RTOS_WAIT_FOREVER);
+		trace_printf("switch %lu cycles, edge to task %lu cycles, tick %lu\n", (unsigned long)tReport.u32SwitchCycles,
+					 (unsigned long)tReport.u32WakeUpCycles, (unsigned long)RTOS_u32GetTicks());
+		STACK_vReport();
+	}
+}
+
+/**
+ * @brief This function toggles PC13 every 500 ms
+ * @param[in] pvArgument Not used
+ */
+STATIC void vTestApp_TestingRTOS_Blink(P2VAR(void) pvArgument)
+{
+	t_GPIO_Value tLED = GPIO_Value_Low;
+	t_u32 u32LastWake = RTOS_u32GetTicks();
+
+	(void)pvArgument;
+
+	for (;;)
+	{
+		tLED = (tLED == GPIO_Value_Low) ? GPIO_Value_High : GPIO_Value_Low;
+		GPIO_vSetPinValue(GPIO_Ports_C, GPIO_Pins_13, tLED);
+		RTOS_vDelayUntil(&u32LastWake, RTOS_TICK_FREQUENCY / 2U);
+	}
+}
+
+void vTestApp_TestingRTOS_main(void)
+{
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_AFIO);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTA);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTB);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTC);
+	GPIO_vSetPinDirection(GPIO_Ports_A, GPIO_Pins_1, GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinDirection(GPIO_Ports_C, GPIO_Pins_13, GPIO_Direction_Output_2MHz);
+	GPIO_vSetPinDirection(GPIO_Ports_B, GPIO_Pins_7, GPIO_Direction_Input);
+	GPIO_vSetPinInputType(GPIO_Ports_B, GPIO_Pins_7, GPIO_Input_Type_Pull_Up);
+	DWT_vInit();
+
+	RTOS_vInit();
+	(void)RTOS_bCreateTask(0U, vTestApp_TestingRTOS_Mirror, NULL, au32MirrorStack, RTOS_APP_STACK_WORDS);
+	(void)RTOS_bCreateTask(1U, vTestApp_TestingRTOS_Pong, NULL, au32PongStack, RTOS_APP_STACK_WORDS);
+	(void)RTOS_bCreateTask(2U, vTestApp_TestingRTOS_Ping, NULL, au32PingStack, RTOS_APP_STACK_WORDS);
+	(void)RTOS_bCreateTask(3U, vTestApp_TestingRTOS_Report, NULL, au32ReportStack, RTOS_APP_STACK_WORDS);
+	(void)RTOS_bCreateTask(4U, vTestApp_TestingRTOS_Blink, NULL, au32BlinkStack, RTOS_APP_STACK_WORDS);
+	(void)STACK_bRegister("mirror", au32MirrorStack, RTOS_APP_STACK_WORDS);
+	(void)STACK_bRegister("pong", au32PongStack, RTOS_APP_STACK_WORDS);
+	(void)STACK_bRegister("ping", au32PingStack, RTOS_APP_STACK_WORDS);
+	(void)STACK_bRegister("report", au32ReportStack, RTOS_APP_STACK_WORDS);
+	(void)STACK_bRegister("blink", au32BlinkStack, RTOS_APP_STACK_WORDS);
+
+	/* The edge interrupt calls the kernel, so it must not be above the kernel priority */
+	EXTI_vEnablePinInterrupt(GPIO_Ports_B, GPIO_Pins_7, EXTI_Triggers_Both, vTestApp_TestingRTOS_EdgeCallback);
+	NVIC_vSetPriority(NVIC_IRQs_EXTI9_5, RTOS_KERNEL_PRIORITY);
+
+	RTOS_vStart();
+	trace_puts("The kernel tick could not be started");
+}
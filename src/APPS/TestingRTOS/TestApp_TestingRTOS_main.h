@@ -0,0 +1,34 @@
+/**
+ * @file TestApp_TestingRTOS_main.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main header file for the TestApp_TestingRTOS application.
+ * @details This file contains the main header file for the TestApp_TestingRTOS application.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir TestingRTOS
+ * @brief This directory contains the testing application for the preemptive kernel
+ * @details This directory contains the testing application for the preemptive kernel
+ */
+
+#ifndef _TestApp_TestingRTOS_MAIN_H_
+#define _TestApp_TestingRTOS_MAIN_H_
+
+/**
+ * @addtogroup testing_applications
+ * @{
+ */
+
+/**
+ * @brief This function is the main function for the TestApp_TestingRTOS application
+ * @details This function runs a high priority task woken up by the PB7 edges that mirrors PB7 onto PA1,
+ * a ping-pong between two tasks that measures the context switch, a 500 ms PC13 blinker and a report task
+ * that prints the measures over the trace channel
+ */
+void vTestApp_TestingRTOS_main(void);
+
+/** @} */
+
+#endif /* _TestApp_TestingRTOS_MAIN_H_ */
@@ -0,0 +1,141 @@
+/**
+ * @file TestApp_TestingScheduler_main.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main implementation for the TestApp_TestingScheduler application.
+ * @details This file contains the main implementation for the TestApp_TestingScheduler application.
+ * @date 2026-10-19
+ */
+
+#include "TestApp_TestingScheduler_main.h"
+#include "../../COTS/LIB/LSTD_TYPES.h"
+#include "../../COTS/LIB/LSTD_COMPILER.h"
+#include "../../COTS/LIB/LSTD_VALUES.h"
+#include "../../COTS/MCAL/RCC/RCC_interface.h"
+#include "../../COTS/MCAL/GPIO/GPIO_interface.h"
+#include "../../COTS/MCAL/DWT/DWT_interface.h"
+#include "../../COTS/OS/SCHED/SCHED_interface.h"
+#include "../../COTS/OS/SCHED/SCHED_config.h"
+#include "diag/Trace.h"
+
+/**
+ * @brief The number of the tasks of the application
+ */
+#define SCHEDULER_TASKS_COUNT (4U)
+
+/**
+ * @brief The busy time of the load task in ticks, every fourth run is six times longer and misses its deadline
+ */
+#define SCHEDULER_LOAD_TICKS (1U)
+
+STATIC void vTestApp_TestingScheduler_Mirror(void);
+STATIC void vTestApp_TestingScheduler_Blink(void);
+STATIC void vTestApp_TestingScheduler_Load(void);
+STATIC void vTestApp_TestingScheduler_Report(void);
+
+/**
+ * @brief The task table of the application
+ */
+STATIC CONST t_SCHED_Task atSchedulerTasks[SCHEDULER_TASKS_COUNT] = {
+	{vTestApp_TestingScheduler_Mirror, 10U, 0U, 0U, 0U, {0U}},
+	{vTestApp_TestingScheduler_Blink, 500U, 0U, 0U, 1U, {0U}},
+	{vTestApp_TestingScheduler_Load, 20U, 5U, 5U, 2U, {0U}},
+	{vTestApp_TestingScheduler_Report, 1000U, 1000U, 0U, 3U, {0U}}};
+
+/**
+ * @brief The names of the tasks in the report
+ */
+STATIC CONST char *CONST apcSchedulerTaskNames[SCHEDULER_TASKS_COUNT] = {"mirror", "blink", "load", "report"};
+
+/**
+ * @brief This function mirrors PB7 onto PA1
+ */
+STATIC void vTestApp_TestingScheduler_Mirror(void)
+{
+	GPIO_vSetPinValue(GPIO_Ports_A, GPIO_Pins_1, GPIO_tGetPinValue(GPIO_Ports_B, GPIO_Pins_7));
+}
+
+/**
+ * @brief This function toggles PC13
+ */
+STATIC void vTestApp_TestingScheduler_Blink(void)
+{
+	STATIC t_GPIO_Value tLED = GPIO_Value_Low;
+
+	tLED = (tLED == GPIO_Value_Low) ? GPIO_Value_High : GPIO_Value_Low;
+	GPIO_vSetPinValue(GPIO_Ports_C, GPIO_Pins_13, tLED);
+}
+
+/**
+ * @brief This function keeps the CPU busy to show up in the statistics
+ */
+STATIC void vTestApp_TestingScheduler_Load(void)
+{
+	STATIC t_u8 u8Run = 0;
+	t_u32 u32Cycles = (RCC_u32GetSystemClockFrequency() / SCHED_TICK_FREQUENCY) * SCHEDULER_LOAD_TICKS;
+	t_u32 u32Start = DWT_u32GetCycleCount();
+
+	u8Run++;
+
+	if ((u8Run & 3U) == 0U)
+	{
+		u32Cycles *= 6U;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	while ((DWT_u32GetCycleCount() - u32Start) < u32Cycles)
+		;
+}
+
+/**
+ * @brief This function reports the statistics of all the tasks then resets them
+ * @details The load is given in per mille of the core cycles, computed in 32 bits
+ */
+STATIC void vTestApp_TestingScheduler_Report(void)
+{
+	t_SCHED_TaskStats tStats;
+	t_u32 u32CyclesPerMille = ((RCC_u32GetSystemClockFrequency() / SCHED_TICK_FREQUENCY) * SCHED_u32GetStatsTicks()) / 1000U;
+	t_u8 u8Task = 0;
+
+	for (u8Task = 0; u8Task < SCHEDULER_TASKS_COUNT; u8Task++)
+	{
+		if ((SCHED_bGetTaskStats(u8Task, &tStats) == TRUE) && (u32CyclesPerMille != 0U))
+		{
+			trace_printf("%-6s runs %4lu misses %3lu max %7lu cycles load %3lu.%lu%%\n", apcSchedulerTaskNames[u8Task],
+						 (unsigned long)tStats.u32Runs, (unsigned long)tStats.u32DeadlineMisses, (unsigned long)tStats.u32MaxCycles,
+						 (unsigned long)((tStats.u32TotalCycles / u32CyclesPerMille) / 10U), (unsigned long)((tStats.u32TotalCycles / u32CyclesPerMille) % 10U));
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	SCHED_vResetStats();
+}
+
+void vTestApp_TestingScheduler_main(void)
+{
+	t_u8 u8Task = 0;
+
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTA);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTB);
+	RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_PORTC);
+	GPIO_vSetPinDirection(GPIO_Ports_A, GPIO_Pins_1, GPIO_Direction_Output_2MHz);
+	GPIO_vSetPinDirection(GPIO_Ports_C, GPIO_Pins_13, GPIO_Direction_Output_2MHz);
+	GPIO_vSetPinDirection(GPIO_Ports_B, GPIO_Pins_7, GPIO_Direction_Input);
+	GPIO_vSetPinInputType(GPIO_Ports_B, GPIO_Pins_7, GPIO_Input_Type_Pull_Up);
+
+	SCHED_vInit();
+
+	for (u8Task = 0; u8Task < SCHEDULER_TASKS_COUNT; u8Task++)
+	{
+		(void)SCHED_bAddTask(&atSchedulerTasks[u8Task], NULL);
+	}
+
+	SCHED_vStart();
+	trace_puts("The scheduler tick could not be started");
+}
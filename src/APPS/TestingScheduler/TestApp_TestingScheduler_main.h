@@ -0,0 +1,33 @@
+/**
+ * @file TestApp_TestingScheduler_main.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the main header file for the TestApp_TestingScheduler application.
+ * @details This file contains the main header file for the TestApp_TestingScheduler application.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir TestingScheduler
+ * @brief This directory contains the testing application for the cooperative scheduler
+ * @details This directory contains the testing application for the cooperative scheduler
+ */
+
+#ifndef _TestApp_TestingScheduler_MAIN_H_
+#define _TestApp_TestingScheduler_MAIN_H_
+
+/**
+ * @addtogroup testing_applications
+ * @{
+ */
+
+/**
+ * @brief This function is the main function for the TestApp_TestingScheduler application
+ * @details This function shares the CPU between four tasks: a 10 ms PB7 to PA1 mirror, a 500 ms PC13 blinker,
+ * a 20 ms busy task that overruns its 5 ms deadline every fourth run and a 1 s report of the statistics over the trace channel
+ */
+void vTestApp_TestingScheduler_main(void);
+
+/** @} */
+
+#endif /* _TestApp_TestingScheduler_MAIN_H_ */
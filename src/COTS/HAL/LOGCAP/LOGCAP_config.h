@@ -0,0 +1,43 @@
+/**
+ * @file LOGCAP_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the LOGCAP module.
+ * @details This file contains the configuration parameters for the LOGCAP module.
+ * @date 2026-10-19
+ */
+
+#ifndef _LOGCAP_CONFIG_H_
+#define _LOGCAP_CONFIG_H_
+
+#include "LOGCAP_interface.h"
+
+/**
+ * @addtogroup hal
+ * @{
+ */
+
+/**
+ * @addtogroup logcap_module
+ * @{
+ */
+
+/**
+ * @defgroup logcap_config LOGCAP Configuration
+ * @brief This group contains the configuration parameters of the LOGCAP module
+ * @{
+ */
+
+/**
+ * @def LOGCAP_DMA_IRQ_PRIORITY
+ * @brief This macro defines the NVIC priority of the capture DMA interrupts
+ * @details This macro defines the NVIC priority of the capture DMA interrupts (0 to 15), they run once every
+ * half buffer to count the samples and stop the capture after the post-trigger samples
+ */
+#define LOGCAP_DMA_IRQ_PRIORITY (1)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _LOGCAP_CONFIG_H_ */
@@ -0,0 +1,189 @@
+/**
+ * @file LOGCAP_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the LOGCAP module.
+ * @details This file contains the prototypes of the functions of the LOGCAP module.
+ * @date 2026-10-19
+ */
+
+#ifndef _LOGCAP_INTERFACE_H_
+#define _LOGCAP_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../MCAL/GPIO/GPIO_interface.h"
+#include "../../MCAL/EXTI/EXTI_interface.h"
+#include "../../MCAL/TIM/TIM_interface.h"
+#include "../../MCAL/USART/USART_interface.h"
+
+/**
+ * @addtogroup hal
+ * @{
+ */
+
+/**
+ * @addtogroup logcap_module
+ * @{
+ */
+
+/**
+ * @typedef t_LOGCAP_State
+ * @brief LOGCAP Capture State
+ * @details This type is used to report the progress of a capture
+ */
+typedef enum
+{
+	/**
+	 * @brief No capture is started
+	 */
+	LOGCAP_State_Idle = 0,
+	/**
+	 * @brief The samples are being recorded, waiting for the trigger
+	 */
+	LOGCAP_State_Armed,
+	/**
+	 * @brief The trigger happened, recording the post-trigger samples
+	 */
+	LOGCAP_State_Triggered,
+	/**
+	 * @brief The capture is complete, the buffer holds the raw samples
+	 */
+	LOGCAP_State_Done,
+	/**
+	 * @brief The capture is complete, the buffer holds the encoded samples
+	 */
+	LOGCAP_State_Encoded
+} t_LOGCAP_State;
+
+/**
+ * @typedef t_LOGCAP_Callback
+ * @brief LOGCAP Callback
+ * @details This type is used to define the function called from the DMA interrupt once the capture is complete
+ */
+typedef P2FUNC(void, t_LOGCAP_Callback)(void);
+
+/**
+ * @struct t_LOGCAP_Config
+ * @brief LOGCAP Capture Configuration
+ * @details This type is used to describe a capture
+ */
+typedef struct
+{
+	/**
+	 * @brief The number of the samples per second
+	 */
+	t_u32 u32SampleRate;
+	/**
+	 * @brief The raw samples ring buffer, it holds the encoded capture at the end
+	 */
+	P2VAR(t_u16) pu16Buffer;
+	/**
+	 * @brief The function called once the capture is complete (can be NULL)
+	 */
+	t_LOGCAP_Callback pfCallback;
+	/**
+	 * @brief The sampled pins (bits 0 to 14, bit 15 is used by the encoding)
+	 */
+	t_u16 u16PinsMask;
+	/**
+	 * @brief The number of the samples of the buffer (even)
+	 */
+	t_u16 u16BufferSize;
+	/**
+	 * @brief The number of the samples kept before the trigger
+	 */
+	t_u16 u16PreTrigger;
+	/**
+	 * @brief The number of the samples recorded after the trigger, the pre and post-trigger samples must fit in half the buffer
+	 */
+	t_u16 u16PostTrigger;
+	/**
+	 * @brief The timer that paces the samples, it is initialized and used exclusively by the capture
+	 */
+	t_TIM_Peripherals tTimer;
+	/**
+	 * @brief The sampled GPIO port
+	 */
+	t_GPIO_Ports tPort;
+	/**
+	 * @brief The trigger pin
+	 */
+	t_GPIO_Pins tTriggerPin;
+	/**
+	 * @brief The trigger edge(s)
+	 */
+	t_EXTI_Triggers tTriggerEdge;
+	/**
+	 * @brief TRUE to trigger on an edge of a pin of the sampled port, FALSE to trigger using LOGCAP_vTrigger() only
+	 */
+	t_bool bPinTrigger;
+	/**
+	 * @brief Unused, it completes the structure to a multiple of 4 bytes without any implicit padding
+	 */
+	t_u8 au8Reserved[3];
+} t_LOGCAP_Config;
+
+/**
+ * @brief This function starts a capture
+ * @details The timer raises a DMA request at the sample rate and the DMA copies the input data register of the port
+ * into the ring buffer, so the sampling costs no CPU time. The CPU only runs on each half buffer to stop the capture
+ * once the post-trigger samples are recorded
+ * @param[in] ptConfig The capture configuration, it must stay valid until the capture is dumped
+ * @return TRUE if the capture is started, FALSE if a capture is in progress, the configuration is invalid or
+ * the update DMA channel of the timer is owned by another driver
+ * @note The timer, GPIO and DMA1 clocks (and the AFIO clock for a pin trigger) must be enabled.
+ * The sample rate is limited by the DMA bandwidth to a few MHz
+ * @see t_LOGCAP_Config LOGCAP_vTrigger LOGCAP_tGetState
+ */
+t_bool LOGCAP_bStart(P2CONST(t_LOGCAP_Config) ptConfig);
+
+/**
+ * @brief This function triggers the armed capture
+ * @details This function records the position of the trigger, it is also the callback of the trigger pin
+ * @note The trigger is ignored if the capture is not armed
+ */
+void LOGCAP_vTrigger(void);
+
+/**
+ * @brief This function aborts the capture in progress
+ * @details This function stops the timer and releases its update DMA channel, the capture returns to idle
+ */
+void LOGCAP_vAbort(void);
+
+/**
+ * @brief This function gets the state of the capture
+ * @return The state of the capture
+ * @see t_LOGCAP_State
+ */
+t_LOGCAP_State LOGCAP_tGetState(void);
+
+/**
+ * @brief This function encodes a complete capture in place
+ * @details The window of samples is moved to the start of the buffer, then every run of equal samples is replaced
+ * by the value word followed by one run word (bit 15 set) that holds the number of repetitions. The encoded capture
+ * is never longer than the raw one, and a slow signal shrinks to a few words
+ * @return The number of the encoded words at the start of the buffer, 0 if the capture is not complete
+ * @see LOGCAP_tGetState LOGCAP_vDump
+ */
+t_u16 LOGCAP_u16Encode(void);
+
+/**
+ * @brief This function dumps a complete capture as text over a USART
+ * @details The capture is encoded first if needed. All the numbers are hexadecimal, one record per line:
+ * 	- `$logcap <sample rate in Hz> <pins mask> <trigger sample>` the header
+ * 	- `<sample> <value>` the port value changed at this sample (the first record is sample 0)
+ * 	- `$end <samples count>` the end of the capture
+ *
+ * A host tool converts it to VCD by declaring one wire per pin of the mask with a timescale of one sample period,
+ * then emitting `#<sample>` followed by the bits of each value
+ * @param[in] tUSART The initialized USART peripheral
+ * @note This function waits for room in the USART transmit buffer
+ * @see LOGCAP_u16Encode
+ */
+void LOGCAP_vDump(t_USART_Peripherals tUSART);
+
+/** @} */
+/** @} */
+
+#endif /* _LOGCAP_INTERFACE_H_ */
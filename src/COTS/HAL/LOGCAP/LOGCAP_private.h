@@ -0,0 +1,59 @@
+/**
+ * @file LOGCAP_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros for the LOGCAP module.
+ * @details This file contains the private macros for the LOGCAP module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir HAL/LOGCAP
+ * @brief LOGCAP Module
+ * @details This module contains all the APIs related to the DMA driven logic analyzer capture
+ */
+
+#ifndef _LOGCAP_PRIVATE_H_
+#define _LOGCAP_PRIVATE_H_
+
+/**
+ * @addtogroup hal
+ * @{
+ */
+
+/**
+ * @defgroup logcap_module LOGCAP Module
+ * @brief LOGCAP Module
+ * @details This module contains all the APIs related to the DMA driven logic analyzer capture
+ * @{
+ */
+
+/**
+ * @defgroup logcap_constants LOGCAP Constants
+ * @brief LOGCAP Constants
+ * @{
+ */
+
+/**
+ * @def LOGCAP_RUN_FLAG
+ * @brief The bit that marks a run word in the encoded capture
+ */
+#define LOGCAP_RUN_FLAG ((t_u16)0x8000U)
+
+/**
+ * @def LOGCAP_RUN_MAX
+ * @brief The longest run that fits in one run word
+ */
+#define LOGCAP_RUN_MAX ((t_u16)0x7FFFU)
+
+/**
+ * @def LOGCAP_HEX_DIGITS_MAX
+ * @brief The number of the hexadecimal digits of a 32-bit value
+ */
+#define LOGCAP_HEX_DIGITS_MAX (8)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _LOGCAP_PRIVATE_H_ */
@@ -0,0 +1,483 @@
+/**
+ * @file LOGCAP_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the LOGCAP module.
+ * @details This file contains the implementation for the LOGCAP module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../../MCAL/GPIO/GPIO_interface.h"
+#include "../../MCAL/EXTI/EXTI_interface.h"
+#include "../../MCAL/DMA/DMA_interface.h"
+#include "../../MCAL/TIM/TIM_interface.h"
+#include "../../MCAL/USART/USART_interface.h"
+#include "LOGCAP_private.h"
+#include "LOGCAP_interface.h"
+#include "LOGCAP_config.h"
+
+/**
+ * @brief The configuration of the current capture
+ */
+STATIC P2CONST(t_LOGCAP_Config) ptLOGCAPConfig = NULL;
+
+/**
+ * @brief The state of the current capture
+ */
+STATIC VOLATILE t_LOGCAP_State tLOGCAPState = LOGCAP_State_Idle;
+
+/**
+ * @brief The number of the half buffers filled by the DMA since the start
+ */
+STATIC VOLATILE t_u32 u32LOGCAPHalves = 0;
+
+/**
+ * @brief The absolute sample number of the trigger
+ */
+STATIC t_u32 u32LOGCAPTriggerSample = 0;
+
+/**
+ * @brief The absolute sample number of the first sample of the window
+ */
+STATIC t_u32 u32LOGCAPWindowStart = 0;
+
+/**
+ * @brief The number of the samples of the window
+ */
+STATIC t_u16 u16LOGCAPWindowLength = 0;
+
+/**
+ * @brief The number of the encoded words
+ */
+STATIC t_u16 u16LOGCAPEncodedLength = 0;
+
+/**
+ * @brief This function gets the absolute number of the sample being written by the DMA
+ * @details The DMA position tells in which half the DMA is, if it does not match the number of the filled halves
+ * then the interrupt of the half that just completed is pending and is taken into account
+ * @return The number of the samples recorded since the start
+ */
+STATIC t_u32 LOGCAP_u32GetSampleNumber(void)
+{
+	t_u32 u32Size = ptLOGCAPConfig->u16BufferSize;
+	t_u32 u32Halves = u32LOGCAPHalves;
+	t_u32 u32Position = u32Size - DMA_u16GetRemainingCount(TIM_tGetUpdateDMAChannel(ptLOGCAPConfig->tTimer));
+
+	if (((u32Halves & 1U) != 0U) && (u32Position < (u32Size / 2U)))
+	{
+		u32Halves++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return ((u32Halves / 2U) * u32Size) + u32Position;
+}
+
+/**
+ * @brief This function stops the sampling timer and releases its DMA channel
+ */
+STATIC void LOGCAP_vStopSampling(void)
+{
+	TIM_vStop(ptLOGCAPConfig->tTimer);
+	TIM_vDisableUpdateDMARequest(ptLOGCAPConfig->tTimer);
+
+	if (ptLOGCAPConfig->bPinTrigger == TRUE)
+	{
+		EXTI_vDisablePinInterrupt(ptLOGCAPConfig->tTriggerPin);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function reverses a part of the buffer in place
+ * @param[in] pu16Buffer The buffer
+ * @param[in] u16First The index of the first sample of the part
+ * @param[in] u16Last The index of the last sample of the part
+ */
+STATIC void LOGCAP_vReverse(P2VAR(t_u16) pu16Buffer, t_u16 u16First, t_u16 u16Last)
+{
+	t_u16 u16Sample = 0;
+
+	while (u16First < u16Last)
+	{
+		u16Sample = pu16Buffer[u16First];
+		pu16Buffer[u16First] = pu16Buffer[u16Last];
+		pu16Buffer[u16Last] = u16Sample;
+		u16First++;
+		u16Last--;
+	}
+}
+
+/**
+ * @brief This function writes a whole text to a USART
+ * @param[in] tUSART The USART peripheral
+ * @param[in] pu8Text The text
+ * @param[in] u16Length The number of the characters
+ */
+STATIC void LOGCAP_vWrite(t_USART_Peripherals tUSART, P2CONST(t_u8) pu8Text, t_u16 u16Length)
+{
+	t_u16 u16Written = 0;
+
+	while (u16Written < u16Length)
+	{
+		u16Written += USART_u16Write(tUSART, &pu8Text[u16Written], (t_u16)(u16Length - u16Written));
+	}
+}
+
+/**
+ * @brief This function writes a value in hexadecimal followed by a separator to a USART
+ * @param[in] tUSART The USART peripheral
+ * @param[in] u32Value The value
+ * @param[in] u8Separator The character written after the value
+ */
+STATIC void LOGCAP_vWriteHex(t_USART_Peripherals tUSART, t_u32 u32Value, t_u8 u8Separator)
+{
+	t_u8 au8Text[LOGCAP_HEX_DIGITS_MAX + 1];
+	t_u8 u8Index = LOGCAP_HEX_DIGITS_MAX;
+	t_u8 u8Digit = 0;
+
+	au8Text[LOGCAP_HEX_DIGITS_MAX] = u8Separator;
+
+	/* Write the digits from the last one, at least one digit */
+	do
+	{
+		u8Index--;
+		u8Digit = (t_u8)(u32Value & 0xFU);
+		au8Text[u8Index] = (u8Digit < 10U) ? (t_u8)('0' + u8Digit) : (t_u8)('a' + (u8Digit - 10U));
+		u32Value >>= 4;
+	} while (u32Value != 0U);
+
+	LOGCAP_vWrite(tUSART, &au8Text[u8Index], (t_u16)((LOGCAP_HEX_DIGITS_MAX + 1) - u8Index));
+}
+
+/**
+ * @brief This function serves the DMA events of the capture
+ * @details Every half buffer is counted, the capture is complete once the post-trigger samples are recorded.
+ * The window is the pre-trigger samples that are still in the buffer and the post-trigger samples
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void LOGCAP_vDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent)
+{
+	t_u32 u32Recorded = 0;
+	t_u32 u32Oldest = 0;
+
+	if ((tEvent == DMA_Events_HalfTransfer) || (tEvent == DMA_Events_TransferComplete))
+	{
+		u32LOGCAPHalves++;
+		u32Recorded = u32LOGCAPHalves * (ptLOGCAPConfig->u16BufferSize / 2U);
+
+		/* A trigger served before a pending half event can be past the counted halves */
+		if ((tLOGCAPState == LOGCAP_State_Triggered) && (u32Recorded >= u32LOGCAPTriggerSample) && ((u32Recorded - u32LOGCAPTriggerSample) >= ptLOGCAPConfig->u16PostTrigger))
+		{
+			LOGCAP_vStopSampling();
+
+			/* The oldest sample still in the buffer once the DMA stopped */
+			u32Recorded = LOGCAP_u32GetSampleNumber();
+			u32Oldest = (u32Recorded > ptLOGCAPConfig->u16BufferSize) ? (u32Recorded - ptLOGCAPConfig->u16BufferSize) : 0U;
+
+			u32LOGCAPWindowStart = (u32LOGCAPTriggerSample > ptLOGCAPConfig->u16PreTrigger) ? (u32LOGCAPTriggerSample - ptLOGCAPConfig->u16PreTrigger) : 0U;
+
+			if (u32LOGCAPWindowStart < u32Oldest)
+			{
+				u32LOGCAPWindowStart = u32Oldest;
+			}
+			else
+			{
+				/* Do nothing */
+			}
+
+			u16LOGCAPWindowLength = (t_u16)((u32LOGCAPTriggerSample + ptLOGCAPConfig->u16PostTrigger) - u32LOGCAPWindowStart);
+			DMA_vReleaseChannel(tChannel);
+			tLOGCAPState = LOGCAP_State_Done;
+
+			if (ptLOGCAPConfig->pfCallback != NULL)
+			{
+				ptLOGCAPConfig->pfCallback();
+			}
+			else
+			{
+				/* Do nothing */
+			}
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool LOGCAP_bStart(P2CONST(t_LOGCAP_Config) ptConfig)
+{
+	t_DMA_Channels tChannel = TIM_tGetUpdateDMAChannel(ptConfig->tTimer);
+	t_DMA_ChannelConfig tDMAConfig;
+	t_bool bStatus = FALSE;
+
+	if (((tLOGCAPState == LOGCAP_State_Idle) || (tLOGCAPState >= LOGCAP_State_Done)) && (ptConfig->u16BufferSize >= 2U) && ((ptConfig->u16BufferSize & 1U) == 0U) &&
+		(((t_u32)ptConfig->u16PreTrigger + ptConfig->u16PostTrigger) <= (ptConfig->u16BufferSize / 2U)))
+	{
+		bStatus = DMA_bAllocateChannel(tChannel, (P2CONST(void))&ptLOGCAPConfig);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == TRUE)
+	{
+		TIM_vInit(ptConfig->tTimer);
+		bStatus = TIM_bSetFrequency(ptConfig->tTimer, ptConfig->u32SampleRate);
+
+		if (bStatus == FALSE)
+		{
+			DMA_vReleaseChannel(tChannel);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == TRUE)
+	{
+		ptLOGCAPConfig = ptConfig;
+		u32LOGCAPHalves = 0U;
+		u16LOGCAPEncodedLength = 0U;
+		tLOGCAPState = LOGCAP_State_Armed;
+
+		/* Sample the whole port, the mask is applied while encoding */
+		tDMAConfig.u32PeripheralAddress = GPIO_u32GetIDRAddress(ptConfig->tPort);
+		tDMAConfig.u32MemoryAddress = (t_u32)ptConfig->pu16Buffer;
+		tDMAConfig.u16Count = ptConfig->u16BufferSize;
+		tDMAConfig.tDirection = DMA_Direction_PeripheralToMemory;
+		tDMAConfig.tPeripheralSize = DMA_Size_16Bits;
+		tDMAConfig.tMemorySize = DMA_Size_16Bits;
+		tDMAConfig.bPeripheralIncrement = FALSE;
+		tDMAConfig.bMemoryIncrement = TRUE;
+		tDMAConfig.bCircular = TRUE;
+		tDMAConfig.tPriority = DMA_Priority_VeryHigh;
+		tDMAConfig.u8Events = DMA_Events_HalfTransfer | DMA_Events_TransferComplete;
+		tDMAConfig.pfCallback = LOGCAP_vDMAEventHandler;
+		DMA_vConfigureChannel(tChannel, &tDMAConfig);
+		DMA_vSetChannelPriority(tChannel, LOGCAP_DMA_IRQ_PRIORITY);
+		DMA_vStartChannel(tChannel);
+
+		if (ptConfig->bPinTrigger == TRUE)
+		{
+			EXTI_vEnablePinInterrupt(ptConfig->tPort, ptConfig->tTriggerPin, ptConfig->tTriggerEdge, LOGCAP_vTrigger);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		TIM_vEnableUpdateDMARequest(ptConfig->tTimer);
+		TIM_vStart(ptConfig->tTimer);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void LOGCAP_vTrigger(void)
+{
+	t_u32 u32State = CPU_u32EnterCritical();
+
+	if (tLOGCAPState == LOGCAP_State_Armed)
+	{
+		u32LOGCAPTriggerSample = LOGCAP_u32GetSampleNumber();
+		tLOGCAPState = LOGCAP_State_Triggered;
+
+		if (ptLOGCAPConfig->bPinTrigger == TRUE)
+		{
+			EXTI_vDisablePinInterrupt(ptLOGCAPConfig->tTriggerPin);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32State);
+}
+
+void LOGCAP_vAbort(void)
+{
+	t_u32 u32State = CPU_u32EnterCritical();
+
+	if ((tLOGCAPState == LOGCAP_State_Armed) || (tLOGCAPState == LOGCAP_State_Triggered))
+	{
+		LOGCAP_vStopSampling();
+		DMA_vReleaseChannel(TIM_tGetUpdateDMAChannel(ptLOGCAPConfig->tTimer));
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	tLOGCAPState = LOGCAP_State_Idle;
+	CPU_vExitCritical(u32State);
+}
+
+t_LOGCAP_State LOGCAP_tGetState(void)
+{
+	return tLOGCAPState;
+}
+
+t_u16 LOGCAP_u16Encode(void)
+{
+	P2VAR(t_u16) pu16Buffer = NULL;
+	t_u16 u16Size = 0;
+	t_u16 u16Start = 0;
+	t_u16 u16Mask = 0;
+	t_u16 u16Index = 0;
+	t_u16 u16Sample = 0;
+	t_u16 u16Previous = 0;
+	t_u16 u16Run = 0;
+	t_u16 u16Length = 0;
+
+	if (tLOGCAPState == LOGCAP_State_Done)
+	{
+		pu16Buffer = ptLOGCAPConfig->pu16Buffer;
+		u16Size = ptLOGCAPConfig->u16BufferSize;
+		u16Start = (t_u16)(u32LOGCAPWindowStart % u16Size);
+		u16Mask = ptLOGCAPConfig->u16PinsMask & LOGCAP_RUN_MAX;
+
+		/* Rotate the ring so that the window starts at index 0 (three reversals, no extra memory) */
+		if (u16Start != 0U)
+		{
+			LOGCAP_vReverse(pu16Buffer, 0U, (t_u16)(u16Start - 1U));
+			LOGCAP_vReverse(pu16Buffer, u16Start, (t_u16)(u16Size - 1U));
+			LOGCAP_vReverse(pu16Buffer, 0U, (t_u16)(u16Size - 1U));
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		/* Each word is written after the samples it describes are read, so the encoding never overtakes the reading */
+		u16Previous = pu16Buffer[0] & u16Mask;
+		pu16Buffer[0] = u16Previous;
+		u16Length = 1U;
+
+		for (u16Index = 1U; u16Index < u16LOGCAPWindowLength; u16Index++)
+		{
+			u16Sample = pu16Buffer[u16Index] & u16Mask;
+
+			if (u16Sample == u16Previous)
+			{
+				u16Run++;
+
+				if (u16Run == LOGCAP_RUN_MAX)
+				{
+					pu16Buffer[u16Length++] = LOGCAP_RUN_FLAG | u16Run;
+					u16Run = 0U;
+				}
+				else
+				{
+					/* Do nothing */
+				}
+			}
+			else
+			{
+				if (u16Run != 0U)
+				{
+					pu16Buffer[u16Length++] = LOGCAP_RUN_FLAG | u16Run;
+					u16Run = 0U;
+				}
+				else
+				{
+					/* Do nothing */
+				}
+
+				pu16Buffer[u16Length++] = u16Sample;
+				u16Previous = u16Sample;
+			}
+		}
+
+		if (u16Run != 0U)
+		{
+			pu16Buffer[u16Length++] = LOGCAP_RUN_FLAG | u16Run;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		u16LOGCAPEncodedLength = u16Length;
+		tLOGCAPState = LOGCAP_State_Encoded;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return u16LOGCAPEncodedLength;
+}
+
+void LOGCAP_vDump(t_USART_Peripherals tUSART)
+{
+	STATIC CONST t_u8 au8Header[] = "$logcap ";
+	STATIC CONST t_u8 au8Footer[] = "$end ";
+	P2CONST(t_u16) pu16Words = NULL;
+	t_u32 u32Sample = 0;
+	t_u16 u16Index = 0;
+
+	(void)LOGCAP_u16Encode();
+
+	if (tLOGCAPState == LOGCAP_State_Encoded)
+	{
+		pu16Words = ptLOGCAPConfig->pu16Buffer;
+
+		LOGCAP_vWrite(tUSART, au8Header, (t_u16)(sizeof(au8Header) - 1U));
+		LOGCAP_vWriteHex(tUSART, ptLOGCAPConfig->u32SampleRate, ' ');
+		LOGCAP_vWriteHex(tUSART, ptLOGCAPConfig->u16PinsMask & LOGCAP_RUN_MAX, ' ');
+		LOGCAP_vWriteHex(tUSART, u32LOGCAPTriggerSample - u32LOGCAPWindowStart, '\n');
+
+		for (u16Index = 0; u16Index < u16LOGCAPEncodedLength; u16Index++)
+		{
+			if ((pu16Words[u16Index] & LOGCAP_RUN_FLAG) != 0U)
+			{
+				/* The value holds for more samples */
+				u32Sample += pu16Words[u16Index] & LOGCAP_RUN_MAX;
+			}
+			else
+			{
+				LOGCAP_vWriteHex(tUSART, u32Sample, ' ');
+				LOGCAP_vWriteHex(tUSART, pu16Words[u16Index], '\n');
+				u32Sample++;
+			}
+		}
+
+		LOGCAP_vWrite(tUSART, au8Footer, (t_u16)(sizeof(au8Footer) - 1U));
+		LOGCAP_vWriteHex(tUSART, u32Sample, '\n');
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
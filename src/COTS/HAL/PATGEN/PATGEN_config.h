@@ -0,0 +1,43 @@
+/**
+ * @file PATGEN_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the PATGEN module.
+ * @details This file contains the configuration parameters for the PATGEN module.
+ * @date 2026-10-19
+ */
+
+#ifndef _PATGEN_CONFIG_H_
+#define _PATGEN_CONFIG_H_
+
+#include "PATGEN_interface.h"
+
+/**
+ * @addtogroup hal
+ * @{
+ */
+
+/**
+ * @addtogroup patgen_module
+ * @{
+ */
+
+/**
+ * @defgroup patgen_config PATGEN Configuration
+ * @brief This group contains the configuration parameters of the PATGEN module
+ * @{
+ */
+
+/**
+ * @def PATGEN_DMA_IRQ_PRIORITY
+ * @brief This macro defines the NVIC priority of the pattern DMA interrupts
+ * @details This macro defines the NVIC priority of the pattern DMA interrupts (0 to 15), they only report
+ * the end of the pattern, the words themselves are written without any interrupt
+ */
+#define PATGEN_DMA_IRQ_PRIORITY (4)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _PATGEN_CONFIG_H_ */
@@ -0,0 +1,75 @@
+/**
+ * @file PATGEN_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the PATGEN module.
+ * @details This file contains the prototypes of the functions of the PATGEN module.
+ * @date 2026-10-19
+ */
+
+#ifndef _PATGEN_INTERFACE_H_
+#define _PATGEN_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../MCAL/GPIO/GPIO_interface.h"
+#include "../../MCAL/TIM/TIM_interface.h"
+
+/**
+ * @addtogroup hal
+ * @{
+ */
+
+/**
+ * @addtogroup patgen_module
+ * @{
+ */
+
+/**
+ * @typedef t_PATGEN_Callback
+ * @brief PATGEN Callback
+ * @details This type is used to define the function called once the whole pattern has been written
+ * (at the end of every repetition in circular mode)
+ */
+typedef P2FUNC(void, t_PATGEN_Callback)(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function starts streaming a pattern to a GPIO port
+ * @details The timer raises a DMA request at the sample rate and the DMA writes the next word of the pattern to the
+ * BSRR register of the port, so every pin changes at the exact same cycle and no CPU work is involved
+ * @param[in] tTIM The timer that paces the pattern, it is initialized and used exclusively by the pattern
+ * @param[in] tPort The GPIO port
+ * @param[in] pu32Pattern The BSRR words (see GPIO_BSRR_SET() and GPIO_BSRR_RESET()), a pin that is neither set
+ * nor reset by a word keeps its level
+ * @param[in] u16Count The number of the words
+ * @param[in] u32SampleRate The number of the words written per second
+ * @param[in] bCircular TRUE to repeat the pattern until PATGEN_vStop() is called, FALSE to write it once
+ * @param[in] pfCallback The function called at the end of the pattern (can be NULL)
+ * @return TRUE if the pattern is started, FALSE if the sample rate is out of range or the update DMA channel
+ * of the timer is owned by another driver
+ * @note The pins must be configured as outputs and the timer, GPIO and DMA1 clocks must be enabled.
+ * The first word is written one sample period after the start
+ * @see t_TIM_Peripherals t_GPIO_Ports t_PATGEN_Callback PATGEN_vStop
+ */
+t_bool PATGEN_bStart(t_TIM_Peripherals tTIM, t_GPIO_Ports tPort, P2CONST(t_u32) pu32Pattern, t_u16 u16Count, t_u32 u32SampleRate, t_bool bCircular, t_PATGEN_Callback pfCallback);
+
+/**
+ * @brief This function stops a pattern
+ * @details This function stops the timer and releases its update DMA channel, the pins keep their levels
+ * @param[in] tTIM The timer that paces the pattern
+ * @see t_TIM_Peripherals PATGEN_bStart
+ */
+void PATGEN_vStop(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function checks whether a pattern is being written
+ * @param[in] tTIM The timer that paces the pattern
+ * @return TRUE if the pattern is being written, FALSE otherwise
+ * @see t_TIM_Peripherals PATGEN_bStart
+ */
+t_bool PATGEN_bIsBusy(t_TIM_Peripherals tTIM);
+
+/** @} */
+/** @} */
+
+#endif /* _PATGEN_INTERFACE_H_ */
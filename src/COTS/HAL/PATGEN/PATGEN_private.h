@@ -0,0 +1,47 @@
+/**
+ * @file PATGEN_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros for the PATGEN module.
+ * @details This file contains the private macros for the PATGEN module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir HAL/PATGEN
+ * @brief PATGEN Module
+ * @details This module contains all the APIs related to the DMA driven GPIO pattern generator
+ */
+
+#ifndef _PATGEN_PRIVATE_H_
+#define _PATGEN_PRIVATE_H_
+
+/**
+ * @addtogroup hal
+ * @{
+ */
+
+/**
+ * @defgroup patgen_module PATGEN Module
+ * @brief PATGEN Module
+ * @details This module contains all the APIs related to the DMA driven GPIO pattern generator
+ * @{
+ */
+
+/**
+ * @defgroup patgen_constants PATGEN Constants
+ * @brief PATGEN Constants
+ * @{
+ */
+
+/**
+ * @def PATGEN_TIMERS_COUNT
+ * @brief Number of the timers that can pace a pattern
+ */
+#define PATGEN_TIMERS_COUNT (4)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _PATGEN_PRIVATE_H_ */
@@ -0,0 +1,157 @@
+/**
+ * @file PATGEN_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the PATGEN module.
+ * @details This file contains the implementation for the PATGEN module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../MCAL/GPIO/GPIO_interface.h"
+#include "../../MCAL/DMA/DMA_interface.h"
+#include "../../MCAL/TIM/TIM_interface.h"
+#include "PATGEN_private.h"
+#include "PATGEN_interface.h"
+#include "PATGEN_config.h"
+
+/**
+ * @brief The end of pattern callbacks, their addresses are also the owner tokens of the DMA channels
+ */
+STATIC t_PATGEN_Callback apfPATGENCallbacks[PATGEN_TIMERS_COUNT] = {NULL};
+
+/**
+ * @brief The pattern modes (circular or one-shot)
+ */
+STATIC t_bool abPATGENCircular[PATGEN_TIMERS_COUNT] = {FALSE};
+
+/**
+ * @brief This function serves the DMA events of the patterns
+ * @details A one-shot pattern is stopped once its last word is written
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void PATGEN_vDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent)
+{
+	t_u8 u8TIM = 0;
+	t_PATGEN_Callback pfCallback = NULL;
+
+	/* Get the timer that paces the pattern of the channel */
+	while ((u8TIM < PATGEN_TIMERS_COUNT) && (DMA_pvGetChannelOwner(tChannel) != (P2CONST(void))&apfPATGENCallbacks[u8TIM]))
+	{
+		u8TIM++;
+	}
+
+	if ((u8TIM < PATGEN_TIMERS_COUNT) && (tEvent == DMA_Events_TransferComplete))
+	{
+		pfCallback = apfPATGENCallbacks[u8TIM];
+
+		if (abPATGENCircular[u8TIM] == FALSE)
+		{
+			PATGEN_vStop((t_TIM_Peripherals)u8TIM);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		if (pfCallback != NULL)
+		{
+			pfCallback((t_TIM_Peripherals)u8TIM);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool PATGEN_bStart(t_TIM_Peripherals tTIM, t_GPIO_Ports tPort, P2CONST(t_u32) pu32Pattern, t_u16 u16Count, t_u32 u32SampleRate, t_bool bCircular, t_PATGEN_Callback pfCallback)
+{
+	t_DMA_Channels tChannel = TIM_tGetUpdateDMAChannel(tTIM);
+	t_DMA_ChannelConfig tDMAConfig;
+	t_bool bStatus = FALSE;
+
+	if (u16Count != 0U)
+	{
+		bStatus = DMA_bAllocateChannel(tChannel, (P2CONST(void))&apfPATGENCallbacks[tTIM]);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == TRUE)
+	{
+		TIM_vInit(tTIM);
+		bStatus = TIM_bSetFrequency(tTIM, u32SampleRate);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == TRUE)
+	{
+		apfPATGENCallbacks[tTIM] = pfCallback;
+		abPATGENCircular[tTIM] = bCircular;
+
+		tDMAConfig.u32PeripheralAddress = GPIO_u32GetBSRRAddress(tPort);
+		tDMAConfig.u32MemoryAddress = (t_u32)pu32Pattern;
+		tDMAConfig.u16Count = u16Count;
+		tDMAConfig.tDirection = DMA_Direction_MemoryToPeripheral;
+		tDMAConfig.tPeripheralSize = DMA_Size_32Bits;
+		tDMAConfig.tMemorySize = DMA_Size_32Bits;
+		tDMAConfig.bPeripheralIncrement = FALSE;
+		tDMAConfig.bMemoryIncrement = TRUE;
+		tDMAConfig.bCircular = bCircular;
+		/* The highest priority keeps the words on time when other channels are busy */
+		tDMAConfig.tPriority = DMA_Priority_VeryHigh;
+		tDMAConfig.u8Events = DMA_Events_TransferComplete;
+		tDMAConfig.pfCallback = PATGEN_vDMAEventHandler;
+		DMA_vConfigureChannel(tChannel, &tDMAConfig);
+		DMA_vSetChannelPriority(tChannel, PATGEN_DMA_IRQ_PRIORITY);
+		DMA_vStartChannel(tChannel);
+
+		TIM_vEnableUpdateDMARequest(tTIM);
+		TIM_vStart(tTIM);
+	}
+	else if (DMA_pvGetChannelOwner(tChannel) == (P2CONST(void))&apfPATGENCallbacks[tTIM])
+	{
+		/* The sample rate is out of range */
+		DMA_vReleaseChannel(tChannel);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void PATGEN_vStop(t_TIM_Peripherals tTIM)
+{
+	t_DMA_Channels tChannel = TIM_tGetUpdateDMAChannel(tTIM);
+
+	if (DMA_pvGetChannelOwner(tChannel) == (P2CONST(void))&apfPATGENCallbacks[tTIM])
+	{
+		TIM_vStop(tTIM);
+		TIM_vDisableUpdateDMARequest(tTIM);
+		DMA_vReleaseChannel(tChannel);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool PATGEN_bIsBusy(t_TIM_Peripherals tTIM)
+{
+	return (DMA_pvGetChannelOwner(TIM_tGetUpdateDMAChannel(tTIM)) == (P2CONST(void))&apfPATGENCallbacks[tTIM]) ? TRUE : FALSE;
+}
@@ -0,0 +1,9 @@
+/**
+ * @dir HAL HAL Components
+ * @brief HAL Components
+ */
+
+/**
+ * @defgroup hal HAL Components
+ * @brief Hardware abstraction components built on top of the MCAL peripheral drivers
+ */
@@ -38,6 +38,70 @@
 */
 #define VOLATILE volatile
 
+/**
+ * @def INLINE
+ * @brief Declare a standard inline function
+ */
+#define INLINE inline
+
+/**
+ * @def ALWAYS_INLINE
+ * @brief Force the compiler to inline a function even if optimizations are disabled
+ */
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+
+/**
+ * @def SECTION(NAME)
+ * @brief Place a variable/function in a certain linker section
+ * @param[in] NAME The name of the section (string literal)
+ */
+#define SECTION(NAME) __attribute__((section(NAME)))
+
+/**
+ * @def ALIGNED(BYTES)
+ * @brief Align a variable to a certain number of bytes
+ * @param[in] BYTES The alignment in bytes (power of two)
+ */
+#define ALIGNED(BYTES) __attribute__((aligned(BYTES)))
+
+/**
+ * @def NOINIT
+ * @brief Place a variable in the `.noinit` section, the startup code neither initializes nor clears it so its content
+ * survives a warm reset (watchdog, software or pin reset)
+ * @warning The content is random after a power-on reset, it must be validated (e.g. by a magic word and a checksum)
+ */
+#define NOINIT SECTION(".noinit")
+
+/**
+ * @def RAMFUNC
+ * @brief Place a function in the `.ramfunc` section, the startup code copies it to the SRAM where it runs without the flash wait states
+ * @details The function is never inlined so that it really runs from the SRAM. The flash and the SRAM are out of the range
+ * of a `bl` instruction from each other: the calls that see this attribute load the address in a register (`long_call`),
+ * the other ones go through a long branch veneer added by the linker
+ * @note Each function costs its size in both the flash and the SRAM
+ */
+#define RAMFUNC __attribute__((section(".ramfunc"), noinline, long_call))
+
+/**
+ * @def NAKED
+ * @brief Declare a function without the compiler generated prologue and epilogue (its body must be assembly only)
+ */
+#define NAKED __attribute__((naked))
+
+/**
+ * @def USED
+ * @brief Keep a variable/function even if the compiler sees no reference to it (e.g. referenced from assembly only)
+ */
+#define USED __attribute__((used))
+
+/**
+ * @def STATIC_ASSERT(CONDITION, MESSAGE)
+ * @brief Stop the compilation if a constant condition is false
+ * @param[in] CONDITION The constant condition to check
+ * @param[in] MESSAGE The error message (string literal)
+ */
+#define STATIC_ASSERT(CONDITION, MESSAGE) _Static_assert(CONDITION, MESSAGE)
+
 /**
  * @def P2VAR(ptrtype)
  * @brief Declare a pointer-to-variable with the specified type
@@ -0,0 +1,201 @@
+/**
+ * @file LSTD_CPU.h
+ * @author Mohamed Alaa
+ * @brief This file contains the Cortex-M3 core instructions macro-functions
+ * @version 1.0.0
+ * @date 2026-10-19
+ */
+
+#ifndef _LSTD_CPU_H_
+#define _LSTD_CPU_H_
+
+#include "LSTD_TYPES.h"
+#include "LSTD_COMPILER.h"
+
+/**
+ * @addtogroup standard_library
+ * @{
+ */
+
+/**
+ * @defgroup cpu_instructions Cortex-M3 core instructions
+ * @brief These macro-functions give access to the Cortex-M3 instructions that have no C equivalent
+ * @{
+ */
+
+/**
+ * @def CPU_WFI()
+ * @brief Put the core to sleep until an interrupt is pending
+ */
+#define CPU_WFI() __asm volatile("wfi" ::: "memory")
+
+/**
+ * @def CPU_DSB()
+ * @brief Data synchronization barrier, waits for all the explicit memory accesses to complete
+ */
+#define CPU_DSB() __asm volatile("dsb" ::: "memory")
+
+/**
+ * @def CPU_ISB()
+ * @brief Instruction synchronization barrier, flushes the pipeline
+ */
+#define CPU_ISB() __asm volatile("isb" ::: "memory")
+
+/**
+ * @def CPU_DMB()
+ * @brief Data memory barrier, orders the memory accesses before it against the ones after it
+ */
+#define CPU_DMB() __asm volatile("dmb" ::: "memory")
+
+/**
+ * @def CPU_CLREX()
+ * @brief Clear the local exclusive monitor, drops a reservation taken by CPU_u32LDREX()
+ */
+#define CPU_CLREX() __asm volatile("clrex" ::: "memory")
+
+/**
+ * @def CPU_DISABLE_IRQ()
+ * @brief Disable all the maskable interrupts (set PRIMASK)
+ */
+#define CPU_DISABLE_IRQ() __asm volatile("cpsid i" ::: "memory")
+
+/**
+ * @def CPU_ENABLE_IRQ()
+ * @brief Enable all the maskable interrupts (clear PRIMASK)
+ */
+#define CPU_ENABLE_IRQ() __asm volatile("cpsie i" ::: "memory")
+
+/**
+ * @def CPU_CLZ(VALUE)
+ * @brief Count the leading zeros of a 32-bit value (single `clz` instruction)
+ * @param[in] VALUE The value to count its leading zeros
+ * @warning The result is undefined when VALUE is `0`
+ */
+#define CPU_CLZ(VALUE) ((t_u8)__builtin_clz(VALUE))
+
+/**
+ * @def CPU_CTZ(VALUE)
+ * @brief Count the trailing zeros of a 32-bit value (`rbit` + `clz` instructions)
+ * @param[in] VALUE The value to count its trailing zeros
+ * @warning The result is undefined when VALUE is `0`
+ */
+#define CPU_CTZ(VALUE) ((t_u8)__builtin_ctz(VALUE))
+
+/**
+ * @brief Get the current value of the PRIMASK register
+ * @return The PRIMASK register value
+ */
+STATIC ALWAYS_INLINE t_u32 CPU_u32GetPRIMASK(void)
+{
+	t_u32 u32Result;
+
+	__asm volatile("mrs %0, primask" : "=r"(u32Result));
+
+	return u32Result;
+}
+
+/**
+ * @brief Set the value of the PRIMASK register
+ * @param[in] u32PRIMASK The PRIMASK register value
+ */
+STATIC ALWAYS_INLINE void CPU_vSetPRIMASK(t_u32 u32PRIMASK)
+{
+	__asm volatile("msr primask, %0" ::"r"(u32PRIMASK) : "memory");
+}
+
+/**
+ * @brief Get the current value of the BASEPRI register
+ * @return The BASEPRI register value
+ */
+STATIC ALWAYS_INLINE t_u32 CPU_u32GetBASEPRI(void)
+{
+	t_u32 u32Result;
+
+	__asm volatile("mrs %0, basepri" : "=r"(u32Result));
+
+	return u32Result;
+}
+
+/**
+ * @brief Set the value of the BASEPRI register
+ * @details The interrupts of a priority value greater than or equal to BASEPRI are masked, `0` masks none
+ * @param[in] u32BASEPRI The BASEPRI register value (the priority in the implemented upper bits)
+ */
+STATIC ALWAYS_INLINE void CPU_vSetBASEPRI(t_u32 u32BASEPRI)
+{
+	__asm volatile("msr basepri, %0" ::"r"(u32BASEPRI) : "memory");
+}
+
+/**
+ * @brief Raise the BASEPRI register
+ * @details The new value only takes effect if it masks more interrupts than the current one, so nested calls never unmask
+ * @param[in] u32BASEPRI The BASEPRI register value (the priority in the implemented upper bits)
+ * @return The BASEPRI value before raising it
+ */
+STATIC ALWAYS_INLINE t_u32 CPU_u32RaiseBASEPRI(t_u32 u32BASEPRI)
+{
+	t_u32 u32Result = CPU_u32GetBASEPRI();
+
+	__asm volatile("msr basepri_max, %0" ::"r"(u32BASEPRI) : "memory");
+
+	return u32Result;
+}
+
+/**
+ * @brief Load a word and take an exclusive reservation on its address
+ * @details The reservation is lost on any exception entry or return, so a CPU_u32STREX() that follows fails if an
+ * interrupt or a context switch came in between
+ * @param[in] pu32Address The address of the word
+ * @return The word
+ */
+STATIC ALWAYS_INLINE t_u32 CPU_u32LDREX(P2VAR(VOLATILE t_u32) pu32Address)
+{
+	t_u32 u32Result;
+
+	__asm volatile("ldrex %0, %1" : "=r"(u32Result) : "Q"(*pu32Address) : "memory");
+
+	return u32Result;
+}
+
+/**
+ * @brief Store a word if the exclusive reservation taken by CPU_u32LDREX() still holds
+ * @param[in] u32Value The word to store
+ * @param[out] pu32Address The address of the word
+ * @return `0` if the word is stored, `1` if the reservation was lost
+ */
+STATIC ALWAYS_INLINE t_u32 CPU_u32STREX(t_u32 u32Value, P2VAR(VOLATILE t_u32) pu32Address)
+{
+	t_u32 u32Result;
+
+	__asm volatile("strex %0, %2, %1" : "=&r"(u32Result), "=Q"(*pu32Address) : "r"(u32Value) : "memory");
+
+	return u32Result;
+}
+
+/**
+ * @brief Enter a critical section
+ * @details Disable the interrupts and return the previous PRIMASK so that nested critical sections restore it correctly
+ * @return The PRIMASK value before entering the critical section
+ */
+STATIC ALWAYS_INLINE t_u32 CPU_u32EnterCritical(void)
+{
+	t_u32 u32PRIMASK = CPU_u32GetPRIMASK();
+
+	CPU_DISABLE_IRQ();
+
+	return u32PRIMASK;
+}
+
+/**
+ * @brief Exit a critical section
+ * @param[in] u32PRIMASK The PRIMASK value returned by CPU_u32EnterCritical()
+ */
+STATIC ALWAYS_INLINE void CPU_vExitCritical(t_u32 u32PRIMASK)
+{
+	CPU_vSetPRIMASK(u32PRIMASK);
+}
+
+/** @} */
+/** @} */
+
+#endif /* _LSTD_CPU_H_ */
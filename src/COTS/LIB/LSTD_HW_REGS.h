@@ -67,6 +67,17 @@
  */
 #define REGISTER_U32(ADDRESS) REGISTER(t_u32, ADDRESS)
 
+/**
+ * @def BITBAND_PERIPHERAL(ADDRESS, BITNUM)
+ * @brief Map to the bit-band alias of a single bit of a peripheral register
+ * @details Writing the alias word sets/clears only that bit in one bus access, so a bit shared between
+ * the thread mode and an interrupt can be changed without a read-modify-write race
+ * @param[in] ADDRESS The address of the peripheral register (0x40000000 to 0x400FFFFF)
+ * @param[in] BITNUM The number of the bit inside the register
+ * @return The value of the bit (0 or 1)
+ */
+#define BITBAND_PERIPHERAL(ADDRESS, BITNUM) REGISTER_U32(0x42000000UL + (((t_u32)(ADDRESS) - 0x40000000UL) * 32UL) + ((t_u32)(BITNUM) * 4UL))
+
 /** @} */
 /** @} */
 
@@ -0,0 +1,252 @@
+/**
+ * @file LSTD_RING.c
+ * @author Mohamed Alaa
+ * @brief This file contains the implementation of the lock-free ring buffers
+ * @version 1.0.0
+ * @date 2026-10-19
+ */
+
+#include "LSTD_TYPES.h"
+#include "LSTD_COMPILER.h"
+#include "LSTD_VALUES.h"
+#include "LSTD_CPU.h"
+#include "LSTD_RING.h"
+
+/**
+ * @brief This function copies bytes to the storage, wrapping around its end
+ * @param[in,out] ptRing The ring buffer
+ * @param[in] u32Index The free running index of the first byte
+ * @param[in] pu8Data The bytes
+ * @param[in] u32Length The number of the bytes
+ */
+STATIC void RING_vCopyIn(P2VAR(t_RING) ptRing, t_u32 u32Index, P2CONST(t_u8) pu8Data, t_u32 u32Length)
+{
+	t_u32 u32Offset = u32Index & ptRing->u32Mask;
+	t_u32 u32Counter = 0;
+
+	for (u32Counter = 0; u32Counter < u32Length; u32Counter++)
+	{
+		ptRing->pu8Buffer[u32Offset] = pu8Data[u32Counter];
+		u32Offset = (u32Offset + 1U) & ptRing->u32Mask;
+	}
+}
+
+/**
+ * @brief This function copies bytes from the storage, wrapping around its end
+ * @param[in] ptRing The ring buffer
+ * @param[in] u32Index The free running index of the first byte
+ * @param[out] pu8Data The bytes
+ * @param[in] u32Length The number of the bytes
+ */
+STATIC void RING_vCopyOut(P2CONST(t_RING) ptRing, t_u32 u32Index, P2VAR(t_u8) pu8Data, t_u32 u32Length)
+{
+	t_u32 u32Offset = u32Index & ptRing->u32Mask;
+	t_u32 u32Counter = 0;
+
+	for (u32Counter = 0; u32Counter < u32Length; u32Counter++)
+	{
+		pu8Data[u32Counter] = ptRing->pu8Buffer[u32Offset];
+		u32Offset = (u32Offset + 1U) & ptRing->u32Mask;
+	}
+}
+
+/**
+ * @brief This function adds a value to a counter without a lock
+ * @param[in,out] pu32Counter The counter
+ * @param[in] u32Value The value (two's complement to subtract)
+ */
+STATIC void RING_vAtomicAdd(P2VAR(VOLATILE t_u32) pu32Counter, t_u32 u32Value)
+{
+	t_u32 u32Old = 0;
+
+	do
+	{
+		u32Old = CPU_u32LDREX(pu32Counter);
+	} while (CPU_u32STREX(u32Old + u32Value, pu32Counter) != 0U);
+}
+
+t_bool RING_bInit(P2VAR(t_RING) ptRing, P2VAR(t_u8) pu8Buffer, t_u32 u32Size)
+{
+	t_bool bResult = FALSE;
+
+	if (RING_IS_POWER_OF_TWO(u32Size))
+	{
+		ptRing->pu8Buffer = pu8Buffer;
+		ptRing->u32Mask = u32Size - 1U;
+		RING_vReset(ptRing);
+		bResult = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bResult;
+}
+
+void RING_vReset(P2VAR(t_RING) ptRing)
+{
+	ptRing->u32Head = 0U;
+	ptRing->u32Commit = 0U;
+	ptRing->u32Tail = 0U;
+	ptRing->u32Writers = 0U;
+}
+
+t_u32 RING_u32GetCount(P2CONST(t_RING) ptRing)
+{
+	return ptRing->u32Commit - ptRing->u32Tail;
+}
+
+t_u32 RING_u32GetFree(P2CONST(t_RING) ptRing)
+{
+	return (ptRing->u32Mask + 1U) - (ptRing->u32Head - ptRing->u32Tail);
+}
+
+t_u32 RING_u32Write(P2VAR(t_RING) ptRing, P2CONST(t_u8) pu8Data, t_u32 u32Length)
+{
+	t_u32 u32Free = RING_u32GetFree(ptRing);
+
+	if (u32Length > u32Free)
+	{
+		u32Length = u32Free;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	RING_vCopyIn(ptRing, ptRing->u32Head, pu8Data, u32Length);
+	RING_vCommitWrite(ptRing, u32Length);
+
+	return u32Length;
+}
+
+t_bool RING_bWriteMulti(P2VAR(t_RING) ptRing, P2CONST(t_u8) pu8Data, t_u32 u32Length)
+{
+	t_bool bResult = TRUE;
+	t_bool bPublish = TRUE;
+	t_u32 u32Head = 0;
+
+	/* Announce the write first, so that no producer publishes the head while this one is copying */
+	RING_vAtomicAdd(&ptRing->u32Writers, 1U);
+
+	/* Reserve the room, an interrupting producer takes the reservation away and the loop reserves after it */
+	do
+	{
+		u32Head = CPU_u32LDREX(&ptRing->u32Head);
+
+		if (((ptRing->u32Mask + 1U) - (u32Head - ptRing->u32Tail)) < u32Length)
+		{
+			CPU_CLREX();
+			bResult = FALSE;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	} while ((bResult == TRUE) && (CPU_u32STREX(u32Head + u32Length, &ptRing->u32Head) != 0U));
+
+	if (bResult == TRUE)
+	{
+		RING_vCopyIn(ptRing, u32Head, pu8Data, u32Length);
+		CPU_DMB();
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	RING_vAtomicAdd(&ptRing->u32Writers, (t_u32)-1);
+
+	/* The last producer to finish publishes all the reserved bytes, the interrupted ones are done by then */
+	do
+	{
+		(void)CPU_u32LDREX(&ptRing->u32Commit);
+
+		if (ptRing->u32Writers != 0U)
+		{
+			CPU_CLREX();
+			bPublish = FALSE;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	} while ((bPublish == TRUE) && (CPU_u32STREX(ptRing->u32Head, &ptRing->u32Commit) != 0U));
+
+	return bResult;
+}
+
+t_u32 RING_u32Read(P2VAR(t_RING) ptRing, P2VAR(t_u8) pu8Data, t_u32 u32Length)
+{
+	t_u32 u32Count = RING_u32GetCount(ptRing);
+
+	if (u32Length > u32Count)
+	{
+		u32Length = u32Count;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_DMB();
+	RING_vCopyOut(ptRing, ptRing->u32Tail, pu8Data, u32Length);
+	RING_vCommitRead(ptRing, u32Length);
+
+	return u32Length;
+}
+
+t_u32 RING_u32GetWriteSpan(P2VAR(t_RING) ptRing, P2VAR(P2VAR(t_u8)) ppu8Span)
+{
+	t_u32 u32Offset = ptRing->u32Head & ptRing->u32Mask;
+	t_u32 u32Length = RING_u32GetFree(ptRing);
+
+	if (u32Length > ((ptRing->u32Mask + 1U) - u32Offset))
+	{
+		u32Length = (ptRing->u32Mask + 1U) - u32Offset;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	*ppu8Span = &ptRing->pu8Buffer[u32Offset];
+
+	return u32Length;
+}
+
+void RING_vCommitWrite(P2VAR(t_RING) ptRing, t_u32 u32Length)
+{
+	/* The bytes must be in memory before the consumer can see them */
+	CPU_DMB();
+	ptRing->u32Head += u32Length;
+	ptRing->u32Commit = ptRing->u32Head;
+}
+
+t_u32 RING_u32GetReadSpan(P2VAR(t_RING) ptRing, P2VAR(P2VAR(t_u8)) ppu8Span)
+{
+	t_u32 u32Offset = ptRing->u32Tail & ptRing->u32Mask;
+	t_u32 u32Length = RING_u32GetCount(ptRing);
+
+	if (u32Length > ((ptRing->u32Mask + 1U) - u32Offset))
+	{
+		u32Length = (ptRing->u32Mask + 1U) - u32Offset;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	*ppu8Span = &ptRing->pu8Buffer[u32Offset];
+	CPU_DMB();
+
+	return u32Length;
+}
+
+void RING_vCommitRead(P2VAR(t_RING) ptRing, t_u32 u32Length)
+{
+	/* The bytes must be read before the producers can overwrite them */
+	CPU_DMB();
+	ptRing->u32Tail += u32Length;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file LSTD_RING.h
+ * @author Mohamed Alaa
+ * @brief This file contains the lock-free ring buffers
+ * @version 1.0.0
+ * @date 2026-10-19
+ */
+
+#ifndef _LSTD_RING_H_
+#define _LSTD_RING_H_
+
+#include "LSTD_TYPES.h"
+#include "LSTD_COMPILER.h"
+
+/**
+ * @addtogroup standard_library
+ * @{
+ */
+
+/**
+ * @defgroup ring_buffers Ring buffers
+ * @brief This module contains the lock-free byte ring buffers used to move data between the interrupts and the tasks
+ * @details The size is a power of two and the indexes run freely (only their low bits address the storage), so the whole
+ * storage is usable and no index is shared by two writers. One consumer is supported with either one producer
+ * (RING_u32Write(), the spans) or several producers of any priority (RING_bWriteMulti()), the two must not be mixed on the
+ * same ring. The multi-producer path takes no lock: the room is reserved with `ldrex`/`strex` and the data is published by
+ * the last producer to finish, which relies on the reservation being lost on any exception entry or return (single core)
+ * @{
+ */
+
+/**
+ * @def RING_IS_POWER_OF_TWO
+ * @brief Check whether a size is a non-zero power of two
+ * @param[in] SIZE The size
+ */
+#define RING_IS_POWER_OF_TWO(SIZE) (((SIZE) != 0U) && (((SIZE) & ((SIZE) - 1U)) == 0U))
+
+/**
+ * @def RING_DEFINE
+ * @brief Define a ring buffer and its storage, the size is checked at compile time
+ * @param[in] NAME The name of the ring buffer
+ * @param[in] SIZE The number of the bytes of the storage (a power of two)
+ */
+#define RING_DEFINE(NAME, SIZE)                                                                \
+	STATIC_ASSERT(RING_IS_POWER_OF_TWO(SIZE), "The size of " #NAME " must be a power of two"); \
+	STATIC t_u8 NAME##Storage[SIZE];                                                           \
+	STATIC t_RING NAME = {NAME##Storage, (t_u32)(SIZE) - 1U, 0U, 0U, 0U, 0U}
+
+/**
+ * @struct t_RING
+ * @brief Ring Buffer
+ * @details This type is used to define a ring buffer, its members are private to the module
+ * @see RING_DEFINE RING_bInit
+ */
+typedef struct
+{
+	/**
+	 * @brief The storage of the bytes
+	 */
+	P2VAR(t_u8) pu8Buffer;
+	/**
+	 * @brief The size of the storage minus one
+	 */
+	t_u32 u32Mask;
+	/**
+	 * @brief The index of the next byte to reserve by the producers
+	 */
+	VOLATILE t_u32 u32Head;
+	/**
+	 * @brief The index of the first byte not yet visible to the consumer
+	 */
+	VOLATILE t_u32 u32Commit;
+	/**
+	 * @brief The index of the next byte to read by the consumer
+	 */
+	VOLATILE t_u32 u32Tail;
+	/**
+	 * @brief The number of the producers in the middle of a write (multi-producer path)
+	 */
+	VOLATILE t_u32 u32Writers;
+} t_RING;
+
+/**
+ * @brief This function initializes a ring buffer on a given storage
+ * @param[out] ptRing The ring buffer
+ * @param[in] pu8Buffer The storage
+ * @param[in] u32Size The number of the bytes of the storage (a power of two)
+ * @return TRUE if the ring buffer is initialized, FALSE if the size is not a power of two
+ */
+t_bool RING_bInit(P2VAR(t_RING) ptRing, P2VAR(t_u8) pu8Buffer, t_u32 u32Size);
+
+/**
+ * @brief This function empties a ring buffer
+ * @param[in,out] ptRing The ring buffer
+ * @warning The producers and the consumer must be idle
+ */
+void RING_vReset(P2VAR(t_RING) ptRing);
+
+/**
+ * @brief This function gets the number of the bytes that the consumer can read
+ * @param[in] ptRing The ring buffer
+ * @return The number of the bytes
+ */
+t_u32 RING_u32GetCount(P2CONST(t_RING) ptRing);
+
+/**
+ * @brief This function gets the number of the bytes that the producers can write
+ * @param[in] ptRing The ring buffer
+ * @return The number of the bytes
+ */
+t_u32 RING_u32GetFree(P2CONST(t_RING) ptRing);
+
+/**
+ * @brief This function writes as many bytes as the ring buffer can take (single producer)
+ * @param[in,out] ptRing The ring buffer
+ * @param[in] pu8Data The bytes
+ * @param[in] u32Length The number of the bytes
+ * @return The number of the written bytes
+ */
+t_u32 RING_u32Write(P2VAR(t_RING) ptRing, P2CONST(t_u8) pu8Data, t_u32 u32Length);
+
+/**
+ * @brief This function writes all the bytes or none of them (any number of producers)
+ * @details The bytes of one call stay together whatever the producers that interrupt it
+ * @param[in,out] ptRing The ring buffer
+ * @param[in] pu8Data The bytes
+ * @param[in] u32Length The number of the bytes
+ * @return TRUE if the bytes are written, FALSE if the ring buffer has no room for all of them
+ * @note This function can be called from any interrupt and task at the same time
+ */
+t_bool RING_bWriteMulti(P2VAR(t_RING) ptRing, P2CONST(t_u8) pu8Data, t_u32 u32Length);
+
+/**
+ * @brief This function reads as many bytes as available
+ * @param[in,out] ptRing The ring buffer
+ * @param[out] pu8Data The read bytes
+ * @param[in] u32Length The largest number of the bytes to read
+ * @return The number of the read bytes
+ */
+t_u32 RING_u32Read(P2VAR(t_RING) ptRing, P2VAR(t_u8) pu8Data, t_u32 u32Length);
+
+/**
+ * @brief This function gets the contiguous free room at the head of a ring buffer (single producer)
+ * @details The room can be filled in place (e.g. by a DMA transfer) and then handed to the consumer by RING_vCommitWrite()
+ * @param[in] ptRing The ring buffer
+ * @param[out] ppu8Span The start of the room
+ * @return The number of the bytes of the room, it stops at the end of the storage
+ */
+t_u32 RING_u32GetWriteSpan(P2VAR(t_RING) ptRing, P2VAR(P2VAR(t_u8)) ppu8Span);
+
+/**
+ * @brief This function hands the bytes written in a write span to the consumer
+ * @param[in,out] ptRing The ring buffer
+ * @param[in] u32Length The number of the written bytes (not more than the span)
+ */
+void RING_vCommitWrite(P2VAR(t_RING) ptRing, t_u32 u32Length);
+
+/**
+ * @brief This function gets the contiguous readable bytes at the tail of a ring buffer
+ * @details The bytes can be used in place (e.g. as the source of a DMA transfer) and then released by RING_vCommitRead()
+ * @param[in] ptRing The ring buffer
+ * @param[out] ppu8Span The start of the bytes
+ * @return The number of the bytes, it stops at the end of the storage
+ */
+t_u32 RING_u32GetReadSpan(P2VAR(t_RING) ptRing, P2VAR(P2VAR(t_u8)) ppu8Span);
+
+/**
+ * @brief This function gives the bytes of a read span back to the producers
+ * @param[in,out] ptRing The ring buffer
+ * @param[in] u32Length The number of the consumed bytes (not more than the span)
+ */
+void RING_vCommitRead(P2VAR(t_RING) ptRing, t_u32 u32Length);
+
+/** @} */
+/** @} */
+
+#endif /* _LSTD_RING_H_ */
@@ -0,0 +1,249 @@
+/**
+ * @file LSTD_TIMER.c
+ * @author Mohamed Alaa
+ * @brief This file contains the implementation of the software timers
+ * @version 1.0.0
+ * @date 2026-10-19
+ */
+
+#include "LSTD_TYPES.h"
+#include "LSTD_COMPILER.h"
+#include "LSTD_VALUES.h"
+#include "LSTD_CPU.h"
+#include "LSTD_TIMER.h"
+
+/**
+ * @brief The slots of the wheel, each one holds a list of the running timers
+ */
+STATIC P2VAR(t_TIMER) aptTIMERSlots[TIMER_WHEEL_LEVELS][TIMER_WHEEL_SLOTS];
+
+/**
+ * @brief The time of the wheel (the last processed tick)
+ */
+STATIC t_u32 u32TIMERNow = 0;
+
+/**
+ * @brief The number of the counted ticks
+ */
+STATIC VOLATILE t_u32 u32TIMERTicks = 0;
+
+/**
+ * @brief This function links a timer at the head of a list
+ * @param[in] pptHead The head of the list
+ * @param[in,out] ptTimer The timer
+ */
+STATIC void TIMER_vLink(P2VAR(P2VAR(t_TIMER)) pptHead, P2VAR(t_TIMER) ptTimer)
+{
+	ptTimer->ptNext = *pptHead;
+
+	if (*pptHead != NULL)
+	{
+		(*pptHead)->pptPrevious = &ptTimer->ptNext;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	*pptHead = ptTimer;
+	ptTimer->pptPrevious = pptHead;
+}
+
+/**
+ * @brief This function unlinks a timer from its list
+ * @param[in,out] ptTimer The timer
+ */
+STATIC void TIMER_vUnlink(P2VAR(t_TIMER) ptTimer)
+{
+	*ptTimer->pptPrevious = ptTimer->ptNext;
+
+	if (ptTimer->ptNext != NULL)
+	{
+		ptTimer->ptNext->pptPrevious = ptTimer->pptPrevious;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	ptTimer->pptPrevious = NULL;
+}
+
+/**
+ * @brief This function links a timer to the slot of its expiry
+ * @details The level is the first one that covers the remaining ticks, and the slot is the expiry seen at the resolution of
+ * this level. A timer beyond the range of the wheel is parked in the farthest slot and placed again when it gets there
+ * @param[in,out] ptTimer The timer
+ */
+STATIC void TIMER_vInsert(P2VAR(t_TIMER) ptTimer)
+{
+	t_u32 u32Expiry = ptTimer->u32Expiry;
+	t_u32 u32Remaining = u32Expiry - u32TIMERNow;
+	t_u8 u8Level = 0;
+
+	if (u32Remaining >= TIMER_WHEEL_RANGE)
+	{
+		u32Remaining = TIMER_WHEEL_RANGE - 1U;
+		u32Expiry = u32TIMERNow + u32Remaining;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	while ((u8Level < (TIMER_WHEEL_LEVELS - 1U)) && (u32Remaining >= ((t_u32)1U << (TIMER_WHEEL_SLOT_BITS * (u8Level + 1U)))))
+	{
+		u8Level++;
+	}
+
+	TIMER_vLink(&aptTIMERSlots[u8Level][(u32Expiry >> (TIMER_WHEEL_SLOT_BITS * u8Level)) & (TIMER_WHEEL_SLOTS - 1U)], ptTimer);
+}
+
+/**
+ * @brief This function moves the timers of a slot to the lower levels
+ * @param[in] u8Level The level of the slot
+ * @param[in] u8Slot The slot
+ */
+STATIC void TIMER_vCascade(t_u8 u8Level, t_u8 u8Slot)
+{
+	P2VAR(t_TIMER) ptTimer = NULL;
+
+	while (aptTIMERSlots[u8Level][u8Slot] != NULL)
+	{
+		ptTimer = aptTIMERSlots[u8Level][u8Slot];
+		TIMER_vUnlink(ptTimer);
+		TIMER_vInsert(ptTimer);
+	}
+}
+
+void TIMER_vInitTimer(P2VAR(t_TIMER) ptTimer, t_TIMER_Callback pfCallback)
+{
+	ptTimer->ptNext = NULL;
+	ptTimer->pptPrevious = NULL;
+	ptTimer->u32Expiry = 0U;
+	ptTimer->u32Period = 0U;
+	ptTimer->pfCallback = pfCallback;
+}
+
+void TIMER_vStart(P2VAR(t_TIMER) ptTimer, t_u32 u32Delay, t_u32 u32Period)
+{
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	if (ptTimer->pptPrevious != NULL)
+	{
+		TIMER_vUnlink(ptTimer);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* The slot of the current tick was already processed */
+	ptTimer->u32Expiry = u32TIMERNow + ((u32Delay != 0U) ? u32Delay : 1U);
+	ptTimer->u32Period = u32Period;
+	TIMER_vInsert(ptTimer);
+
+	CPU_vExitCritical(u32PRIMASK);
+}
+
+void TIMER_vStop(P2VAR(t_TIMER) ptTimer)
+{
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	if (ptTimer->pptPrevious != NULL)
+	{
+		TIMER_vUnlink(ptTimer);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+}
+
+t_bool TIMER_bIsRunning(P2CONST(t_TIMER) ptTimer)
+{
+	return (ptTimer->pptPrevious != NULL) ? TRUE : FALSE;
+}
+
+void TIMER_vTick(void)
+{
+	u32TIMERTicks++;
+}
+
+void TIMER_vProcess(void)
+{
+	P2VAR(t_TIMER) ptExpired = NULL;
+	P2VAR(t_TIMER) ptTimer = NULL;
+	t_u32 u32PRIMASK = 0;
+	t_u8 u8Level = 0;
+	t_u8 u8Slot = 0;
+
+	while (u32TIMERNow != u32TIMERTicks)
+	{
+		u32PRIMASK = CPU_u32EnterCritical();
+		u32TIMERNow++;
+
+		/* Each time a level wraps around, the next slot of the level above is moved down */
+		for (u8Level = 1U; (u8Level < TIMER_WHEEL_LEVELS) && ((u32TIMERNow & ((1U << (TIMER_WHEEL_SLOT_BITS * u8Level)) - 1U)) == 0U); u8Level++)
+		{
+			TIMER_vCascade(u8Level, (t_u8)((u32TIMERNow >> (TIMER_WHEEL_SLOT_BITS * u8Level)) & (TIMER_WHEEL_SLOTS - 1U)));
+		}
+
+		/* Move the expired timers to a local list so that the callbacks can start and stop any timer */
+		u8Slot = (t_u8)(u32TIMERNow & (TIMER_WHEEL_SLOTS - 1U));
+		ptExpired = NULL;
+
+		while (aptTIMERSlots[0][u8Slot] != NULL)
+		{
+			ptTimer = aptTIMERSlots[0][u8Slot];
+			TIMER_vUnlink(ptTimer);
+			TIMER_vLink(&ptExpired, ptTimer);
+		}
+
+		CPU_vExitCritical(u32PRIMASK);
+
+		do
+		{
+			u32PRIMASK = CPU_u32EnterCritical();
+			ptTimer = ptExpired;
+
+			if (ptTimer != NULL)
+			{
+				TIMER_vUnlink(ptTimer);
+
+				/* A periodic timer is placed again before its callback so that the callback can stop it */
+				if (ptTimer->u32Period != 0U)
+				{
+					ptTimer->u32Expiry += ptTimer->u32Period;
+					TIMER_vInsert(ptTimer);
+				}
+				else
+				{
+					/* Do nothing */
+				}
+			}
+			else
+			{
+				/* Do nothing */
+			}
+
+			CPU_vExitCritical(u32PRIMASK);
+
+			if (ptTimer != NULL)
+			{
+				ptTimer->pfCallback(ptTimer);
+			}
+			else
+			{
+				/* Do nothing */
+			}
+		} while (ptTimer != NULL);
+	}
+}
+
+t_u32 TIMER_u32GetTicks(void)
+{
+	return u32TIMERNow;
+}
@@ -0,0 +1,146 @@
+/**
+ * @file LSTD_TIMER.h
+ * @author Mohamed Alaa
+ * @brief This file contains the software timers (hierarchical timer wheel)
+ * @version 1.0.0
+ * @date 2026-10-19
+ */
+
+#ifndef _LSTD_TIMER_H_
+#define _LSTD_TIMER_H_
+
+#include "LSTD_TYPES.h"
+#include "LSTD_COMPILER.h"
+
+/**
+ * @addtogroup standard_library
+ * @{
+ */
+
+/**
+ * @defgroup software_timers Software timers
+ * @brief This module contains the software timers
+ * @details The running timers are kept in a hierarchical timer wheel: 4 levels of 64 slots, each level counting 64 times
+ * slower than the previous one. Starting and stopping a timer links or unlinks it from one slot, and each tick only visits
+ * the slot that expires (the timers of a farther level are moved down once every 64 ticks of the level below), so the cost
+ * does not depend on the number of the timers. The wheel takes 1 KB of RAM and each timer is owned by its user (20 bytes)
+ * @{
+ */
+
+/**
+ * @def TIMER_WHEEL_LEVELS
+ * @brief The number of the levels of the wheel
+ */
+#define TIMER_WHEEL_LEVELS (4U)
+
+/**
+ * @def TIMER_WHEEL_SLOT_BITS
+ * @brief The number of the bits of the tick count resolved by each level (64 slots)
+ */
+#define TIMER_WHEEL_SLOT_BITS (6U)
+
+/**
+ * @def TIMER_WHEEL_SLOTS
+ * @brief The number of the slots of each level
+ */
+#define TIMER_WHEEL_SLOTS (1U << TIMER_WHEEL_SLOT_BITS)
+
+/**
+ * @def TIMER_WHEEL_RANGE
+ * @brief The number of the ticks covered by the wheel, a longer timer goes around the last level again
+ */
+#define TIMER_WHEEL_RANGE ((t_u32)1U << (TIMER_WHEEL_SLOT_BITS * TIMER_WHEEL_LEVELS))
+
+/**
+ * @typedef t_TIMER_Callback
+ * @brief Timer Callback
+ * @details This type is used to define the function called when a timer expires, it gets the timer so that the timer
+ * can be embedded in a bigger structure of its user
+ */
+typedef struct t_TIMER_Tag t_TIMER;
+typedef P2FUNC(void, t_TIMER_Callback)(P2VAR(t_TIMER) ptTimer);
+
+/**
+ * @struct t_TIMER
+ * @brief Software Timer
+ * @details This type is used to define a timer, its members are private to the module
+ * @see TIMER_vInitTimer
+ */
+struct t_TIMER_Tag
+{
+	/**
+	 * @brief The next timer of the slot
+	 */
+	P2VAR(t_TIMER) ptNext;
+	/**
+	 * @brief The link that points to this timer (NULL if the timer is not running)
+	 */
+	P2VAR(P2VAR(t_TIMER)) pptPrevious;
+	/**
+	 * @brief The tick at which the timer expires
+	 */
+	t_u32 u32Expiry;
+	/**
+	 * @brief The number of the ticks between two expiries, 0 for a one-shot timer
+	 */
+	t_u32 u32Period;
+	/**
+	 * @brief The function called when the timer expires
+	 */
+	t_TIMER_Callback pfCallback;
+};
+
+/**
+ * @brief This function initializes a timer
+ * @param[out] ptTimer The timer
+ * @param[in] pfCallback The function called when the timer expires
+ */
+void TIMER_vInitTimer(P2VAR(t_TIMER) ptTimer, t_TIMER_Callback pfCallback);
+
+/**
+ * @brief This function starts a timer, or restarts it if it is running
+ * @param[in,out] ptTimer The timer
+ * @param[in] u32Delay The number of the ticks to the first expiry (at least 1)
+ * @param[in] u32Period The number of the ticks between the next expiries, 0 for a one-shot timer
+ * @note This function can be called from an interrupt and from a timer callback
+ */
+void TIMER_vStart(P2VAR(t_TIMER) ptTimer, t_u32 u32Delay, t_u32 u32Period);
+
+/**
+ * @brief This function stops a timer
+ * @param[in,out] ptTimer The timer
+ * @note This function can be called from an interrupt and from a timer callback
+ */
+void TIMER_vStop(P2VAR(t_TIMER) ptTimer);
+
+/**
+ * @brief This function checks whether a timer is running
+ * @param[in] ptTimer The timer
+ * @return TRUE if the timer is running, FALSE otherwise
+ */
+t_bool TIMER_bIsRunning(P2CONST(t_TIMER) ptTimer);
+
+/**
+ * @brief This function counts a tick
+ * @details This function only counts, it is meant to be called from the tick interrupt
+ * @see TIMER_vProcess
+ */
+void TIMER_vTick(void);
+
+/**
+ * @brief This function moves the wheel up to the counted ticks and calls the callbacks of the expired timers
+ * @details The callbacks run in the context of the caller, a low priority task (e.g. a SCHED task or the RTOS task of
+ * the lowest priority) keeps them away from the interrupts. Ticks counted while the caller was busy are caught up in order
+ */
+void TIMER_vProcess(void);
+
+/**
+ * @brief This function gets the time of the wheel
+ * @return The number of the processed ticks (wraps around after 2^32 ticks)
+ */
+t_u32 TIMER_u32GetTicks(void);
+
+/** @} */
+/** @} */
+
+#endif /* _LSTD_TIMER_H_ */
@@ -0,0 +1,43 @@
+/**
+ * @file ADC_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the ADC module.
+ * @details This file contains the configuration parameters for the ADC module.
+ * @date 2026-10-19
+ */
+
+#ifndef _ADC_CONFIG_H_
+#define _ADC_CONFIG_H_
+
+#include "ADC_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup adc_module
+ * @{
+ */
+
+/**
+ * @defgroup adc_config ADC Configuration
+ * @brief This group contains the configuration parameters of the ADC module
+ * @{
+ */
+
+/**
+ * @def ADC_DMA_IRQ_PRIORITY
+ * @brief This macro defines the NVIC priority of the ADC DMA interrupt
+ * @details This macro defines the NVIC priority of the ADC DMA interrupt (0 to 15), the callback must finish
+ * with the current half before the DMA fills the other one
+ */
+#define ADC_DMA_IRQ_PRIORITY (2)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _ADC_CONFIG_H_ */
@@ -0,0 +1,319 @@
+/**
+ * @file ADC_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the ADC module.
+ * @details This file contains the prototypes of the functions of the ADC module.
+ * @date 2026-10-19
+ */
+
+#ifndef _ADC_INTERFACE_H_
+#define _ADC_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup adc_module
+ * @{
+ */
+
+/**
+ * @typedef t_ADC_Peripherals
+ * @brief ADC Peripherals
+ * @details This type is used to select an ADC peripheral
+ */
+typedef enum
+{
+	/**
+	 * @brief ADC1 (the only one with a DMA request)
+	 */
+	ADC_Peripherals_ADC1 = 0,
+	/**
+	 * @brief ADC2
+	 */
+	ADC_Peripherals_ADC2
+} t_ADC_Peripherals;
+
+/**
+ * @typedef t_ADC_Channels
+ * @brief ADC Channels
+ * @details This type is used to select an ADC input channel
+ */
+typedef enum
+{
+	/**
+	 * @brief Channel 0 (PA0)
+	 */
+	ADC_Channels_0 = 0,
+	/**
+	 * @brief Channel 1 (PA1)
+	 */
+	ADC_Channels_1,
+	/**
+	 * @brief Channel 2 (PA2)
+	 */
+	ADC_Channels_2,
+	/**
+	 * @brief Channel 3 (PA3)
+	 */
+	ADC_Channels_3,
+	/**
+	 * @brief Channel 4 (PA4)
+	 */
+	ADC_Channels_4,
+	/**
+	 * @brief Channel 5 (PA5)
+	 */
+	ADC_Channels_5,
+	/**
+	 * @brief Channel 6 (PA6)
+	 */
+	ADC_Channels_6,
+	/**
+	 * @brief Channel 7 (PA7)
+	 */
+	ADC_Channels_7,
+	/**
+	 * @brief Channel 8 (PB0)
+	 */
+	ADC_Channels_8,
+	/**
+	 * @brief Channel 9 (PB1)
+	 */
+	ADC_Channels_9,
+	/**
+	 * @brief Channel 10 (not bonded on the 48-pin package)
+	 */
+	ADC_Channels_10,
+	/**
+	 * @brief Channel 11 (not bonded on the 48-pin package)
+	 */
+	ADC_Channels_11,
+	/**
+	 * @brief Channel 12 (not bonded on the 48-pin package)
+	 */
+	ADC_Channels_12,
+	/**
+	 * @brief Channel 13 (not bonded on the 48-pin package)
+	 */
+	ADC_Channels_13,
+	/**
+	 * @brief Channel 14 (not bonded on the 48-pin package)
+	 */
+	ADC_Channels_14,
+	/**
+	 * @brief Channel 15 (not bonded on the 48-pin package)
+	 */
+	ADC_Channels_15,
+	/**
+	 * @brief Channel 16 (internal temperature sensor, ADC1 only)
+	 */
+	ADC_Channels_TemperatureSensor,
+	/**
+	 * @brief Channel 17 (internal reference voltage, ADC1 only)
+	 */
+	ADC_Channels_VREFINT
+} t_ADC_Channels;
+
+/**
+ * @typedef t_ADC_SampleTime
+ * @brief ADC Sample Time
+ * @details This type is used to select the sampling time of a channel, the conversion time is the sample time plus 12.5 cycles
+ */
+typedef enum
+{
+	/**
+	 * @brief 1.5 ADC clock cycles
+	 */
+	ADC_SampleTime_1_5Cycles = 0,
+	/**
+	 * @brief 7.5 ADC clock cycles
+	 */
+	ADC_SampleTime_7_5Cycles,
+	/**
+	 * @brief 13.5 ADC clock cycles
+	 */
+	ADC_SampleTime_13_5Cycles,
+	/**
+	 * @brief 28.5 ADC clock cycles
+	 */
+	ADC_SampleTime_28_5Cycles,
+	/**
+	 * @brief 41.5 ADC clock cycles
+	 */
+	ADC_SampleTime_41_5Cycles,
+	/**
+	 * @brief 55.5 ADC clock cycles
+	 */
+	ADC_SampleTime_55_5Cycles,
+	/**
+	 * @brief 71.5 ADC clock cycles
+	 */
+	ADC_SampleTime_71_5Cycles,
+	/**
+	 * @brief 239.5 ADC clock cycles
+	 */
+	ADC_SampleTime_239_5Cycles
+} t_ADC_SampleTime;
+
+/**
+ * @typedef t_ADC_Trigger
+ * @brief ADC Regular Group Trigger
+ * @details This type is used to select the event that starts the conversion of the whole regular sequence
+ */
+typedef enum
+{
+	/**
+	 * @brief Timer 1 capture/compare 1 event
+	 */
+	ADC_Trigger_TIM1_CC1 = 0,
+	/**
+	 * @brief Timer 1 capture/compare 2 event
+	 */
+	ADC_Trigger_TIM1_CC2,
+	/**
+	 * @brief Timer 1 capture/compare 3 event
+	 */
+	ADC_Trigger_TIM1_CC3,
+	/**
+	 * @brief Timer 2 capture/compare 2 event
+	 */
+	ADC_Trigger_TIM2_CC2,
+	/**
+	 * @brief Timer 3 trigger output (e.g. its update event, sets the sampling rate)
+	 */
+	ADC_Trigger_TIM3_TRGO,
+	/**
+	 * @brief Timer 4 capture/compare 4 event
+	 */
+	ADC_Trigger_TIM4_CC4,
+	/**
+	 * @brief EXTI line 11
+	 */
+	ADC_Trigger_EXTI11,
+	/**
+	 * @brief Software start, the conversions run back-to-back in continuous mode
+	 */
+	ADC_Trigger_Software
+} t_ADC_Trigger;
+
+/**
+ * @typedef t_ADC_Callback
+ * @brief ADC DMA Callback
+ * @details This type is used to define the function that gets each filled half of the ping-pong buffer,
+ * the samples are in sequence order (rank 1 to N, repeated). The DMA fills the other half meanwhile
+ */
+typedef P2FUNC(void, t_ADC_Callback)(P2CONST(t_u16) pu16Samples, t_u16 u16Count);
+
+/**
+ * @typedef t_ADC_DualCallback
+ * @brief ADC Dual Mode DMA Callback
+ * @details This type is used to define the function that gets each filled half of the dual mode ping-pong buffer,
+ * each 32-bit sample holds the ADC1 result in bits 0 to 15 and the ADC2 result of the same rank in bits 16 to 31
+ * @see ADC_DUAL_SAMPLE_ADC1 ADC_DUAL_SAMPLE_ADC2
+ */
+typedef P2FUNC(void, t_ADC_DualCallback)(P2CONST(t_u32) pu32Samples, t_u16 u16Count);
+
+/**
+ * @def ADC_DUAL_SAMPLE_ADC1(SAMPLE)
+ * @brief Get the ADC1 result of a dual mode sample
+ * @param[in] SAMPLE The 32-bit dual mode sample
+ */
+#define ADC_DUAL_SAMPLE_ADC1(SAMPLE) ((t_u16)((SAMPLE) & 0xFFFFU))
+
+/**
+ * @def ADC_DUAL_SAMPLE_ADC2(SAMPLE)
+ * @brief Get the ADC2 result of a dual mode sample
+ * @param[in] SAMPLE The 32-bit dual mode sample
+ */
+#define ADC_DUAL_SAMPLE_ADC2(SAMPLE) ((t_u16)((SAMPLE) >> 16))
+
+/**
+ * @brief This function initializes an ADC peripheral
+ * @details This function powers on and calibrates the ADC
+ * @param[in] tADC The ADC peripheral
+ * @note The ADC clock must be enabled and must not exceed 14 MHz (see RCC_ADC_PRESCALER)
+ * @see t_ADC_Peripherals
+ */
+void ADC_vInit(t_ADC_Peripherals tADC);
+
+/**
+ * @brief This function sets the sample time of a channel
+ * @details This function sets the sample time of a channel, it applies to every rank that converts the channel
+ * @param[in] tADC The ADC peripheral
+ * @param[in] tChannel The channel
+ * @param[in] tSampleTime The sample time
+ * @see t_ADC_Peripherals t_ADC_Channels t_ADC_SampleTime
+ */
+void ADC_vSetSampleTime(t_ADC_Peripherals tADC, t_ADC_Channels tChannel, t_ADC_SampleTime tSampleTime);
+
+/**
+ * @brief This function sets the regular sequence of an ADC peripheral
+ * @details This function programs the channels converted on each trigger (a channel can appear in several ranks)
+ * and configures their GPIO pins as analog inputs
+ * @param[in] tADC The ADC peripheral
+ * @param[in] ptChannels The channels in conversion order
+ * @param[in] u8Count The number of the channels (1 to 16)
+ * @note The clocks of the GPIO ports of the channels must be enabled
+ * @see t_ADC_Peripherals t_ADC_Channels
+ */
+void ADC_vSetSequence(t_ADC_Peripherals tADC, P2CONST(t_ADC_Channels) ptChannels, t_u8 u8Count);
+
+/**
+ * @brief This function converts a single channel
+ * @details This function converts a single channel using a software start and waits for the result
+ * @param[in] tADC The ADC peripheral (must not be sampling using DMA)
+ * @param[in] tChannel The channel
+ * @return The 12-bit conversion result
+ * @note This function replaces the regular sequence of the peripheral
+ * @see t_ADC_Peripherals t_ADC_Channels
+ */
+t_u16 ADC_u16ReadChannel(t_ADC_Peripherals tADC, t_ADC_Channels tChannel);
+
+/**
+ * @brief This function starts sampling the regular sequence of ADC1 into a ping-pong buffer
+ * @details Every trigger converts the whole sequence, the DMA writes the results in circular mode and the callback
+ * gets each half of the buffer once it is full. No conversion is handled by the CPU
+ * @param[in] tTrigger The trigger of the sequence
+ * @param[in] pu16Buffer The ping-pong buffer, it holds 2 * u16HalfCount samples
+ * @param[in] u16HalfCount The number of samples of each half, a multiple of the sequence length (1 to 32767)
+ * @param[in] pfCallback The function that gets the filled halves
+ * @return TRUE if sampling is started, FALSE if the count or the callback is invalid or the ADC1 DMA channel is owned by another driver
+ * @note The DMA1 clock must be enabled using RCC_vEnablePeripheralAHB(RCC_AHBPeripherals_DMA1)
+ * @see t_ADC_Trigger t_ADC_Callback ADC_vSetSequence
+ */
+t_bool ADC_bStartSampling(t_ADC_Trigger tTrigger, P2VAR(t_u16) pu16Buffer, t_u16 u16HalfCount, t_ADC_Callback pfCallback);
+
+/**
+ * @brief This function starts sampling ADC1 and ADC2 simultaneously into a ping-pong buffer
+ * @details Every trigger converts rank N of both regular sequences at the same time (regular simultaneous mode),
+ * the DMA packs each pair into one 32-bit word read from the ADC1 data register, which doubles the throughput
+ * of a single ADC without any CPU work per conversion
+ * @param[in] tTrigger The trigger of the sequences (applied to ADC1, ADC2 follows it)
+ * @param[in] pu32Buffer The ping-pong buffer, it holds 2 * u16HalfCount pairs
+ * @param[in] u16HalfCount The number of pairs of each half, a multiple of the sequence length (1 to 32767)
+ * @param[in] pfCallback The function that gets the filled halves
+ * @return TRUE if sampling is started, FALSE if the sequences lengths differ, the count or the callback is invalid
+ * or the ADC1 DMA channel is owned by another driver
+ * @note Both ADCs must be initialized and their sequences set with the same length, a channel must not be converted
+ * by both ADCs in the same rank. The DMA1 clock must be enabled
+ * @see t_ADC_Trigger t_ADC_DualCallback ADC_vSetSequence ADC_vStopSampling
+ */
+t_bool ADC_bStartDualSampling(t_ADC_Trigger tTrigger, P2VAR(t_u32) pu32Buffer, t_u16 u16HalfCount, t_ADC_DualCallback pfCallback);
+
+/**
+ * @brief This function stops the DMA sampling
+ * @details This function stops the conversions, returns to the independent mode and releases the ADC1 DMA channel
+ */
+void ADC_vStopSampling(void);
+
+/** @} */
+/** @} */
+
+#endif /* _ADC_INTERFACE_H_ */
@@ -0,0 +1,306 @@
+/**
+ * @file ADC_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the ADC module.
+ * @details This file contains the private macros and registers for the ADC module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/ADC
+ * @brief ADC Module
+ * @details This module contains all the APIs related to the ADC peripherals
+ */
+
+#ifndef _ADC_PRIVATE_H_
+#define _ADC_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup adc_module ADC Module
+ * @brief ADC Module
+ * @details This module contains all the APIs related to the ADC peripherals
+ * @{
+ */
+
+/**
+ * @defgroup adc_registers ADC Registers
+ * @brief ADC Registers
+ * @{
+ */
+
+/**
+ * @struct t_ADC_RegisterMap
+ * @brief ADC Register Map
+ * @details This type is used to access the registers of one ADC peripheral
+ */
+typedef struct
+{
+	/**
+	 * @brief Status Register
+	 */
+	t_u32 SR;
+	/**
+	 * @brief Control Register 1
+	 */
+	t_u32 CR1;
+	/**
+	 * @brief Control Register 2
+	 */
+	t_u32 CR2;
+	/**
+	 * @brief Sample Time Register 1 (channels 10 to 17)
+	 */
+	t_u32 SMPR1;
+	/**
+	 * @brief Sample Time Register 2 (channels 0 to 9)
+	 */
+	t_u32 SMPR2;
+	/**
+	 * @brief Injected Channel Data Offset Registers
+	 */
+	t_u32 JOFR[4];
+	/**
+	 * @brief Watchdog High Threshold Register
+	 */
+	t_u32 HTR;
+	/**
+	 * @brief Watchdog Low Threshold Register
+	 */
+	t_u32 LTR;
+	/**
+	 * @brief Regular Sequence Register 1 (ranks 13 to 16 and sequence length)
+	 */
+	t_u32 SQR1;
+	/**
+	 * @brief Regular Sequence Register 2 (ranks 7 to 12)
+	 */
+	t_u32 SQR2;
+	/**
+	 * @brief Regular Sequence Register 3 (ranks 1 to 6)
+	 */
+	t_u32 SQR3;
+	/**
+	 * @brief Injected Sequence Register
+	 */
+	t_u32 JSQR;
+	/**
+	 * @brief Injected Data Registers
+	 */
+	t_u32 JDR[4];
+	/**
+	 * @brief Regular Data Register
+	 */
+	t_u32 DR;
+} t_ADC_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup adc_addresses ADC Addresses
+ * @brief ADC Addresses
+ * @details This module contains the addresses of the ADC registers
+ * @{
+ */
+
+/**
+ * @def ADC1_BASE_ADDRESS
+ * @brief ADC1 Base Address in the memory
+ */
+#define ADC1_BASE_ADDRESS REGISTER_ADDRESS(0x40012400, 0)
+
+/**
+ * @def ADC2_BASE_ADDRESS
+ * @brief ADC2 Base Address in the memory
+ */
+#define ADC2_BASE_ADDRESS REGISTER_ADDRESS(0x40012800, 0)
+
+/**
+ * @def ADC1
+ * @brief ADC1 Register Map
+ */
+#define ADC1 REGISTER(t_ADC_RegisterMap, ADC1_BASE_ADDRESS)
+
+/**
+ * @def ADC2
+ * @brief ADC2 Register Map
+ */
+#define ADC2 REGISTER(t_ADC_RegisterMap, ADC2_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup adc_constants ADC Constants
+ * @brief ADC Constants
+ * @{
+ */
+
+/**
+ * @def ADC_PERIPHERALS_COUNT
+ * @brief Number of the ADC peripherals
+ */
+#define ADC_PERIPHERALS_COUNT (2)
+
+/**
+ * @def ADC_GPIO_CHANNELS_COUNT
+ * @brief Number of the channels connected to GPIO pins (IN0 to IN9)
+ */
+#define ADC_GPIO_CHANNELS_COUNT (10)
+
+/**
+ * @def ADC_SEQUENCE_MAX_LENGTH
+ * @brief Maximum number of the conversions of a regular sequence
+ */
+#define ADC_SEQUENCE_MAX_LENGTH (16)
+
+/**
+ * @def ADC_CR1_SCAN
+ * @brief Scan mode bit
+ */
+#define ADC_CR1_SCAN (8)
+
+/**
+ * @def ADC_CR1_DUALMOD
+ * @brief Position of the dual mode selection field (ADC1 only)
+ */
+#define ADC_CR1_DUALMOD (16)
+
+/**
+ * @def ADC_CR1_DUALMOD_MASK
+ * @brief Mask of the dual mode selection field
+ */
+#define ADC_CR1_DUALMOD_MASK ((t_u32)0xFU << ADC_CR1_DUALMOD)
+
+/**
+ * @def ADC_DUALMOD_INDEPENDENT
+ * @brief Dual mode field value of the independent mode
+ */
+#define ADC_DUALMOD_INDEPENDENT (0x0U)
+
+/**
+ * @def ADC_DUALMOD_REGULAR_SIMULTANEOUS
+ * @brief Dual mode field value of the regular simultaneous mode
+ */
+#define ADC_DUALMOD_REGULAR_SIMULTANEOUS (0x6U)
+
+/**
+ * @def ADC_CR2_ADON
+ * @brief A/D converter on bit
+ */
+#define ADC_CR2_ADON (0)
+
+/**
+ * @def ADC_CR2_CONT
+ * @brief Continuous conversion bit
+ */
+#define ADC_CR2_CONT (1)
+
+/**
+ * @def ADC_CR2_CAL
+ * @brief Calibration bit (cleared by hardware at the end of the calibration)
+ */
+#define ADC_CR2_CAL (2)
+
+/**
+ * @def ADC_CR2_RSTCAL
+ * @brief Reset calibration bit (cleared by hardware when the calibration registers are reset)
+ */
+#define ADC_CR2_RSTCAL (3)
+
+/**
+ * @def ADC_CR2_DMA
+ * @brief Direct memory access mode bit
+ */
+#define ADC_CR2_DMA (8)
+
+/**
+ * @def ADC_CR2_EXTSEL
+ * @brief Position of the regular group external event selection field
+ */
+#define ADC_CR2_EXTSEL (17)
+
+/**
+ * @def ADC_CR2_EXTTRIG
+ * @brief Regular group external trigger enable bit
+ */
+#define ADC_CR2_EXTTRIG (20)
+
+/**
+ * @def ADC_CR2_SWSTART
+ * @brief Regular group software start bit
+ */
+#define ADC_CR2_SWSTART (22)
+
+/**
+ * @def ADC_CR2_TSVREFE
+ * @brief Temperature sensor and internal reference enable bit
+ */
+#define ADC_CR2_TSVREFE (23)
+
+/**
+ * @def ADC_SR_EOC
+ * @brief End of conversion flag
+ */
+#define ADC_SR_EOC (1)
+
+/**
+ * @def ADC_SMPR_FIELD_WIDTH
+ * @brief Width of the sample time field of each channel
+ */
+#define ADC_SMPR_FIELD_WIDTH (3)
+
+/**
+ * @def ADC_SMPR2_CHANNELS
+ * @brief Number of the channels in SMPR2
+ */
+#define ADC_SMPR2_CHANNELS (10)
+
+/**
+ * @def ADC_SQR_FIELD_WIDTH
+ * @brief Width of the channel field of each rank
+ */
+#define ADC_SQR_FIELD_WIDTH (5)
+
+/**
+ * @def ADC_SQR_RANKS_PER_REGISTER
+ * @brief Number of the ranks in SQR2 and SQR3
+ */
+#define ADC_SQR_RANKS_PER_REGISTER (6)
+
+/**
+ * @def ADC_SQR1_L
+ * @brief Position of the regular sequence length field
+ */
+#define ADC_SQR1_L (20)
+
+/**
+ * @def ADC_SQR1_L_MASK
+ * @brief Mask of the regular sequence length field
+ */
+#define ADC_SQR1_L_MASK ((t_u32)0xFU << ADC_SQR1_L)
+
+/**
+ * @def ADC_STABILIZATION_LOOPS
+ * @brief Busy loops covering the power-up time (1 us) and 2 ADC clock cycles before the calibration
+ */
+#define ADC_STABILIZATION_LOOPS (100)
+
+/**
+ * @def ADC_DMA_MAX_HALF_COUNT
+ * @brief The largest half of a ping-pong buffer, both halves must fit in the 16-bit DMA counter
+ */
+#define ADC_DMA_MAX_HALF_COUNT (32767U)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _ADC_PRIVATE_H_ */
@@ -0,0 +1,355 @@
+/**
+ * @file ADC_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the ADC module.
+ * @details This file contains the implementation for the ADC module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../GPIO/GPIO_interface.h"
+#include "../DMA/DMA_interface.h"
+#include "ADC_private.h"
+#include "ADC_interface.h"
+#include "ADC_config.h"
+
+/**
+ * @brief The register maps of the ADC peripherals
+ */
+STATIC P2VAR(VOLATILE t_ADC_RegisterMap) CONST aptADCs[ADC_PERIPHERALS_COUNT] = {&ADC1, &ADC2};
+
+/**
+ * @brief The ping-pong buffer of the DMA sampling
+ */
+STATIC P2VAR(t_u16) pu16ADCBuffer = NULL;
+
+/**
+ * @brief The ping-pong buffer of the dual mode DMA sampling
+ */
+STATIC P2VAR(t_u32) pu32ADCDualBuffer = NULL;
+
+/**
+ * @brief The number of samples of each half of the ping-pong buffer
+ */
+STATIC t_u16 u16ADCHalfCount = 0;
+
+/**
+ * @brief The callback that gets the filled halves
+ */
+STATIC t_ADC_Callback pfADCCallback = NULL;
+
+/**
+ * @brief The callback that gets the filled halves in dual mode
+ */
+STATIC t_ADC_DualCallback pfADCDualCallback = NULL;
+
+/**
+ * @brief This function configures the GPIO pin of a channel as an analog input
+ * @details Channels 0 to 7 are PA0 to PA7, channels 8 and 9 are PB0 and PB1, the other channels have no pin
+ * @param[in] tChannel The channel
+ */
+STATIC void ADC_vSetChannelPin(t_ADC_Channels tChannel)
+{
+	if (tChannel <= ADC_Channels_7)
+	{
+		GPIO_vSetPinDirection(GPIO_Ports_A, (t_GPIO_Pins)tChannel, GPIO_Direction_Input);
+		GPIO_vSetPinInputType(GPIO_Ports_A, (t_GPIO_Pins)tChannel, GPIO_Input_Type_Analog);
+	}
+	else if (tChannel < ADC_GPIO_CHANNELS_COUNT)
+	{
+		GPIO_vSetPinDirection(GPIO_Ports_B, (t_GPIO_Pins)(tChannel - ADC_Channels_8), GPIO_Direction_Input);
+		GPIO_vSetPinInputType(GPIO_Ports_B, (t_GPIO_Pins)(tChannel - ADC_Channels_8), GPIO_Input_Type_Analog);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function serves the DMA events of the ADC1 channel
+ * @details The half transfer event reports the first half, the transfer complete event reports the second half
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void ADC_vDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent)
+{
+	/* The handler only serves the ADC1 channel */
+	(void)tChannel;
+
+	if (tEvent == DMA_Events_HalfTransfer)
+	{
+		pfADCCallback(pu16ADCBuffer, u16ADCHalfCount);
+	}
+	else if (tEvent == DMA_Events_TransferComplete)
+	{
+		pfADCCallback(&pu16ADCBuffer[u16ADCHalfCount], u16ADCHalfCount);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function serves the DMA events of the ADC1 channel in dual mode
+ * @details The half transfer event reports the first half, the transfer complete event reports the second half
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void ADC_vDualDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent)
+{
+	/* The handler only serves the ADC1 channel */
+	(void)tChannel;
+
+	if (tEvent == DMA_Events_HalfTransfer)
+	{
+		pfADCDualCallback(pu32ADCDualBuffer, u16ADCHalfCount);
+	}
+	else if (tEvent == DMA_Events_TransferComplete)
+	{
+		pfADCDualCallback(&pu32ADCDualBuffer[u16ADCHalfCount], u16ADCHalfCount);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function starts the circular DMA transfer from the ADC1 data register
+ * @param[in] u32MemoryAddress The address of the ping-pong buffer
+ * @param[in] u16HalfCount The number of samples of each half (1 to ADC_DMA_MAX_HALF_COUNT)
+ * @param[in] tSize The size of each sample (16-bit results, or 32-bit pairs in dual mode)
+ * @param[in] pfHandler The handler of the half transfer and transfer complete events
+ * @note The ADC1 DMA channel must be allocated
+ */
+STATIC void ADC_vStartDMA(t_u32 u32MemoryAddress, t_u16 u16HalfCount, t_DMA_Size tSize, t_DMA_Callback pfHandler)
+{
+	t_DMA_ChannelConfig tDMAConfig;
+
+	tDMAConfig.u32PeripheralAddress = (t_u32)&ADC1.DR;
+	tDMAConfig.u32MemoryAddress = u32MemoryAddress;
+	tDMAConfig.u16Count = 2U * u16HalfCount;
+	tDMAConfig.tDirection = DMA_Direction_PeripheralToMemory;
+	tDMAConfig.tPeripheralSize = tSize;
+	tDMAConfig.tMemorySize = tSize;
+	tDMAConfig.bPeripheralIncrement = FALSE;
+	tDMAConfig.bMemoryIncrement = TRUE;
+	tDMAConfig.bCircular = TRUE;
+	tDMAConfig.tPriority = DMA_Priority_VeryHigh;
+	tDMAConfig.u8Events = DMA_Events_HalfTransfer | DMA_Events_TransferComplete;
+	tDMAConfig.pfCallback = pfHandler;
+	DMA_vConfigureChannel(DMA_CHANNEL_ADC1, &tDMAConfig);
+	DMA_vSetChannelPriority(DMA_CHANNEL_ADC1, ADC_DMA_IRQ_PRIORITY);
+	DMA_vStartChannel(DMA_CHANNEL_ADC1);
+}
+
+/**
+ * @brief This function enables the DMA requests and the trigger of an ADC
+ * @details The software trigger runs the sequence back-to-back in continuous mode and is started right away
+ * @param[in] ptADC The ADC peripheral
+ * @param[in] tTrigger The trigger of the sequence
+ */
+STATIC void ADC_vStartConversions(P2VAR(VOLATILE t_ADC_RegisterMap) ptADC, t_ADC_Trigger tTrigger)
+{
+	/* Keep the ADC on, changing other bits in the same write does not start a conversion */
+	t_u32 u32CR2 = (ptADC->CR2 & ((t_u32)1 << ADC_CR2_TSVREFE)) | ((t_u32)1 << ADC_CR2_ADON) | ((t_u32)1 << ADC_CR2_DMA);
+
+	u32CR2 |= ((t_u32)tTrigger << ADC_CR2_EXTSEL) | ((t_u32)1 << ADC_CR2_EXTTRIG);
+
+	if (tTrigger == ADC_Trigger_Software)
+	{
+		/* Free running: the sequence restarts as soon as it ends */
+		SET_BIT(u32CR2, ADC_CR2_CONT);
+		ptADC->CR2 = u32CR2;
+		SET_BIT(ptADC->CR2, ADC_CR2_SWSTART);
+	}
+	else
+	{
+		ptADC->CR2 = u32CR2;
+	}
+}
+
+void ADC_vInit(t_ADC_Peripherals tADC)
+{
+	P2VAR(VOLATILE t_ADC_RegisterMap) ptADC = aptADCs[tADC];
+	VOLATILE t_u32 u32Loops = ADC_STABILIZATION_LOOPS;
+
+	ptADC->CR1 = 0U;
+	ptADC->CR2 = 0U;
+
+	/* Power on the ADC (the internal channels are only enabled on ADC1) */
+	ptADC->CR2 = ((t_u32)1 << ADC_CR2_ADON) | ((tADC == ADC_Peripherals_ADC1) ? ((t_u32)1 << ADC_CR2_TSVREFE) : 0U);
+
+	/* Wait for the power-up time before the calibration */
+	while (u32Loops != 0U)
+	{
+		u32Loops--;
+	}
+
+	SET_BIT(ptADC->CR2, ADC_CR2_RSTCAL);
+
+	while (GET_BIT(ptADC->CR2, ADC_CR2_RSTCAL) != 0)
+		;
+
+	SET_BIT(ptADC->CR2, ADC_CR2_CAL);
+
+	while (GET_BIT(ptADC->CR2, ADC_CR2_CAL) != 0)
+		;
+}
+
+void ADC_vSetSampleTime(t_ADC_Peripherals tADC, t_ADC_Channels tChannel, t_ADC_SampleTime tSampleTime)
+{
+	P2VAR(VOLATILE t_ADC_RegisterMap) ptADC = aptADCs[tADC];
+	P2VAR(VOLATILE t_u32) pu32SMPR = (tChannel < ADC_SMPR2_CHANNELS) ? &ptADC->SMPR2 : &ptADC->SMPR1;
+	t_u8 u8Shift = (t_u8)(((tChannel < ADC_SMPR2_CHANNELS) ? tChannel : (tChannel - ADC_SMPR2_CHANNELS)) * ADC_SMPR_FIELD_WIDTH);
+
+	*pu32SMPR = (*pu32SMPR & ~((t_u32)0x7U << u8Shift)) | ((t_u32)tSampleTime << u8Shift);
+}
+
+void ADC_vSetSequence(t_ADC_Peripherals tADC, P2CONST(t_ADC_Channels) ptChannels, t_u8 u8Count)
+{
+	P2VAR(VOLATILE t_ADC_RegisterMap) ptADC = aptADCs[tADC];
+	/* Store the new values of the sequence registers (SQR3, SQR2 then SQR1) */
+	t_u32 au32SQR[3] = {0U, 0U, 0U};
+	t_u8 u8Rank = 0;
+
+	if (u8Count > ADC_SEQUENCE_MAX_LENGTH)
+	{
+		u8Count = ADC_SEQUENCE_MAX_LENGTH;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	for (u8Rank = 0; u8Rank < u8Count; u8Rank++)
+	{
+		au32SQR[u8Rank / ADC_SQR_RANKS_PER_REGISTER] |= (t_u32)ptChannels[u8Rank] << ((u8Rank % ADC_SQR_RANKS_PER_REGISTER) * ADC_SQR_FIELD_WIDTH);
+		ADC_vSetChannelPin(ptChannels[u8Rank]);
+	}
+
+	ptADC->SQR3 = au32SQR[0];
+	ptADC->SQR2 = au32SQR[1];
+	ptADC->SQR1 = au32SQR[2] | ((t_u32)(u8Count - 1U) << ADC_SQR1_L);
+
+	/* More than one conversion per trigger needs the scan mode */
+	if (u8Count > 1U)
+	{
+		SET_BIT(ptADC->CR1, ADC_CR1_SCAN);
+	}
+	else
+	{
+		ptADC->CR1 &= ~((t_u32)1U << ADC_CR1_SCAN);
+	}
+}
+
+t_u16 ADC_u16ReadChannel(t_ADC_Peripherals tADC, t_ADC_Channels tChannel)
+{
+	P2VAR(VOLATILE t_ADC_RegisterMap) ptADC = aptADCs[tADC];
+	/* Single conversion started by software */
+	t_u32 u32CR2 = (ptADC->CR2 & ~(((t_u32)1 << ADC_CR2_CONT) | ((t_u32)1 << ADC_CR2_DMA) | ((t_u32)0x7U << ADC_CR2_EXTSEL))) | ((t_u32)ADC_Trigger_Software << ADC_CR2_EXTSEL) | ((t_u32)1 << ADC_CR2_EXTTRIG);
+
+	ADC_vSetSequence(tADC, &tChannel, 1U);
+
+	/* Rewriting ADON alone starts a conversion, only write CR2 when another bit changes */
+	if (u32CR2 != ptADC->CR2)
+	{
+		ptADC->CR2 = u32CR2;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	SET_BIT(ptADC->CR2, ADC_CR2_SWSTART);
+
+	while (GET_BIT(ptADC->SR, ADC_SR_EOC) == 0)
+		;
+
+	/* Reading DR clears EOC */
+	return (t_u16)ptADC->DR;
+}
+
+t_bool ADC_bStartSampling(t_ADC_Trigger tTrigger, P2VAR(t_u16) pu16Buffer, t_u16 u16HalfCount, t_ADC_Callback pfCallback)
+{
+	t_bool bStatus = FALSE;
+
+	/* Both halves must fit in the DMA counter, an empty half would never raise an event */
+	if ((u16HalfCount != 0U) && (u16HalfCount <= ADC_DMA_MAX_HALF_COUNT) && (pfCallback != NULL))
+	{
+		bStatus = DMA_bAllocateChannel(DMA_CHANNEL_ADC1, (P2CONST(void))&ADC1);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == TRUE)
+	{
+		pu16ADCBuffer = pu16Buffer;
+		u16ADCHalfCount = u16HalfCount;
+		pfADCCallback = pfCallback;
+
+		ADC_vStartDMA((t_u32)pu16Buffer, u16HalfCount, DMA_Size_16Bits, ADC_vDMAEventHandler);
+		ADC_vStartConversions(&ADC1, tTrigger);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+t_bool ADC_bStartDualSampling(t_ADC_Trigger tTrigger, P2VAR(t_u32) pu32Buffer, t_u16 u16HalfCount, t_ADC_DualCallback pfCallback)
+{
+	t_bool bStatus = FALSE;
+
+	/* Both sequences must have the same length, otherwise the pairs drift apart */
+	if (((ADC1.SQR1 & ADC_SQR1_L_MASK) == (ADC2.SQR1 & ADC_SQR1_L_MASK)) && (u16HalfCount != 0U) && (u16HalfCount <= ADC_DMA_MAX_HALF_COUNT) && (pfCallback != NULL))
+	{
+		bStatus = DMA_bAllocateChannel(DMA_CHANNEL_ADC1, (P2CONST(void))&ADC1);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == TRUE)
+	{
+		pu32ADCDualBuffer = pu32Buffer;
+		u16ADCHalfCount = u16HalfCount;
+		pfADCDualCallback = pfCallback;
+
+		/* ADC1 is the master, its DR holds the ADC1 result in the lower half and the ADC2 result in the upper half */
+		ADC1.CR1 = (ADC1.CR1 & ~ADC_CR1_DUALMOD_MASK) | ((t_u32)ADC_DUALMOD_REGULAR_SIMULTANEOUS << ADC_CR1_DUALMOD);
+
+		ADC_vStartDMA((t_u32)pu32Buffer, u16HalfCount, DMA_Size_32Bits, ADC_vDualDMAEventHandler);
+
+		/* The slave must select the software trigger, its conversions are started by the master */
+		ADC2.CR2 = (ADC2.CR2 & ((t_u32)1 << ADC_CR2_ADON)) | ((t_u32)ADC_Trigger_Software << ADC_CR2_EXTSEL) | ((t_u32)1 << ADC_CR2_EXTTRIG) | ((tTrigger == ADC_Trigger_Software) ? ((t_u32)1 << ADC_CR2_CONT) : 0U);
+		ADC_vStartConversions(&ADC1, tTrigger);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void ADC_vStopSampling(void)
+{
+	/* Stop the triggers and the continuous mode before the DMA */
+	ADC1.CR2 &= ~(((t_u32)1 << ADC_CR2_CONT) | ((t_u32)1 << ADC_CR2_EXTTRIG) | ((t_u32)1 << ADC_CR2_DMA));
+	ADC2.CR2 &= ~(((t_u32)1 << ADC_CR2_CONT) | ((t_u32)1 << ADC_CR2_EXTTRIG));
+	/* Return to the independent mode */
+	ADC1.CR1 = (ADC1.CR1 & ~ADC_CR1_DUALMOD_MASK) | ((t_u32)ADC_DUALMOD_INDEPENDENT << ADC_CR1_DUALMOD);
+	DMA_vReleaseChannel(DMA_CHANNEL_ADC1);
+}
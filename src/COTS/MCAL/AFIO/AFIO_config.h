@@ -0,0 +1,15 @@
+/**
+ * @file AFIO_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the AFIO module.
+ * @details This file contains the configuration parameters for the AFIO module.
+ * @date 2026-10-19
+ */
+
+#ifndef _AFIO_CONFIG_H_
+#define _AFIO_CONFIG_H_
+
+#include "AFIO_interface.h"
+
+#endif /* _AFIO_CONFIG_H_ */
@@ -0,0 +1,38 @@
+/**
+ * @file AFIO_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the AFIO module.
+ * @details This file contains the prototypes of the functions of the AFIO module.
+ * @date 2026-10-19
+ */
+
+#ifndef _AFIO_INTERFACE_H_
+#define _AFIO_INTERFACE_H_
+
+#include "../GPIO/GPIO_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup afio_module
+ * @{
+ */
+
+/**
+ * @brief This function selects the GPIO port that drives an EXTI line
+ * @details This function connects pin `tPin` of port `tPort` to the EXTI line with the same number as the pin
+ * @param[in] tPort The GPIO port
+ * @param[in] tPin The GPIO pin (also the EXTI line number)
+ * @note The AFIO clock must be enabled using RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_AFIO)
+ * @see t_GPIO_Ports t_GPIO_Pins
+ */
+void AFIO_vSetEXTIPort(t_GPIO_Ports tPort, t_GPIO_Pins tPin);
+
+/** @} */
+/** @} */
+
+#endif /* _AFIO_INTERFACE_H_ */
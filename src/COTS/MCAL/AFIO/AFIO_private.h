@@ -0,0 +1,120 @@
+/**
+ * @file AFIO_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the AFIO module.
+ * @details This file contains the private macros and registers for the AFIO module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/AFIO
+ * @brief AFIO Module
+ * @details This module contains all the APIs related to the alternate function I/O module
+ */
+
+#ifndef _AFIO_PRIVATE_H_
+#define _AFIO_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup afio_module AFIO Module
+ * @brief AFIO Module
+ * @details This module contains all the APIs related to the alternate function I/O module
+ * @{
+ */
+
+/**
+ * @defgroup afio_registers AFIO Registers
+ * @brief AFIO Registers
+ * @{
+ */
+
+/**
+ * @struct t_AFIO_RegisterMap
+ * @brief AFIO Register Map
+ * @details This type is used to access the AFIO registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Event Control Register
+	 */
+	t_u32 EVCR;
+	/**
+	 * @brief AF Remap and Debug I/O Configuration Register
+	 */
+	t_u32 MAPR;
+	/**
+	 * @brief External Interrupt Configuration Registers 1 to 4
+	 */
+	t_u32 EXTICR[4];
+	/**
+	 * @brief Reserved
+	 */
+	t_u32 RESERVED0;
+	/**
+	 * @brief AF Remap and Debug I/O Configuration Register 2
+	 */
+	t_u32 MAPR2;
+} t_AFIO_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup afio_addresses AFIO Addresses
+ * @brief AFIO Addresses
+ * @details This module contains the addresses of the AFIO registers
+ * @{
+ */
+
+/**
+ * @def AFIO_BASE_ADDRESS
+ * @brief AFIO Base Address in the memory
+ */
+#define AFIO_BASE_ADDRESS REGISTER_ADDRESS(0x40010000, 0)
+
+/**
+ * @def AFIO
+ * @brief AFIO Register Map
+ */
+#define AFIO REGISTER(t_AFIO_RegisterMap, AFIO_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup afio_constants AFIO Constants
+ * @brief AFIO Constants
+ * @{
+ */
+
+/**
+ * @def AFIO_EXTICR_LINES_PER_REGISTER
+ * @brief Number of EXTI lines configured by each EXTICR register
+ */
+#define AFIO_EXTICR_LINES_PER_REGISTER (4)
+
+/**
+ * @def AFIO_EXTICR_FIELD_WIDTH
+ * @brief Width of the port selection field of one EXTI line in the EXTICR register
+ */
+#define AFIO_EXTICR_FIELD_WIDTH (4)
+
+/**
+ * @def AFIO_EXTICR_FIELD_MASK
+ * @brief Mask of the port selection field of one EXTI line in the EXTICR register
+ */
+#define AFIO_EXTICR_FIELD_MASK ((t_u32)0x0000000FU)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _AFIO_PRIVATE_H_ */
@@ -0,0 +1,25 @@
+/**
+ * @file AFIO_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the AFIO module.
+ * @details This file contains the implementation for the AFIO module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "AFIO_private.h"
+#include "AFIO_interface.h"
+#include "AFIO_config.h"
+
+void AFIO_vSetEXTIPort(t_GPIO_Ports tPort, t_GPIO_Pins tPin)
+{
+	/* Get the EXTICR register that holds the line */
+	t_u8 u8RegisterIndex = (t_u8)(tPin / AFIO_EXTICR_LINES_PER_REGISTER);
+	/* Get the position of the line's port selection field inside the register */
+	t_u8 u8FieldShift = (t_u8)((tPin % AFIO_EXTICR_LINES_PER_REGISTER) * AFIO_EXTICR_FIELD_WIDTH);
+
+	/* Select the port of the line */
+	AFIO.EXTICR[u8RegisterIndex] = (AFIO.EXTICR[u8RegisterIndex] & ~(AFIO_EXTICR_FIELD_MASK << u8FieldShift)) | ((t_u32)tPort << u8FieldShift);
+}
@@ -0,0 +1,15 @@
+/**
+ * @file CRC_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the CRC module.
+ * @details This file contains the configuration parameters for the CRC module.
+ * @date 2026-10-19
+ */
+
+#ifndef _CRC_CONFIG_H_
+#define _CRC_CONFIG_H_
+
+#include "CRC_interface.h"
+
+#endif /* _CRC_CONFIG_H_ */
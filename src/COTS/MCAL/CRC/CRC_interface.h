@@ -0,0 +1,55 @@
+/**
+ * @file CRC_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the CRC module.
+ * @details This file contains the prototypes of the functions of the CRC module.
+ * @date 2026-10-19
+ */
+
+#ifndef _CRC_INTERFACE_H_
+#define _CRC_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup crc_module
+ * @{
+ */
+
+/**
+ * @brief This function enables the clock of the CRC unit
+ */
+void CRC_vInit(void);
+
+/**
+ * @brief This function starts a new CRC calculation
+ */
+void CRC_vReset(void);
+
+/**
+ * @brief This function feeds words to the current CRC calculation
+ * @param[in] pu32Data The words
+ * @param[in] u32Words The number of the words
+ * @return The CRC of all the words fed since the last CRC_vReset()
+ */
+t_u32 CRC_u32Accumulate(P2CONST(t_u32) pu32Data, t_u32 u32Words);
+
+/**
+ * @brief This function computes the CRC of a block of words
+ * @param[in] pu32Data The words
+ * @param[in] u32Words The number of the words
+ * @return The CRC of the words
+ */
+t_u32 CRC_u32Calculate(P2CONST(t_u32) pu32Data, t_u32 u32Words);
+
+/** @} */
+/** @} */
+
+#endif /* _CRC_INTERFACE_H_ */
@@ -0,0 +1,102 @@
+/**
+ * @file CRC_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the CRC module.
+ * @details This file contains the private macros and registers for the CRC module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/CRC
+ * @brief CRC Module
+ * @details This module contains all the APIs related to the CRC calculation unit
+ */
+
+#ifndef _CRC_PRIVATE_H_
+#define _CRC_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup crc_module CRC Module
+ * @brief CRC Module
+ * @details This module contains all the APIs related to the CRC calculation unit. The unit computes the CRC-32 of the
+ * Ethernet polynomial (0x04C11DB7) one 32-bit word at a time, starting from 0xFFFFFFFF, without any bit reflection
+ * nor final XOR (the CRC-32/MPEG-2 variant)
+ * @{
+ */
+
+/**
+ * @defgroup crc_registers CRC Registers
+ * @brief CRC Registers
+ * @{
+ */
+
+/**
+ * @struct t_CRC_RegisterMap
+ * @brief CRC Register Map
+ * @details This type is used to access the CRC registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Data Register, a write feeds a word and a read returns the current CRC
+	 */
+	t_u32 DR;
+	/**
+	 * @brief Independent Data Register (8 bits of general purpose storage)
+	 */
+	t_u32 IDR;
+	/**
+	 * @brief Control Register
+	 */
+	t_u32 CR;
+} t_CRC_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup crc_addresses CRC Addresses
+ * @brief CRC Addresses
+ * @details This module contains the addresses of the CRC registers
+ * @{
+ */
+
+/**
+ * @def CRC_BASE_ADDRESS
+ * @brief CRC Base Address in the memory
+ */
+#define CRC_BASE_ADDRESS REGISTER_ADDRESS(0x40023000, 0)
+
+/**
+ * @def CRC
+ * @brief CRC Register Map
+ */
+#define CRC REGISTER(t_CRC_RegisterMap, CRC_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup crc_constants CRC Constants
+ * @brief CRC Constants
+ * @{
+ */
+
+/**
+ * @def CRC_CR_RESET
+ * @brief Reset bit, it loads the data register with 0xFFFFFFFF
+ */
+#define CRC_CR_RESET (0)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _CRC_PRIVATE_H_ */
@@ -0,0 +1,45 @@
+/**
+ * @file CRC_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the CRC module.
+ * @details This file contains the implementation for the CRC module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../RCC/RCC_interface.h"
+#include "CRC_private.h"
+#include "CRC_interface.h"
+#include "CRC_config.h"
+
+void CRC_vInit(void)
+{
+	RCC_vEnablePeripheralAHB(RCC_AHBPeripherals_CRC);
+}
+
+void CRC_vReset(void)
+{
+	CRC.CR = (t_u32)1 << CRC_CR_RESET;
+}
+
+t_u32 CRC_u32Accumulate(P2CONST(t_u32) pu32Data, t_u32 u32Words)
+{
+	t_u32 u32Index = 0;
+
+	/* The unit takes one word per AHB write, the writes stall until the previous word is done */
+	for (u32Index = 0; u32Index < u32Words; u32Index++)
+	{
+		CRC.DR = pu32Data[u32Index];
+	}
+
+	return CRC.DR;
+}
+
+t_u32 CRC_u32Calculate(P2CONST(t_u32) pu32Data, t_u32 u32Words)
+{
+	CRC_vReset();
+
+	return CRC_u32Accumulate(pu32Data, u32Words);
+}
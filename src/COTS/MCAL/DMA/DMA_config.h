@@ -0,0 +1,15 @@
+/**
+ * @file DMA_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the DMA module.
+ * @details This file contains the configuration parameters for the DMA module.
+ * @date 2026-10-19
+ */
+
+#ifndef _DMA_CONFIG_H_
+#define _DMA_CONFIG_H_
+
+#include "DMA_interface.h"
+
+#endif /* _DMA_CONFIG_H_ */
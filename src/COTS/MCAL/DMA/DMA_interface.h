@@ -0,0 +1,507 @@
+/**
+ * @file DMA_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the DMA module.
+ * @details This file contains the prototypes of the functions of the DMA module.
+ * @date 2026-10-19
+ */
+
+#ifndef _DMA_INTERFACE_H_
+#define _DMA_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup dma_module
+ * @{
+ */
+
+/**
+ * @typedef t_DMA_Channels
+ * @brief DMA Channels
+ * @details This type is used to select a DMA1 channel
+ */
+typedef enum
+{
+	/**
+	 * @brief DMA1 channel 1
+	 */
+	DMA_Channels_1 = 0,
+	/**
+	 * @brief DMA1 channel 2
+	 */
+	DMA_Channels_2,
+	/**
+	 * @brief DMA1 channel 3
+	 */
+	DMA_Channels_3,
+	/**
+	 * @brief DMA1 channel 4
+	 */
+	DMA_Channels_4,
+	/**
+	 * @brief DMA1 channel 5
+	 */
+	DMA_Channels_5,
+	/**
+	 * @brief DMA1 channel 6
+	 */
+	DMA_Channels_6,
+	/**
+	 * @brief DMA1 channel 7
+	 */
+	DMA_Channels_7
+} t_DMA_Channels;
+
+/**
+ * @typedef t_DMA_Direction
+ * @brief DMA Transfer Direction
+ * @details This type is used to select the data transfer direction of a channel
+ */
+typedef enum
+{
+	/**
+	 * @brief Read from the peripheral, write to the memory
+	 */
+	DMA_Direction_PeripheralToMemory = 0,
+	/**
+	 * @brief Read from the memory, write to the peripheral
+	 */
+	DMA_Direction_MemoryToPeripheral,
+	/**
+	 * @brief Read from the memory (peripheral address), write to the memory (memory address) without any peripheral request
+	 */
+	DMA_Direction_MemoryToMemory
+} t_DMA_Direction;
+
+/**
+ * @typedef t_DMA_Size
+ * @brief DMA Data Size
+ * @details This type is used to select the size of the data items on the peripheral or the memory side
+ */
+typedef enum
+{
+	/**
+	 * @brief 8-bit data items
+	 */
+	DMA_Size_8Bits = 0,
+	/**
+	 * @brief 16-bit data items
+	 */
+	DMA_Size_16Bits,
+	/**
+	 * @brief 32-bit data items
+	 */
+	DMA_Size_32Bits
+} t_DMA_Size;
+
+/**
+ * @typedef t_DMA_Priority
+ * @brief DMA Channel Priority
+ * @details This type is used to select the software priority of a channel, ties are resolved by the channel number (lower wins)
+ */
+typedef enum
+{
+	/**
+	 * @brief Low priority
+	 */
+	DMA_Priority_Low = 0,
+	/**
+	 * @brief Medium priority
+	 */
+	DMA_Priority_Medium,
+	/**
+	 * @brief High priority
+	 */
+	DMA_Priority_High,
+	/**
+	 * @brief Very high priority
+	 */
+	DMA_Priority_VeryHigh
+} t_DMA_Priority;
+
+/**
+ * @typedef t_DMA_Events
+ * @brief DMA Events
+ * @details This type is used to select the interrupts of a channel and to report which event fired, values can be ORed to enable several interrupts
+ */
+typedef enum
+{
+	/**
+	 * @brief No event
+	 */
+	DMA_Events_None = 0,
+	/**
+	 * @brief The whole transfer is complete (or the buffer wrapped around in circular mode)
+	 */
+	DMA_Events_TransferComplete = 2,
+	/**
+	 * @brief Half of the transfer is complete
+	 */
+	DMA_Events_HalfTransfer = 4,
+	/**
+	 * @brief A bus error occurred, the channel is disabled by hardware
+	 */
+	DMA_Events_TransferError = 8
+} t_DMA_Events;
+
+/**
+ * @typedef t_DMA_Callback
+ * @brief DMA Callback
+ * @details This type is used to define the function called from the interrupt context when an enabled channel event fires
+ */
+typedef P2FUNC(void, t_DMA_Callback)(t_DMA_Channels tChannel, t_DMA_Events tEvent);
+
+/**
+ * @struct t_DMA_ChannelConfig
+ * @brief DMA Channel Configuration
+ * @details This type is used to configure a DMA channel, the members are ordered by size so that the layout has no implicit
+ * padding whatever the size of the enumerations
+ */
+typedef struct
+{
+	/**
+	 * @brief Address of the peripheral data register (or the source buffer in memory to memory mode)
+	 */
+	t_u32 u32PeripheralAddress;
+	/**
+	 * @brief Address of the memory buffer
+	 */
+	t_u32 u32MemoryAddress;
+	/**
+	 * @brief The function called when one of the enabled events fires (can be NULL)
+	 */
+	t_DMA_Callback pfCallback;
+	/**
+	 * @brief Data transfer direction
+	 */
+	t_DMA_Direction tDirection;
+	/**
+	 * @brief Size of the peripheral data items
+	 */
+	t_DMA_Size tPeripheralSize;
+	/**
+	 * @brief Size of the memory data items
+	 */
+	t_DMA_Size tMemorySize;
+	/**
+	 * @brief Channel priority
+	 */
+	t_DMA_Priority tPriority;
+	/**
+	 * @brief Number of data items to transfer (1 to 65535)
+	 */
+	t_u16 u16Count;
+	/**
+	 * @brief The events that trigger an interrupt (ORed values of t_DMA_Events)
+	 */
+	t_u8 u8Events;
+	/**
+	 * @brief Increment the peripheral address after each data item
+	 */
+	t_bool bPeripheralIncrement;
+	/**
+	 * @brief Increment the memory address after each data item
+	 */
+	t_bool bMemoryIncrement;
+	/**
+	 * @brief Reload the address and the counter at the end of each transfer
+	 */
+	t_bool bCircular;
+	/**
+	 * @brief Unused, it completes the structure to a multiple of 4 bytes without any implicit padding
+	 */
+	t_u8 au8Reserved[2];
+} t_DMA_ChannelConfig;
+
+/**
+ * @defgroup dma_requests DMA Requests Mapping
+ * @brief The DMA1 channel that serves each peripheral request (fixed by hardware)
+ * @{
+ */
+
+/**
+ * @def DMA_CHANNEL_ADC1
+ * @brief The DMA1 channel connected to the ADC1 regular conversions request
+ */
+#define DMA_CHANNEL_ADC1 (DMA_Channels_1)
+
+/**
+ * @def DMA_CHANNEL_SPI1_RX
+ * @brief The DMA1 channel connected to the SPI1 receive request
+ */
+#define DMA_CHANNEL_SPI1_RX (DMA_Channels_2)
+
+/**
+ * @def DMA_CHANNEL_SPI1_TX
+ * @brief The DMA1 channel connected to the SPI1 transmit request
+ */
+#define DMA_CHANNEL_SPI1_TX (DMA_Channels_3)
+
+/**
+ * @def DMA_CHANNEL_SPI2_RX
+ * @brief The DMA1 channel connected to the SPI2 receive request
+ */
+#define DMA_CHANNEL_SPI2_RX (DMA_Channels_4)
+
+/**
+ * @def DMA_CHANNEL_SPI2_TX
+ * @brief The DMA1 channel connected to the SPI2 transmit request
+ */
+#define DMA_CHANNEL_SPI2_TX (DMA_Channels_5)
+
+/**
+ * @def DMA_CHANNEL_USART1_TX
+ * @brief The DMA1 channel connected to the USART1 transmit request
+ */
+#define DMA_CHANNEL_USART1_TX (DMA_Channels_4)
+
+/**
+ * @def DMA_CHANNEL_USART1_RX
+ * @brief The DMA1 channel connected to the USART1 receive request
+ */
+#define DMA_CHANNEL_USART1_RX (DMA_Channels_5)
+
+/**
+ * @def DMA_CHANNEL_USART2_RX
+ * @brief The DMA1 channel connected to the USART2 receive request
+ */
+#define DMA_CHANNEL_USART2_RX (DMA_Channels_6)
+
+/**
+ * @def DMA_CHANNEL_USART2_TX
+ * @brief The DMA1 channel connected to the USART2 transmit request
+ */
+#define DMA_CHANNEL_USART2_TX (DMA_Channels_7)
+
+/**
+ * @def DMA_CHANNEL_USART3_TX
+ * @brief The DMA1 channel connected to the USART3 transmit request
+ */
+#define DMA_CHANNEL_USART3_TX (DMA_Channels_2)
+
+/**
+ * @def DMA_CHANNEL_USART3_RX
+ * @brief The DMA1 channel connected to the USART3 receive request
+ */
+#define DMA_CHANNEL_USART3_RX (DMA_Channels_3)
+
+/**
+ * @def DMA_CHANNEL_I2C1_TX
+ * @brief The DMA1 channel connected to the I2C1 transmit request
+ */
+#define DMA_CHANNEL_I2C1_TX (DMA_Channels_6)
+
+/**
+ * @def DMA_CHANNEL_I2C1_RX
+ * @brief The DMA1 channel connected to the I2C1 receive request
+ */
+#define DMA_CHANNEL_I2C1_RX (DMA_Channels_7)
+
+/**
+ * @def DMA_CHANNEL_I2C2_TX
+ * @brief The DMA1 channel connected to the I2C2 transmit request
+ */
+#define DMA_CHANNEL_I2C2_TX (DMA_Channels_4)
+
+/**
+ * @def DMA_CHANNEL_I2C2_RX
+ * @brief The DMA1 channel connected to the I2C2 receive request
+ */
+#define DMA_CHANNEL_I2C2_RX (DMA_Channels_5)
+
+/**
+ * @def DMA_CHANNEL_TIM1_CH1
+ * @brief The DMA1 channel connected to the TIM1 capture/compare 1 request
+ */
+#define DMA_CHANNEL_TIM1_CH1 (DMA_Channels_2)
+
+/**
+ * @def DMA_CHANNEL_TIM1_CH4
+ * @brief The DMA1 channel connected to the TIM1 capture/compare 4, trigger and commutation request
+ */
+#define DMA_CHANNEL_TIM1_CH4 (DMA_Channels_4)
+
+/**
+ * @def DMA_CHANNEL_TIM1_UP
+ * @brief The DMA1 channel connected to the TIM1 update request
+ */
+#define DMA_CHANNEL_TIM1_UP (DMA_Channels_5)
+
+/**
+ * @def DMA_CHANNEL_TIM1_CH3
+ * @brief The DMA1 channel connected to the TIM1 capture/compare 3 request
+ */
+#define DMA_CHANNEL_TIM1_CH3 (DMA_Channels_6)
+
+/**
+ * @def DMA_CHANNEL_TIM2_CH3
+ * @brief The DMA1 channel connected to the TIM2 capture/compare 3 request
+ */
+#define DMA_CHANNEL_TIM2_CH3 (DMA_Channels_1)
+
+/**
+ * @def DMA_CHANNEL_TIM2_UP
+ * @brief The DMA1 channel connected to the TIM2 update request
+ */
+#define DMA_CHANNEL_TIM2_UP (DMA_Channels_2)
+
+/**
+ * @def DMA_CHANNEL_TIM2_CH1
+ * @brief The DMA1 channel connected to the TIM2 capture/compare 1 request
+ */
+#define DMA_CHANNEL_TIM2_CH1 (DMA_Channels_5)
+
+/**
+ * @def DMA_CHANNEL_TIM2_CH2
+ * @brief The DMA1 channel connected to the TIM2 capture/compare 2 and 4 request
+ */
+#define DMA_CHANNEL_TIM2_CH2 (DMA_Channels_7)
+
+/**
+ * @def DMA_CHANNEL_TIM3_CH3
+ * @brief The DMA1 channel connected to the TIM3 capture/compare 3 request
+ */
+#define DMA_CHANNEL_TIM3_CH3 (DMA_Channels_2)
+
+/**
+ * @def DMA_CHANNEL_TIM3_UP
+ * @brief The DMA1 channel connected to the TIM3 update and capture/compare 4 request
+ */
+#define DMA_CHANNEL_TIM3_UP (DMA_Channels_3)
+
+/**
+ * @def DMA_CHANNEL_TIM3_CH1
+ * @brief The DMA1 channel connected to the TIM3 capture/compare 1 and trigger request
+ */
+#define DMA_CHANNEL_TIM3_CH1 (DMA_Channels_6)
+
+/**
+ * @def DMA_CHANNEL_TIM4_CH1
+ * @brief The DMA1 channel connected to the TIM4 capture/compare 1 request
+ */
+#define DMA_CHANNEL_TIM4_CH1 (DMA_Channels_1)
+
+/**
+ * @def DMA_CHANNEL_TIM4_CH2
+ * @brief The DMA1 channel connected to the TIM4 capture/compare 2 request
+ */
+#define DMA_CHANNEL_TIM4_CH2 (DMA_Channels_4)
+
+/**
+ * @def DMA_CHANNEL_TIM4_CH3
+ * @brief The DMA1 channel connected to the TIM4 capture/compare 3 request
+ */
+#define DMA_CHANNEL_TIM4_CH3 (DMA_Channels_5)
+
+/**
+ * @def DMA_CHANNEL_TIM4_UP
+ * @brief The DMA1 channel connected to the TIM4 update request
+ */
+#define DMA_CHANNEL_TIM4_UP (DMA_Channels_7)
+
+/** @} */
+
+/**
+ * @brief This function reserves a DMA channel for a driver
+ * @details This function registers the owner of a channel so that two drivers never drive the same channel
+ * @param[in] tChannel The channel to reserve
+ * @param[in] pvOwner The owner token, any address unique to the driver (e.g. the address of its state or its API)
+ * @return TRUE if the channel is reserved for the caller, FALSE if it is owned by another driver
+ * @note The same owner can allocate a channel it already owns
+ * @see t_DMA_Channels
+ */
+t_bool DMA_bAllocateChannel(t_DMA_Channels tChannel, P2CONST(void) pvOwner);
+
+/**
+ * @brief This function releases a DMA channel
+ * @details This function stops the channel and removes its owner
+ * @param[in] tChannel The channel to release
+ * @see t_DMA_Channels
+ */
+void DMA_vReleaseChannel(t_DMA_Channels tChannel);
+
+/**
+ * @brief This function gets the owner of a DMA channel
+ * @details This function gets the owner of a DMA channel
+ * @param[in] tChannel The channel to get its owner
+ * @return The owner token, NULL if the channel is free
+ * @see t_DMA_Channels
+ */
+P2CONST(void) DMA_pvGetChannelOwner(t_DMA_Channels tChannel);
+
+/**
+ * @brief This function configures a DMA channel
+ * @details This function disables the channel, programs the addresses, the counter and the mode, clears its flags and enables its NVIC interrupt if any event is selected
+ * @param[in] tChannel The channel to configure
+ * @param[in] ptConfig The channel configuration
+ * @note The DMA1 clock must be enabled using RCC_vEnablePeripheralAHB(RCC_AHBPeripherals_DMA1)
+ * @see t_DMA_Channels t_DMA_ChannelConfig
+ */
+void DMA_vConfigureChannel(t_DMA_Channels tChannel, P2CONST(t_DMA_ChannelConfig) ptConfig);
+
+/**
+ * @brief This function starts a DMA channel
+ * @details This function enables a configured channel, the transfer starts with the first peripheral request
+ * @param[in] tChannel The channel to start
+ * @see t_DMA_Channels
+ */
+void DMA_vStartChannel(t_DMA_Channels tChannel);
+
+/**
+ * @brief This function stops a DMA channel
+ * @details This function disables a channel, the current data item transfer is completed first
+ * @param[in] tChannel The channel to stop
+ * @see t_DMA_Channels
+ */
+void DMA_vStopChannel(t_DMA_Channels tChannel);
+
+/**
+ * @brief This function re-arms a DMA channel with a new memory buffer
+ * @details This function stops the channel, sets the new memory address and counter, clears its flags and starts it again
+ * @param[in] tChannel The channel to re-arm
+ * @param[in] u32MemoryAddress The new memory buffer address
+ * @param[in] u16Count The new number of data items
+ * @see t_DMA_Channels
+ */
+void DMA_vRestartChannel(t_DMA_Channels tChannel, t_u32 u32MemoryAddress, t_u16 u16Count);
+
+/**
+ * @brief This function gets the number of data items left to transfer
+ * @details This function reads the channel counter, in circular mode it counts down then reloads
+ * @param[in] tChannel The channel to read its counter
+ * @return The number of data items left
+ * @see t_DMA_Channels
+ */
+t_u16 DMA_u16GetRemainingCount(t_DMA_Channels tChannel);
+
+/**
+ * @brief This function checks whether a DMA channel is enabled
+ * @details This function checks whether a DMA channel is enabled
+ * @param[in] tChannel The channel to check
+ * @return TRUE if the channel is enabled, FALSE otherwise
+ * @see t_DMA_Channels
+ */
+t_bool DMA_bIsChannelEnabled(t_DMA_Channels tChannel);
+
+/**
+ * @brief This function sets the NVIC priority of a DMA channel interrupt
+ * @details This function sets the NVIC priority of a DMA channel interrupt, drivers that share state between
+ * a peripheral interrupt and a DMA callback give both the same priority so they never preempt each other
+ * @param[in] tChannel The channel to set its interrupt priority
+ * @param[in] u8Priority The priority value (0 to 15)
+ * @see t_DMA_Channels NVIC_vSetPriority
+ */
+void DMA_vSetChannelPriority(t_DMA_Channels tChannel, t_u8 u8Priority);
+
+/** @} */
+/** @} */
+
+#endif /* _DMA_INTERFACE_H_ */
@@ -0,0 +1,273 @@
+/**
+ * @file DMA_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the DMA module.
+ * @details This file contains the private macros and registers for the DMA module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/DMA
+ * @brief DMA Module
+ * @details This module contains all the APIs related to the DMA1 controller
+ */
+
+#ifndef _DMA_PRIVATE_H_
+#define _DMA_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup dma_module DMA Module
+ * @brief DMA Module
+ * @details This module contains all the APIs related to the DMA1 controller
+ * @{
+ */
+
+/**
+ * @defgroup dma_registers DMA Registers
+ * @brief DMA Registers
+ * @{
+ */
+
+/**
+ * @struct t_DMA_ChannelRegisterMap
+ * @brief DMA Channel Register Map
+ * @details This type is used to access the registers of one DMA channel
+ */
+typedef struct
+{
+	/**
+	 * @brief Channel Configuration Register
+	 */
+	t_u32 CCR;
+	/**
+	 * @brief Channel Number of Data Register
+	 */
+	t_u32 CNDTR;
+	/**
+	 * @brief Channel Peripheral Address Register
+	 */
+	t_u32 CPAR;
+	/**
+	 * @brief Channel Memory Address Register
+	 */
+	t_u32 CMAR;
+	/**
+	 * @brief Reserved
+	 */
+	t_u32 RESERVED;
+} t_DMA_ChannelRegisterMap;
+
+/**
+ * @struct t_DMA_RegisterMap
+ * @brief DMA Register Map
+ * @details This type is used to access the DMA registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Interrupt Status Register
+	 * @warning This register is read-only
+	 */
+	t_u32 ISR;
+	/**
+	 * @brief Interrupt Flag Clear Register
+	 * @warning This register is write-only
+	 */
+	t_u32 IFCR;
+	/**
+	 * @brief Channels 1 to 7 registers
+	 */
+	t_DMA_ChannelRegisterMap CHANNEL[7];
+} t_DMA_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup dma_addresses DMA Addresses
+ * @brief DMA Addresses
+ * @details This module contains the addresses of the DMA registers
+ * @{
+ */
+
+/**
+ * @def DMA1_BASE_ADDRESS
+ * @brief DMA1 Base Address in the memory
+ */
+#define DMA1_BASE_ADDRESS REGISTER_ADDRESS(0x40020000, 0)
+
+/**
+ * @def DMA1
+ * @brief DMA1 Register Map
+ */
+#define DMA1 REGISTER(t_DMA_RegisterMap, DMA1_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup dma_constants DMA Constants
+ * @brief DMA Constants
+ * @{
+ */
+
+/**
+ * @def DMA_CHANNELS_COUNT
+ * @brief Number of the DMA1 channels
+ */
+#define DMA_CHANNELS_COUNT (7)
+
+/**
+ * @def DMA_CCR_EN
+ * @brief Channel enable bit
+ */
+#define DMA_CCR_EN (0)
+
+/**
+ * @def DMA_CCR_INTERRUPTS_MASK
+ * @brief Mask of the interrupt enable bits (TCIE, HTIE and TEIE)
+ */
+#define DMA_CCR_INTERRUPTS_MASK ((t_u32)0x0000000EU)
+
+/**
+ * @def DMA_CCR_DIR
+ * @brief Data transfer direction bit (`1`: read from memory)
+ */
+#define DMA_CCR_DIR (4)
+
+/**
+ * @def DMA_CCR_CIRC
+ * @brief Circular mode bit
+ */
+#define DMA_CCR_CIRC (5)
+
+/**
+ * @def DMA_CCR_PINC
+ * @brief Peripheral increment mode bit
+ */
+#define DMA_CCR_PINC (6)
+
+/**
+ * @def DMA_CCR_MINC
+ * @brief Memory increment mode bit
+ */
+#define DMA_CCR_MINC (7)
+
+/**
+ * @def DMA_CCR_PSIZE
+ * @brief Position of the peripheral size field
+ */
+#define DMA_CCR_PSIZE (8)
+
+/**
+ * @def DMA_CCR_MSIZE
+ * @brief Position of the memory size field
+ */
+#define DMA_CCR_MSIZE (10)
+
+/**
+ * @def DMA_CCR_PL
+ * @brief Position of the channel priority level field
+ */
+#define DMA_CCR_PL (12)
+
+/**
+ * @def DMA_CCR_MEM2MEM
+ * @brief Memory to memory mode bit
+ */
+#define DMA_CCR_MEM2MEM (14)
+
+/**
+ * @def DMA_ISR_FLAGS_WIDTH
+ * @brief Number of the status flags of each channel in the ISR/IFCR registers
+ */
+#define DMA_ISR_FLAGS_WIDTH (4)
+
+/**
+ * @def DMA_ISR_CHANNEL_FLAGS
+ * @brief Get the four flags (GIF, TCIF, HTIF and TEIF) of a channel, shifted down to bit 0
+ * @param[in] ISR The ISR register value
+ * @param[in] CHANNEL The channel index (0 to 6)
+ */
+#define DMA_ISR_CHANNEL_FLAGS(ISR, CHANNEL) (((ISR) >> ((CHANNEL) * DMA_ISR_FLAGS_WIDTH)) & (t_u32)0x0000000FU)
+
+/**
+ * @def DMA_IFCR_CHANNEL_ALL
+ * @brief Get the mask that clears all the flags of a channel
+ * @param[in] CHANNEL The channel index (0 to 6)
+ */
+#define DMA_IFCR_CHANNEL_ALL(CHANNEL) ((t_u32)0x0000000FU << ((CHANNEL) * DMA_ISR_FLAGS_WIDTH))
+
+/**
+ * @def DMA_FLAG_TC
+ * @brief Transfer complete flag (inside the channel flags)
+ */
+#define DMA_FLAG_TC ((t_u32)0x00000002U)
+
+/**
+ * @def DMA_FLAG_HT
+ * @brief Half transfer flag (inside the channel flags)
+ */
+#define DMA_FLAG_HT ((t_u32)0x00000004U)
+
+/**
+ * @def DMA_FLAG_TE
+ * @brief Transfer error flag (inside the channel flags)
+ */
+#define DMA_FLAG_TE ((t_u32)0x00000008U)
+
+/** @} */
+
+/**
+ * @defgroup dma_handlers DMA Interrupt Handlers
+ * @brief The interrupt handlers of the DMA module, they are referenced by the vector table
+ * @{
+ */
+
+/**
+ * @brief DMA1 channel 1 interrupt handler
+ */
+void DMA1_Channel1_IRQHandler(void);
+
+/**
+ * @brief DMA1 channel 2 interrupt handler
+ */
+void DMA1_Channel2_IRQHandler(void);
+
+/**
+ * @brief DMA1 channel 3 interrupt handler
+ */
+void DMA1_Channel3_IRQHandler(void);
+
+/**
+ * @brief DMA1 channel 4 interrupt handler
+ */
+void DMA1_Channel4_IRQHandler(void);
+
+/**
+ * @brief DMA1 channel 5 interrupt handler
+ */
+void DMA1_Channel5_IRQHandler(void);
+
+/**
+ * @brief DMA1 channel 6 interrupt handler
+ */
+void DMA1_Channel6_IRQHandler(void);
+
+/**
+ * @brief DMA1 channel 7 interrupt handler
+ */
+void DMA1_Channel7_IRQHandler(void);
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _DMA_PRIVATE_H_ */
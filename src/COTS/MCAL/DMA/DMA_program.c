@@ -0,0 +1,289 @@
+/**
+ * @file DMA_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the DMA module.
+ * @details This file contains the implementation for the DMA module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../NVIC/NVIC_interface.h"
+#include "DMA_private.h"
+#include "DMA_interface.h"
+#include "DMA_config.h"
+
+/**
+ * @brief The owners of the DMA channels (NULL if the channel is free)
+ */
+STATIC P2CONST(void) apvDMAOwners[DMA_CHANNELS_COUNT] = {NULL};
+
+/**
+ * @brief The callbacks of the DMA channels
+ */
+STATIC t_DMA_Callback apfDMACallbacks[DMA_CHANNELS_COUNT] = {NULL};
+
+/**
+ * @brief This function dispatches the events of a DMA channel
+ * @details The flags are cleared before calling the callback so that an event raised during the callback is not lost.
+ * In circular mode the half transfer and transfer complete events give the callback a whole half of the buffer to process.
+ * The dispatcher and the interrupt handlers run from the SRAM (RAMFUNC) to avoid the flash wait states.
+ * @param[in] tChannel The channel that raised the interrupt
+ */
+STATIC RAMFUNC void DMA_vDispatchChannel(t_DMA_Channels tChannel)
+{
+	/* Get the flags of the channel that have their interrupt enabled */
+	t_u32 u32Flags = DMA_ISR_CHANNEL_FLAGS(DMA1.ISR, tChannel) & DMA1.CHANNEL[tChannel].CCR & DMA_CCR_INTERRUPTS_MASK;
+
+	/* Clear the flags of the channel (write 1 to clear) */
+	DMA1.IFCR = u32Flags << (tChannel * DMA_ISR_FLAGS_WIDTH);
+
+	if (apfDMACallbacks[tChannel] != NULL)
+	{
+		/* Report the error first, the channel is already disabled by hardware */
+		if ((u32Flags & DMA_FLAG_TE) != 0U)
+		{
+			apfDMACallbacks[tChannel](tChannel, DMA_Events_TransferError);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		/* The callback can release the channel, then the remaining events are dropped */
+		if (((u32Flags & DMA_FLAG_HT) != 0U) && (apfDMACallbacks[tChannel] != NULL))
+		{
+			apfDMACallbacks[tChannel](tChannel, DMA_Events_HalfTransfer);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		if (((u32Flags & DMA_FLAG_TC) != 0U) && (apfDMACallbacks[tChannel] != NULL))
+		{
+			apfDMACallbacks[tChannel](tChannel, DMA_Events_TransferComplete);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool DMA_bAllocateChannel(t_DMA_Channels tChannel, P2CONST(void) pvOwner)
+{
+	t_bool bStatus = FALSE;
+	/* The registry can be accessed from interrupts, keep the check and the update atomic */
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	if ((apvDMAOwners[tChannel] == NULL) || (apvDMAOwners[tChannel] == pvOwner))
+	{
+		apvDMAOwners[tChannel] = pvOwner;
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+
+	return bStatus;
+}
+
+void DMA_vReleaseChannel(t_DMA_Channels tChannel)
+{
+	/* Stop the channel and mask its interrupts */
+	DMA1.CHANNEL[tChannel].CCR = 0U;
+	/* Clear any pending flag of the channel */
+	DMA1.IFCR = DMA_IFCR_CHANNEL_ALL(tChannel);
+	/* Disable the vector of the channel */
+	NVIC_vDisableIRQ((t_NVIC_IRQs)(NVIC_IRQs_DMA1_Channel1 + tChannel));
+	/* Remove the callback and the owner of the channel */
+	apfDMACallbacks[tChannel] = NULL;
+	apvDMAOwners[tChannel] = NULL;
+}
+
+P2CONST(void) DMA_pvGetChannelOwner(t_DMA_Channels tChannel)
+{
+	return apvDMAOwners[tChannel];
+}
+
+void DMA_vConfigureChannel(t_DMA_Channels tChannel, P2CONST(t_DMA_ChannelConfig) ptConfig)
+{
+	/* Store the new value of the configuration register */
+	t_u32 u32CCR = 0U;
+
+	/* The channel registers can only be written while it is disabled */
+	DMA1.CHANNEL[tChannel].CCR = 0U;
+
+	/* Select the direction */
+	if (ptConfig->tDirection == DMA_Direction_MemoryToPeripheral)
+	{
+		SET_BIT(u32CCR, DMA_CCR_DIR);
+	}
+	else if (ptConfig->tDirection == DMA_Direction_MemoryToMemory)
+	{
+		SET_BIT(u32CCR, DMA_CCR_MEM2MEM);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* Select the circular mode */
+	if (ptConfig->bCircular == TRUE)
+	{
+		SET_BIT(u32CCR, DMA_CCR_CIRC);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* Select the address increment modes */
+	if (ptConfig->bPeripheralIncrement == TRUE)
+	{
+		SET_BIT(u32CCR, DMA_CCR_PINC);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (ptConfig->bMemoryIncrement == TRUE)
+	{
+		SET_BIT(u32CCR, DMA_CCR_MINC);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* Select the data sizes, the priority and the interrupts */
+	u32CCR |= ((t_u32)ptConfig->tPeripheralSize << DMA_CCR_PSIZE);
+	u32CCR |= ((t_u32)ptConfig->tMemorySize << DMA_CCR_MSIZE);
+	u32CCR |= ((t_u32)ptConfig->tPriority << DMA_CCR_PL);
+	u32CCR |= ((t_u32)ptConfig->u8Events & DMA_CCR_INTERRUPTS_MASK);
+
+	/* Program the addresses and the counter */
+	DMA1.CHANNEL[tChannel].CPAR = ptConfig->u32PeripheralAddress;
+	DMA1.CHANNEL[tChannel].CMAR = ptConfig->u32MemoryAddress;
+	DMA1.CHANNEL[tChannel].CNDTR = ptConfig->u16Count;
+
+	/* Register the callback and clear any stale flag before applying the configuration */
+	apfDMACallbacks[tChannel] = ptConfig->pfCallback;
+	DMA1.IFCR = DMA_IFCR_CHANNEL_ALL(tChannel);
+	DMA1.CHANNEL[tChannel].CCR = u32CCR;
+
+	/* Enable the vector of the channel only if any event is selected */
+	if ((u32CCR & DMA_CCR_INTERRUPTS_MASK) != 0U)
+	{
+		NVIC_vEnableIRQ((t_NVIC_IRQs)(NVIC_IRQs_DMA1_Channel1 + tChannel));
+	}
+	else
+	{
+		NVIC_vDisableIRQ((t_NVIC_IRQs)(NVIC_IRQs_DMA1_Channel1 + tChannel));
+	}
+}
+
+void DMA_vStartChannel(t_DMA_Channels tChannel)
+{
+	SET_BIT(DMA1.CHANNEL[tChannel].CCR, DMA_CCR_EN);
+}
+
+void DMA_vStopChannel(t_DMA_Channels tChannel)
+{
+	DMA1.CHANNEL[tChannel].CCR &= ~((t_u32)1U << DMA_CCR_EN);
+}
+
+void DMA_vRestartChannel(t_DMA_Channels tChannel, t_u32 u32MemoryAddress, t_u16 u16Count)
+{
+	/* The address and the counter can only be written while the channel is disabled */
+	DMA1.CHANNEL[tChannel].CCR &= ~((t_u32)1U << DMA_CCR_EN);
+	DMA1.CHANNEL[tChannel].CMAR = u32MemoryAddress;
+	DMA1.CHANNEL[tChannel].CNDTR = u16Count;
+	/* Clear the flags of the previous transfer */
+	DMA1.IFCR = DMA_IFCR_CHANNEL_ALL(tChannel);
+	SET_BIT(DMA1.CHANNEL[tChannel].CCR, DMA_CCR_EN);
+}
+
+t_u16 DMA_u16GetRemainingCount(t_DMA_Channels tChannel)
+{
+	return (t_u16)DMA1.CHANNEL[tChannel].CNDTR;
+}
+
+t_bool DMA_bIsChannelEnabled(t_DMA_Channels tChannel)
+{
+	return GET_BIT(DMA1.CHANNEL[tChannel].CCR, DMA_CCR_EN);
+}
+
+void DMA_vSetChannelPriority(t_DMA_Channels tChannel, t_u8 u8Priority)
+{
+	NVIC_vSetPriority((t_NVIC_IRQs)(NVIC_IRQs_DMA1_Channel1 + tChannel), u8Priority);
+}
+
+/**
+ * @brief DMA1 channel 1 interrupt handler
+ */
+RAMFUNC void DMA1_Channel1_IRQHandler(void)
+{
+	DMA_vDispatchChannel(DMA_Channels_1);
+}
+
+/**
+ * @brief DMA1 channel 2 interrupt handler
+ */
+RAMFUNC void DMA1_Channel2_IRQHandler(void)
+{
+	DMA_vDispatchChannel(DMA_Channels_2);
+}
+
+/**
+ * @brief DMA1 channel 3 interrupt handler
+ */
+RAMFUNC void DMA1_Channel3_IRQHandler(void)
+{
+	DMA_vDispatchChannel(DMA_Channels_3);
+}
+
+/**
+ * @brief DMA1 channel 4 interrupt handler
+ */
+RAMFUNC void DMA1_Channel4_IRQHandler(void)
+{
+	DMA_vDispatchChannel(DMA_Channels_4);
+}
+
+/**
+ * @brief DMA1 channel 5 interrupt handler
+ */
+RAMFUNC void DMA1_Channel5_IRQHandler(void)
+{
+	DMA_vDispatchChannel(DMA_Channels_5);
+}
+
+/**
+ * @brief DMA1 channel 6 interrupt handler
+ */
+RAMFUNC void DMA1_Channel6_IRQHandler(void)
+{
+	DMA_vDispatchChannel(DMA_Channels_6);
+}
+
+/**
+ * @brief DMA1 channel 7 interrupt handler
+ */
+RAMFUNC void DMA1_Channel7_IRQHandler(void)
+{
+	DMA_vDispatchChannel(DMA_Channels_7);
+}
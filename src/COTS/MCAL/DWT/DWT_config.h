@@ -0,0 +1,15 @@
+/**
+ * @file DWT_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the DWT module.
+ * @details This file contains the configuration parameters for the DWT module.
+ * @date 2026-10-19
+ */
+
+#ifndef _DWT_CONFIG_H_
+#define _DWT_CONFIG_H_
+
+#include "DWT_interface.h"
+
+#endif /* _DWT_CONFIG_H_ */
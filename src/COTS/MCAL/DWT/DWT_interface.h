@@ -0,0 +1,53 @@
+/**
+ * @file DWT_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the DWT module.
+ * @details This file contains the prototypes of the functions of the DWT module.
+ * @date 2026-10-19
+ */
+
+#ifndef _DWT_INTERFACE_H_
+#define _DWT_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup dwt_module
+ * @{
+ */
+
+/**
+ * @brief This function starts the cycle counter
+ * @details This function enables the trace unit and starts the free-running 32-bit cycle counter from zero,
+ * the counter runs at the system clock frequency and wraps around every 2^32 cycles
+ */
+void DWT_vInit(void);
+
+/**
+ * @brief This function gets the current value of the cycle counter
+ * @details The difference of two readings (computed with unsigned arithmetic) is the elapsed number of cycles,
+ * even if the counter wrapped around once in between
+ * @return The current value of the cycle counter
+ * @see RCC_u32GetSystemClockFrequency
+ */
+t_u32 DWT_u32GetCycleCount(void);
+
+/**
+ * @brief This function gets the duration of the startup code
+ * @details The startup code starts the cycle counter on its first instruction and reads it right before main(),
+ * so the count covers the early clock setup, the `.data` copy, the `.bss` clear and the stack painting
+ * @return The number of the cycles from the reset to main(), 0 if the startup code does not count them
+ * (OS_INCLUDE_STARTUP_CYCLE_COUNT)
+ */
+t_u32 DWT_u32GetStartupCycles(void);
+
+/** @} */
+/** @} */
+
+#endif /* _DWT_INTERFACE_H_ */
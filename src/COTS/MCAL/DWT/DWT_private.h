@@ -0,0 +1,146 @@
+/**
+ * @file DWT_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the DWT module.
+ * @details This file contains the private macros and registers for the DWT module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/DWT
+ * @brief DWT Module
+ * @details This module contains all the APIs related to the Data Watchpoint and Trace unit cycle counter
+ */
+
+#ifndef _DWT_PRIVATE_H_
+#define _DWT_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup dwt_module DWT Module
+ * @brief DWT Module
+ * @details This module contains all the APIs related to the Data Watchpoint and Trace unit cycle counter
+ * @{
+ */
+
+/**
+ * @defgroup dwt_registers DWT Registers
+ * @brief DWT Registers
+ * @{
+ */
+
+/**
+ * @struct t_DWT_RegisterMap
+ * @brief DWT Register Map
+ * @details This type is used to access the DWT profiling registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Control Register
+	 */
+	t_u32 CTRL;
+	/**
+	 * @brief Cycle Count Register
+	 */
+	t_u32 CYCCNT;
+	/**
+	 * @brief CPI Count Register
+	 */
+	t_u32 CPICNT;
+	/**
+	 * @brief Exception Overhead Count Register
+	 */
+	t_u32 EXCCNT;
+	/**
+	 * @brief Sleep Count Register
+	 */
+	t_u32 SLEEPCNT;
+	/**
+	 * @brief LSU Count Register
+	 */
+	t_u32 LSUCNT;
+	/**
+	 * @brief Folded-instruction Count Register
+	 */
+	t_u32 FOLDCNT;
+	/**
+	 * @brief Program Counter Sample Register
+	 * @warning This register is read-only
+	 */
+	t_u32 PCSR;
+} t_DWT_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup dwt_addresses DWT Addresses
+ * @brief DWT Addresses
+ * @details This module contains the addresses of the DWT registers
+ * @{
+ */
+
+/**
+ * @def DWT_BASE_ADDRESS
+ * @brief DWT Base Address in the memory
+ */
+#define DWT_BASE_ADDRESS REGISTER_ADDRESS(0xE0001000, 0)
+
+/**
+ * @def DWT
+ * @brief DWT Register Map
+ */
+#define DWT REGISTER(t_DWT_RegisterMap, DWT_BASE_ADDRESS)
+
+/**
+ * @def DWT_DEMCR
+ * @brief Debug Exception and Monitor Control Register
+ */
+#define DWT_DEMCR REGISTER_U32(REGISTER_ADDRESS(0xE000EDFC, 0))
+
+/** @} */
+
+/**
+ * @defgroup dwt_constants DWT Constants
+ * @brief DWT Constants
+ * @{
+ */
+
+/**
+ * @def DWT_DEMCR_TRCENA
+ * @brief Trace enable bit, it powers the DWT and ITM units
+ */
+#define DWT_DEMCR_TRCENA (24)
+
+/**
+ * @def DWT_CTRL_CYCCNTENA
+ * @brief Cycle counter enable bit
+ */
+#define DWT_CTRL_CYCCNTENA (0)
+
+/** @} */
+
+/**
+ * @defgroup dwt_startup_symbols DWT Startup Symbols
+ * @brief The symbols defined by the startup code
+ * @{
+ */
+
+/**
+ * @brief The number of the cycles from the reset to main()
+ */
+extern t_u32 __startup_cycles;
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _DWT_PRIVATE_H_ */
@@ -0,0 +1,33 @@
+/**
+ * @file DWT_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the DWT module.
+ * @details This file contains the implementation for the DWT module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "DWT_private.h"
+#include "DWT_interface.h"
+#include "DWT_config.h"
+
+void DWT_vInit(void)
+{
+	/* The DWT registers are not accessible until the trace unit is enabled */
+	SET_BIT(DWT_DEMCR, DWT_DEMCR_TRCENA);
+	DWT.CYCCNT = 0U;
+	SET_BIT(DWT.CTRL, DWT_CTRL_CYCCNTENA);
+}
+
+t_u32 DWT_u32GetCycleCount(void)
+{
+	return DWT.CYCCNT;
+}
+
+t_u32 DWT_u32GetStartupCycles(void)
+{
+	return __startup_cycles;
+}
@@ -0,0 +1,15 @@
+/**
+ * @file EXTI_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the EXTI module.
+ * @details This file contains the configuration parameters for the EXTI module.
+ * @date 2026-10-19
+ */
+
+#ifndef _EXTI_CONFIG_H_
+#define _EXTI_CONFIG_H_
+
+#include "EXTI_interface.h"
+
+#endif /* _EXTI_CONFIG_H_ */
@@ -0,0 +1,103 @@
+/**
+ * @file EXTI_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the EXTI module.
+ * @details This file contains the prototypes of the functions of the EXTI module.
+ * @date 2026-10-19
+ */
+
+#ifndef _EXTI_INTERFACE_H_
+#define _EXTI_INTERFACE_H_
+
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../GPIO/GPIO_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup exti_module
+ * @{
+ */
+
+/**
+ * @typedef t_EXTI_Triggers
+ * @brief EXTI Triggers
+ * @details This type is used to select the edge(s) that trigger an EXTI line
+ */
+typedef enum
+{
+	/**
+	 * @brief Trigger on the rising edge
+	 */
+	EXTI_Triggers_Rising = 1,
+	/**
+	 * @brief Trigger on the falling edge
+	 */
+	EXTI_Triggers_Falling,
+	/**
+	 * @brief Trigger on both the rising and the falling edges
+	 */
+	EXTI_Triggers_Both
+} t_EXTI_Triggers;
+
+/**
+ * @typedef t_EXTI_Callback
+ * @brief EXTI Callback
+ * @details This type is used to define the function called from the interrupt context when an EXTI line is triggered
+ */
+typedef P2FUNC(void, t_EXTI_Callback)(void);
+
+/**
+ * @brief This function enables the interrupt of a GPIO pin
+ * @details This function connects the pin to its EXTI line through the AFIO, selects the trigger edge(s), registers the callback and enables the line interrupt in the EXTI and the NVIC
+ * @param[in] tPort The GPIO port
+ * @param[in] tPin The GPIO pin (also the EXTI line number)
+ * @param[in] tTrigger The edge(s) that trigger the interrupt
+ * @param[in] pfCallback The function to be called when the line is triggered
+ * @note The AFIO clock must be enabled and the pin must be configured as input before calling this function
+ * @note Only one port can be connected to each line, i.e. PA3 and PB3 cannot be used at the same time
+ * @see t_GPIO_Ports t_GPIO_Pins t_EXTI_Triggers t_EXTI_Callback
+ */
+void EXTI_vEnablePinInterrupt(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_EXTI_Triggers tTrigger, t_EXTI_Callback pfCallback);
+
+/**
+ * @brief This function disables the interrupt of an EXTI line
+ * @details This function masks the line interrupt in the EXTI, the shared NVIC vector stays enabled for the other lines
+ * @param[in] tPin The GPIO pin (also the EXTI line number)
+ * @see t_GPIO_Pins
+ */
+void EXTI_vDisablePinInterrupt(t_GPIO_Pins tPin);
+
+/**
+ * @brief This function changes the trigger edge(s) of an EXTI line
+ * @details This function changes the trigger edge(s) of an EXTI line
+ * @param[in] tPin The GPIO pin (also the EXTI line number)
+ * @param[in] tTrigger The edge(s) that trigger the interrupt
+ * @see t_GPIO_Pins t_EXTI_Triggers
+ */
+void EXTI_vSetTrigger(t_GPIO_Pins tPin, t_EXTI_Triggers tTrigger);
+
+/**
+ * @brief This function triggers an EXTI line by software
+ * @details This function triggers an EXTI line by software, the line callback is called if its interrupt is enabled
+ * @param[in] tPin The GPIO pin (also the EXTI line number)
+ * @see t_GPIO_Pins
+ */
+void EXTI_vGenerateSoftwareInterrupt(t_GPIO_Pins tPin);
+
+/**
+ * @brief This function clears the pending flag of an EXTI line
+ * @details This function clears the pending flag of an EXTI line
+ * @param[in] tPin The GPIO pin (also the EXTI line number)
+ * @see t_GPIO_Pins
+ */
+void EXTI_vClearPendingFlag(t_GPIO_Pins tPin);
+
+/** @} */
+/** @} */
+
+#endif /* _EXTI_INTERFACE_H_ */
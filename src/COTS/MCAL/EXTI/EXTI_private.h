@@ -0,0 +1,175 @@
+/**
+ * @file EXTI_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the EXTI module.
+ * @details This file contains the private macros and registers for the EXTI module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/EXTI
+ * @brief EXTI Module
+ * @details This module contains all the APIs related to the external interrupts/events controller
+ */
+
+#ifndef _EXTI_PRIVATE_H_
+#define _EXTI_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup exti_module EXTI Module
+ * @brief EXTI Module
+ * @details This module contains all the APIs related to the external interrupts/events controller
+ * @{
+ */
+
+/**
+ * @defgroup exti_registers EXTI Registers
+ * @brief EXTI Registers
+ * @{
+ */
+
+/**
+ * @struct t_EXTI_RegisterMap
+ * @brief EXTI Register Map
+ * @details This type is used to access the EXTI registers, each register holds one bit per line
+ */
+typedef struct
+{
+	/**
+	 * @brief Interrupt Mask Register
+	 */
+	t_u32 IMR;
+	/**
+	 * @brief Event Mask Register
+	 */
+	t_u32 EMR;
+	/**
+	 * @brief Rising Trigger Selection Register
+	 */
+	t_u32 RTSR;
+	/**
+	 * @brief Falling Trigger Selection Register
+	 */
+	t_u32 FTSR;
+	/**
+	 * @brief Software Interrupt Event Register
+	 */
+	t_u32 SWIER;
+	/**
+	 * @brief Pending Register
+	 * @note The bits of this register are cleared by writing `1` to them
+	 */
+	t_u32 PR;
+} t_EXTI_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup exti_addresses EXTI Addresses
+ * @brief EXTI Addresses
+ * @details This module contains the addresses of the EXTI registers
+ * @{
+ */
+
+/**
+ * @def EXTI_BASE_ADDRESS
+ * @brief EXTI Base Address in the memory
+ */
+#define EXTI_BASE_ADDRESS REGISTER_ADDRESS(0x40010400, 0)
+
+/**
+ * @def EXTI
+ * @brief EXTI Register Map
+ */
+#define EXTI REGISTER(t_EXTI_RegisterMap, EXTI_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup exti_constants EXTI Constants
+ * @brief EXTI Constants
+ * @{
+ */
+
+/**
+ * @def EXTI_GPIO_LINES_COUNT
+ * @brief Number of EXTI lines that can be connected to the GPIO pins
+ */
+#define EXTI_GPIO_LINES_COUNT (16)
+
+/**
+ * @def EXTI_LINE_MASK
+ * @brief Get the bit mask of a certain EXTI line
+ * @param[in] LINE The EXTI line number
+ */
+#define EXTI_LINE_MASK(LINE) ((t_u32)1U << (LINE))
+
+/**
+ * @def EXTI_LINES_9_5_MASK
+ * @brief Mask of the EXTI lines sharing the EXTI9_5 interrupt vector
+ */
+#define EXTI_LINES_9_5_MASK ((t_u32)0x000003E0U)
+
+/**
+ * @def EXTI_LINES_15_10_MASK
+ * @brief Mask of the EXTI lines sharing the EXTI15_10 interrupt vector
+ */
+#define EXTI_LINES_15_10_MASK ((t_u32)0x0000FC00U)
+
+/** @} */
+
+/**
+ * @defgroup exti_handlers EXTI Interrupt Handlers
+ * @brief The interrupt handlers of the EXTI module, they are referenced by the vector table
+ * @{
+ */
+
+/**
+ * @brief EXTI line 0 interrupt handler
+ */
+void EXTI0_IRQHandler(void);
+
+/**
+ * @brief EXTI line 1 interrupt handler
+ */
+void EXTI1_IRQHandler(void);
+
+/**
+ * @brief EXTI line 2 interrupt handler
+ */
+void EXTI2_IRQHandler(void);
+
+/**
+ * @brief EXTI line 3 interrupt handler
+ */
+void EXTI3_IRQHandler(void);
+
+/**
+ * @brief EXTI line 4 interrupt handler
+ */
+void EXTI4_IRQHandler(void);
+
+/**
+ * @brief EXTI lines 5 to 9 interrupt handler
+ */
+void EXTI9_5_IRQHandler(void);
+
+/**
+ * @brief EXTI lines 10 to 15 interrupt handler
+ */
+void EXTI15_10_IRQHandler(void);
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _EXTI_PRIVATE_H_ */
@@ -0,0 +1,200 @@
+/**
+ * @file EXTI_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the EXTI module.
+ * @details This file contains the implementation for the EXTI module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../AFIO/AFIO_interface.h"
+#include "../NVIC/NVIC_interface.h"
+#include "EXTI_private.h"
+#include "EXTI_interface.h"
+#include "EXTI_config.h"
+
+/**
+ * @brief The callbacks of the GPIO EXTI lines
+ */
+STATIC t_EXTI_Callback apfEXTICallbacks[EXTI_GPIO_LINES_COUNT] = {NULL};
+
+/**
+ * @brief This function gets the NVIC interrupt that serves an EXTI line
+ * @details Lines 0 to 4 have their own vectors, lines 5 to 9 and 10 to 15 share one vector each
+ * @param[in] tPin The EXTI line number
+ * @return t_NVIC_IRQs The NVIC interrupt of the line
+ */
+STATIC t_NVIC_IRQs EXTI_tGetLineIRQ(t_GPIO_Pins tPin)
+{
+	t_NVIC_IRQs tIRQ;
+
+	if (tPin <= GPIO_Pins_4)
+	{
+		tIRQ = (t_NVIC_IRQs)(NVIC_IRQs_EXTI0 + tPin);
+	}
+	else if (tPin <= GPIO_Pins_9)
+	{
+		tIRQ = NVIC_IRQs_EXTI9_5;
+	}
+	else
+	{
+		tIRQ = NVIC_IRQs_EXTI15_10;
+	}
+
+	return tIRQ;
+}
+
+/**
+ * @brief This function dispatches the callbacks of the pending lines of an interrupt vector
+ * @details The pending bits are scanned with a count-trailing-zeros instruction, so only the lines that fired are visited.
+ * The pending flags are cleared before calling the callbacks so that an edge arriving during a callback is not lost.
+ * The dispatcher and the interrupt handlers run from the SRAM (RAMFUNC) to avoid the flash wait states.
+ * @param[in] u32LinesMask The mask of the lines served by the interrupt vector
+ */
+STATIC RAMFUNC void EXTI_vDispatchLines(t_u32 u32LinesMask)
+{
+	/* Get the enabled pending lines of this vector */
+	t_u32 u32PendingLines = EXTI.PR & EXTI.IMR & u32LinesMask;
+	/* Store the line being served */
+	t_u8 u8Line = 0;
+
+	/* Clear the pending flags (write 1 to clear) */
+	EXTI.PR = u32PendingLines;
+
+	while (u32PendingLines != 0U)
+	{
+		/* Get the lowest pending line and remove it from the pending lines */
+		u8Line = CPU_CTZ(u32PendingLines);
+		u32PendingLines &= (u32PendingLines - 1U);
+
+		if (apfEXTICallbacks[u8Line] != NULL)
+		{
+			apfEXTICallbacks[u8Line]();
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+}
+
+void EXTI_vEnablePinInterrupt(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_EXTI_Triggers tTrigger, t_EXTI_Callback pfCallback)
+{
+	/* Mask the line while it is being configured */
+	EXTI.IMR &= ~EXTI_LINE_MASK(tPin);
+	/* Register the callback of the line */
+	apfEXTICallbacks[tPin] = pfCallback;
+	/* Connect the pin to the line */
+	AFIO_vSetEXTIPort(tPort, tPin);
+	/* Select the trigger edge(s) */
+	EXTI_vSetTrigger(tPin, tTrigger);
+	/* Clear any stale pending flag */
+	EXTI.PR = EXTI_LINE_MASK(tPin);
+	/* Unmask the line interrupt */
+	SET_BIT(EXTI.IMR, tPin);
+	/* Enable the vector of the line */
+	NVIC_vEnableIRQ(EXTI_tGetLineIRQ(tPin));
+}
+
+void EXTI_vDisablePinInterrupt(t_GPIO_Pins tPin)
+{
+	/* Mask the line interrupt */
+	EXTI.IMR &= ~EXTI_LINE_MASK(tPin);
+	/* Clear any pending flag of the line */
+	EXTI.PR = EXTI_LINE_MASK(tPin);
+}
+
+void EXTI_vSetTrigger(t_GPIO_Pins tPin, t_EXTI_Triggers tTrigger)
+{
+	/* Select the rising edge trigger */
+	if ((tTrigger & EXTI_Triggers_Rising) != 0)
+	{
+		SET_BIT(EXTI.RTSR, tPin);
+	}
+	else
+	{
+		EXTI.RTSR &= ~EXTI_LINE_MASK(tPin);
+	}
+
+	/* Select the falling edge trigger */
+	if ((tTrigger & EXTI_Triggers_Falling) != 0)
+	{
+		SET_BIT(EXTI.FTSR, tPin);
+	}
+	else
+	{
+		EXTI.FTSR &= ~EXTI_LINE_MASK(tPin);
+	}
+}
+
+void EXTI_vGenerateSoftwareInterrupt(t_GPIO_Pins tPin)
+{
+	/* The bit is cleared by hardware when the pending flag is cleared */
+	EXTI.SWIER = EXTI_LINE_MASK(tPin);
+}
+
+void EXTI_vClearPendingFlag(t_GPIO_Pins tPin)
+{
+	EXTI.PR = EXTI_LINE_MASK(tPin);
+}
+
+/**
+ * @brief EXTI line 0 interrupt handler
+ */
+RAMFUNC void EXTI0_IRQHandler(void)
+{
+	EXTI_vDispatchLines(EXTI_LINE_MASK(GPIO_Pins_0));
+}
+
+/**
+ * @brief EXTI line 1 interrupt handler
+ */
+RAMFUNC void EXTI1_IRQHandler(void)
+{
+	EXTI_vDispatchLines(EXTI_LINE_MASK(GPIO_Pins_1));
+}
+
+/**
+ * @brief EXTI line 2 interrupt handler
+ */
+RAMFUNC void EXTI2_IRQHandler(void)
+{
+	EXTI_vDispatchLines(EXTI_LINE_MASK(GPIO_Pins_2));
+}
+
+/**
+ * @brief EXTI line 3 interrupt handler
+ */
+RAMFUNC void EXTI3_IRQHandler(void)
+{
+	EXTI_vDispatchLines(EXTI_LINE_MASK(GPIO_Pins_3));
+}
+
+/**
+ * @brief EXTI line 4 interrupt handler
+ */
+RAMFUNC void EXTI4_IRQHandler(void)
+{
+	EXTI_vDispatchLines(EXTI_LINE_MASK(GPIO_Pins_4));
+}
+
+/**
+ * @brief EXTI lines 5 to 9 interrupt handler
+ */
+RAMFUNC void EXTI9_5_IRQHandler(void)
+{
+	EXTI_vDispatchLines(EXTI_LINES_9_5_MASK);
+}
+
+/**
+ * @brief EXTI lines 10 to 15 interrupt handler
+ */
+RAMFUNC void EXTI15_10_IRQHandler(void)
+{
+	EXTI_vDispatchLines(EXTI_LINES_15_10_MASK);
+}
@@ -0,0 +1,41 @@
+/**
+ * @file FLASH_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the FLASH module.
+ * @details This file contains the configuration parameters for the FLASH module.
+ * @date 2026-10-19
+ */
+
+#ifndef _FLASH_CONFIG_H_
+#define _FLASH_CONFIG_H_
+
+#include "FLASH_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup flash_module
+ * @{
+ */
+
+/**
+ * @defgroup flash_config FLASH Configuration
+ * @brief This group contains the configuration parameters of the FLASH module
+ * @{
+ */
+
+/**
+ * @def FLASH_SIZE
+ * @brief This macro defines the size of the main flash memory in bytes (64 KiB for the STM32F103C8)
+ */
+#define FLASH_SIZE ((t_u32)65536U)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _FLASH_CONFIG_H_ */
@@ -0,0 +1,135 @@
+/**
+ * @file FLASH_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the FLASH module.
+ * @details This file contains the prototypes of the functions of the FLASH module.
+ * @date 2026-10-19
+ */
+
+#ifndef _FLASH_INTERFACE_H_
+#define _FLASH_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup flash_module
+ * @{
+ */
+
+/**
+ * @def FLASH_PAGE_SIZE
+ * @brief The number of the bytes of an erase page (medium-density devices)
+ */
+#define FLASH_PAGE_SIZE ((t_u32)1024U)
+
+/**
+ * @enum t_FLASH_Latency
+ * @brief FLASH Latency
+ * @details This type is used to select the number of the wait states of the flash reads
+ */
+typedef enum
+{
+	/**
+	 * @brief Zero wait state, for a system clock up to 24 MHz
+	 */
+	FLASH_Latency_ZeroWaitState = 0,
+	/**
+	 * @brief One wait state, for a system clock up to 48 MHz
+	 */
+	FLASH_Latency_OneWaitState,
+	/**
+	 * @brief Two wait states, for a system clock up to 72 MHz
+	 */
+	FLASH_Latency_TwoWaitStates
+} t_FLASH_Latency;
+
+/**
+ * @enum t_FLASH_Status
+ * @brief FLASH Status
+ * @details This type is used to report the result of an erase, a programming or a verification
+ */
+typedef enum
+{
+	/**
+	 * @brief The operation succeeded
+	 */
+	FLASH_Status_OK = 0,
+	/**
+	 * @brief The range is not half-word aligned or not in the main flash memory, nothing is done
+	 */
+	FLASH_Status_AddressError,
+	/**
+	 * @brief A half-word that is not erased was programmed with another value
+	 */
+	FLASH_Status_ProgrammingError,
+	/**
+	 * @brief The page is write protected by the option bytes
+	 */
+	FLASH_Status_WriteProtectionError,
+	/**
+	 * @brief The content of the flash does not match the data
+	 */
+	FLASH_Status_VerifyError
+} t_FLASH_Status;
+
+/**
+ * @brief This function sets the number of the wait states of the flash reads
+ * @param[in] tLatency The number of the wait states
+ * @warning The latency must be raised before the system clock and lowered after it
+ */
+void FLASH_vSetLatency(t_FLASH_Latency tLatency);
+
+/**
+ * @brief This function unlocks the erase and programming operations
+ */
+void FLASH_vUnlock(void);
+
+/**
+ * @brief This function locks the erase and programming operations again
+ */
+void FLASH_vLock(void);
+
+/**
+ * @brief This function erases the page that contains an address
+ * @param[in] u32Address Any address in the page
+ * @return The status of the erase
+ * @note This function runs from the SRAM (RAMFUNC), it takes 20 to 40 ms
+ * @warning The flash must be unlocked
+ */
+t_FLASH_Status FLASH_tErasePage(t_u32 u32Address);
+
+/**
+ * @brief This function programs half-words
+ * @details The programming mode is entered once for the whole block and the half-words that already hold their value
+ * are skipped, so an erased area only costs the non-blank data (about 52 us per programmed half-word)
+ * @param[in] u32Address The address of the first half-word (half-word aligned)
+ * @param[in] pu16Data The half-words
+ * @param[in] u32HalfWords The number of the half-words
+ * @return The status of the programming, it stops at the first error
+ * @note This function runs from the SRAM (RAMFUNC)
+ * @warning The flash must be unlocked and the data must not be in the programmed flash range
+ */
+t_FLASH_Status FLASH_tProgram(t_u32 u32Address, P2CONST(t_u16) pu16Data, t_u32 u32HalfWords);
+
+/**
+ * @brief This function checks the content of the flash against the data with the CRC unit
+ * @param[in] u32Address The address of the first half-word (half-word aligned)
+ * @param[in] pu16Data The half-words
+ * @param[in] u32HalfWords The number of the half-words
+ * @return FLASH_Status_OK if the CRCs match, FLASH_Status_VerifyError if they do not, FLASH_Status_AddressError if the
+ * range is not valid
+ * @note The CRC unit must be initialized (CRC_vInit())
+ */
+t_FLASH_Status FLASH_tVerify(t_u32 u32Address, P2CONST(t_u16) pu16Data, t_u32 u32HalfWords);
+
+/** @} */
+/** @} */
+
+#endif /* _FLASH_INTERFACE_H_ */
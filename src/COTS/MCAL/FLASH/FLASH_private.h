@@ -0,0 +1,220 @@
+/**
+ * @file FLASH_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the FLASH module.
+ * @details This file contains the private macros and registers for the FLASH module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/FLASH
+ * @brief FLASH Module
+ * @details This module contains all the APIs related to the flash memory interface
+ */
+
+#ifndef _FLASH_PRIVATE_H_
+#define _FLASH_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup flash_module FLASH Module
+ * @brief FLASH Module
+ * @details This module contains all the APIs related to the flash memory interface. The erase and program loops run from
+ * the SRAM: the flash cannot be read while it is erased or programmed, so the code that polls the busy flag must not be
+ * fetched from it. The interrupts stay enabled, a handler and a vector table that are in the SRAM (RAMFUNC and
+ * NVIC_VECTOR_TABLE_IN_RAM) are served during the operation while a handler in the flash waits until it is done
+ * @{
+ */
+
+/**
+ * @defgroup flash_registers FLASH Registers
+ * @brief FLASH Registers
+ * @{
+ */
+
+/**
+ * @struct t_FLASH_RegisterMap
+ * @brief FLASH Register Map
+ * @details This type is used to access the flash memory interface registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Access Control Register
+	 */
+	t_u32 ACR;
+	/**
+	 * @brief Key Register
+	 * @warning This register is write-only
+	 */
+	t_u32 KEYR;
+	/**
+	 * @brief Option Byte Key Register
+	 * @warning This register is write-only
+	 */
+	t_u32 OPTKEYR;
+	/**
+	 * @brief Status Register
+	 */
+	t_u32 SR;
+	/**
+	 * @brief Control Register
+	 */
+	t_u32 CR;
+	/**
+	 * @brief Address Register
+	 * @warning This register is write-only
+	 */
+	t_u32 AR;
+	/**
+	 * @brief Reserved
+	 */
+	t_u32 RESERVED;
+	/**
+	 * @brief Option Byte Register
+	 * @warning This register is read-only
+	 */
+	t_u32 OBR;
+	/**
+	 * @brief Write Protection Register
+	 * @warning This register is read-only
+	 */
+	t_u32 WRPR;
+} t_FLASH_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup flash_addresses FLASH Addresses
+ * @brief FLASH Addresses
+ * @details This module contains the addresses of the FLASH registers
+ * @{
+ */
+
+/**
+ * @def FLASH_BASE_ADDRESS
+ * @brief FLASH Base Address in the memory
+ */
+#define FLASH_BASE_ADDRESS REGISTER_ADDRESS(0x40022000, 0)
+
+/**
+ * @def FLASH
+ * @brief FLASH Register Map
+ */
+#define FLASH REGISTER(t_FLASH_RegisterMap, FLASH_BASE_ADDRESS)
+
+/**
+ * @def FLASH_MEMORY_ADDRESS
+ * @brief The address of the first byte of the main flash memory
+ */
+#define FLASH_MEMORY_ADDRESS ((t_u32)0x08000000U)
+
+/** @} */
+
+/**
+ * @defgroup flash_constants FLASH Constants
+ * @brief FLASH Constants
+ * @{
+ */
+
+/**
+ * @def FLASH_KEY1
+ * @brief The first key of the unlock sequence
+ */
+#define FLASH_KEY1 ((t_u32)0x45670123U)
+
+/**
+ * @def FLASH_KEY2
+ * @brief The second key of the unlock sequence
+ */
+#define FLASH_KEY2 ((t_u32)0xCDEF89ABU)
+
+/**
+ * @def FLASH_ACR_LATENCY_MASK
+ * @brief Mask of the wait states field in the ACR register
+ */
+#define FLASH_ACR_LATENCY_MASK ((t_u32)0x7U)
+
+/**
+ * @def FLASH_SR_BSY
+ * @brief Set while an operation is in progress
+ */
+#define FLASH_SR_BSY (0)
+
+/**
+ * @def FLASH_SR_PGERR
+ * @brief Set when a location that is not erased is programmed, cleared by writing 1
+ */
+#define FLASH_SR_PGERR (2)
+
+/**
+ * @def FLASH_SR_WRPRTERR
+ * @brief Set when a write protected location is erased or programmed, cleared by writing 1
+ */
+#define FLASH_SR_WRPRTERR (4)
+
+/**
+ * @def FLASH_SR_EOP
+ * @brief Set at the end of an operation, cleared by writing 1
+ */
+#define FLASH_SR_EOP (5)
+
+/**
+ * @def FLASH_SR_FLAGS_MASK
+ * @brief All the flags of the SR register that are cleared by writing 1
+ */
+#define FLASH_SR_FLAGS_MASK (((t_u32)1 << FLASH_SR_PGERR) | ((t_u32)1 << FLASH_SR_WRPRTERR) | ((t_u32)1 << FLASH_SR_EOP))
+
+/**
+ * @def FLASH_CR_PG
+ * @brief Programming bit, the half-word writes to the flash program it while set
+ */
+#define FLASH_CR_PG (0)
+
+/**
+ * @def FLASH_CR_PER
+ * @brief Page erase bit
+ */
+#define FLASH_CR_PER (1)
+
+/**
+ * @def FLASH_CR_STRT
+ * @brief Start bit of an erase
+ */
+#define FLASH_CR_STRT (6)
+
+/**
+ * @def FLASH_CR_LOCK
+ * @brief Lock bit, it is cleared by the unlock sequence
+ */
+#define FLASH_CR_LOCK (7)
+
+/**
+ * @def FLASH_ERASED_HALF_WORD
+ * @brief The value of an erased half-word
+ */
+#define FLASH_ERASED_HALF_WORD ((t_u16)0xFFFFU)
+
+/**
+ * @def FLASH_IS_RANGE_VALID
+ * @brief Check whether a range of bytes is half-word aligned and lies in the main flash memory
+ * @param[in] ADDRESS The address of the first byte
+ * @param[in] BYTES The number of the bytes
+ */
+#define FLASH_IS_RANGE_VALID(ADDRESS, BYTES)                                                                 \
+	((((ADDRESS) & 1U) == 0U) && ((ADDRESS) >= FLASH_MEMORY_ADDRESS) && ((ADDRESS) < (FLASH_MEMORY_ADDRESS + FLASH_SIZE)) && \
+	 ((BYTES) <= ((FLASH_MEMORY_ADDRESS + FLASH_SIZE) - (ADDRESS))))
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _FLASH_PRIVATE_H_ */
@@ -0,0 +1,195 @@
+/**
+ * @file FLASH_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the FLASH module.
+ * @details This file contains the implementation for the FLASH module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../CRC/CRC_interface.h"
+#include "FLASH_private.h"
+#include "FLASH_interface.h"
+#include "FLASH_config.h"
+
+/**
+ * @brief This function waits for the end of an operation and takes its error flags
+ * @return The status of the operation
+ * @note This function runs from the SRAM (RAMFUNC), the flash cannot be read until the operation is done
+ */
+STATIC RAMFUNC t_FLASH_Status FLASH_tWaitReady(void)
+{
+	t_FLASH_Status tStatus = FLASH_Status_OK;
+
+	while (GET_BIT(FLASH.SR, FLASH_SR_BSY) != 0U)
+		;
+
+	if (GET_BIT(FLASH.SR, FLASH_SR_WRPRTERR) != 0U)
+	{
+		tStatus = FLASH_Status_WriteProtectionError;
+	}
+	else if (GET_BIT(FLASH.SR, FLASH_SR_PGERR) != 0U)
+	{
+		tStatus = FLASH_Status_ProgrammingError;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	FLASH.SR = FLASH_SR_FLAGS_MASK;
+
+	return tStatus;
+}
+
+/**
+ * @brief This function computes the CRC of half-words
+ * @param[in] pu16Data The half-words
+ * @param[in] u32HalfWords The number of the half-words, an odd last one is padded with an erased half-word
+ * @return The CRC of the half-words
+ */
+STATIC t_u32 FLASH_u32GetCRC(P2CONST(t_u16) pu16Data, t_u32 u32HalfWords)
+{
+	t_u32 u32CRC = 0;
+	t_u32 u32Word = 0;
+	t_u32 u32Index = 0;
+
+	CRC_vReset();
+
+	if (((t_u32)pu16Data & 3U) == 0U)
+	{
+		/* Word aligned data is fed straight from the memory */
+		u32CRC = CRC_u32Accumulate((P2CONST(t_u32))pu16Data, u32HalfWords / 2U);
+	}
+	else
+	{
+		for (u32Index = 0; u32Index < (u32HalfWords / 2U); u32Index++)
+		{
+			u32Word = (t_u32)pu16Data[2U * u32Index] | ((t_u32)pu16Data[(2U * u32Index) + 1U] << 16);
+			u32CRC = CRC_u32Accumulate(&u32Word, 1U);
+		}
+	}
+
+	if ((u32HalfWords & 1U) != 0U)
+	{
+		u32Word = (t_u32)pu16Data[u32HalfWords - 1U] | ((t_u32)FLASH_ERASED_HALF_WORD << 16);
+		u32CRC = CRC_u32Accumulate(&u32Word, 1U);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return u32CRC;
+}
+
+void FLASH_vSetLatency(t_FLASH_Latency tLatency)
+{
+	FLASH.ACR = (FLASH.ACR & ~FLASH_ACR_LATENCY_MASK) | (t_u32)tLatency;
+}
+
+void FLASH_vUnlock(void)
+{
+	if (GET_BIT(FLASH.CR, FLASH_CR_LOCK) != 0U)
+	{
+		FLASH.KEYR = FLASH_KEY1;
+		FLASH.KEYR = FLASH_KEY2;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+void FLASH_vLock(void)
+{
+	SET_BIT(FLASH.CR, FLASH_CR_LOCK);
+}
+
+RAMFUNC t_FLASH_Status FLASH_tErasePage(t_u32 u32Address)
+{
+	t_FLASH_Status tStatus = FLASH_Status_AddressError;
+
+	if ((u32Address >= FLASH_MEMORY_ADDRESS) && (u32Address < (FLASH_MEMORY_ADDRESS + FLASH_SIZE)))
+	{
+		/* Take the flags of an earlier operation away first */
+		(void)FLASH_tWaitReady();
+
+		SET_BIT(FLASH.CR, FLASH_CR_PER);
+		FLASH.AR = u32Address;
+		SET_BIT(FLASH.CR, FLASH_CR_STRT);
+		tStatus = FLASH_tWaitReady();
+		FLASH.CR &= ~((t_u32)1U << FLASH_CR_PER);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return tStatus;
+}
+
+RAMFUNC t_FLASH_Status FLASH_tProgram(t_u32 u32Address, P2CONST(t_u16) pu16Data, t_u32 u32HalfWords)
+{
+	t_FLASH_Status tStatus = FLASH_Status_AddressError;
+	t_u32 u32Index = 0;
+
+	if ((u32HalfWords <= (FLASH_SIZE / 2U)) && FLASH_IS_RANGE_VALID(u32Address, 2U * u32HalfWords))
+	{
+		/* Take the flags of an earlier operation away first */
+		(void)FLASH_tWaitReady();
+		tStatus = FLASH_Status_OK;
+
+		/* Stay in the programming mode for the whole block, each half-word write starts its own programming */
+		SET_BIT(FLASH.CR, FLASH_CR_PG);
+
+		for (u32Index = 0; (u32Index < u32HalfWords) && (tStatus == FLASH_Status_OK); u32Index++)
+		{
+			/* A half-word that already holds its value costs a read instead of a programming */
+			if (REGISTER_U16(u32Address + (2U * u32Index)) != pu16Data[u32Index])
+			{
+				REGISTER_U16(u32Address + (2U * u32Index)) = pu16Data[u32Index];
+				tStatus = FLASH_tWaitReady();
+			}
+			else
+			{
+				/* Do nothing */
+			}
+		}
+
+		FLASH.CR &= ~((t_u32)1U << FLASH_CR_PG);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return tStatus;
+}
+
+t_FLASH_Status FLASH_tVerify(t_u32 u32Address, P2CONST(t_u16) pu16Data, t_u32 u32HalfWords)
+{
+	t_FLASH_Status tStatus = FLASH_Status_AddressError;
+
+	if ((u32HalfWords <= (FLASH_SIZE / 2U)) && FLASH_IS_RANGE_VALID(u32Address, 2U * u32HalfWords))
+	{
+		if (FLASH_u32GetCRC((P2CONST(t_u16))u32Address, u32HalfWords) == FLASH_u32GetCRC(pu16Data, u32HalfWords))
+		{
+			tStatus = FLASH_Status_OK;
+		}
+		else
+		{
+			tStatus = FLASH_Status_VerifyError;
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return tStatus;
+}
@@ -10,6 +10,8 @@
 #ifndef _GPIO_INTERFACE_H_
 #define _GPIO_INTERFACE_H_
 
+#include "../../LIB/LSTD_TYPES.h"
+
 /**
  * @addtogroup mcal
  * @{
@@ -259,6 +261,7 @@ void GPIO_vSetPinOutputType(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_GPIO_Output_
  * @param[in] tPin The GPIO pin
  * @param[in] tValue The GPIO pin value
  * @see t_GPIO_Ports t_GPIO_Pins t_GPIO_Value
+ * @note This function runs from the SRAM (RAMFUNC)
  */
 void GPIO_vSetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_GPIO_Value tValue);
 
@@ -269,9 +272,44 @@ void GPIO_vSetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_GPIO_Value tValue
  * @param[in] tPin The GPIO pin
  * @return The GPIO pin value
  * @see t_GPIO_Ports t_GPIO_Pins t_GPIO_Value
+ * @note This function runs from the SRAM (RAMFUNC)
  */
 t_GPIO_Value GPIO_tGetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin);
 
+/**
+ * @def GPIO_BSRR_SET(PIN)
+ * @brief Get the BSRR word that sets a pin (drives it high)
+ * @details BSRR words of different pins can be ORed to change several pins of a port in one write
+ * @param[in] PIN The GPIO pin
+ */
+#define GPIO_BSRR_SET(PIN) ((t_u32)1U << (PIN))
+
+/**
+ * @def GPIO_BSRR_RESET(PIN)
+ * @brief Get the BSRR word that resets a pin (drives it low)
+ * @details BSRR words of different pins can be ORed to change several pins of a port in one write
+ * @param[in] PIN The GPIO pin
+ */
+#define GPIO_BSRR_RESET(PIN) ((t_u32)1U << ((PIN) + 16U))
+
+/**
+ * @brief This function is used to get the address of the bit set/reset register of a GPIO port
+ * @details This function is used to get the address that a DMA channel writes BSRR words to
+ * @param[in] tPort The GPIO port
+ * @return The address of the BSRR register of the port
+ * @see t_GPIO_Ports GPIO_BSRR_SET GPIO_BSRR_RESET
+ */
+t_u32 GPIO_u32GetBSRRAddress(t_GPIO_Ports tPort);
+
+/**
+ * @brief This function is used to get the address of the input data register of a GPIO port
+ * @details This function is used to get the address that a DMA channel samples the port pins from
+ * @param[in] tPort The GPIO port
+ * @return The address of the IDR register of the port
+ * @see t_GPIO_Ports
+ */
+t_u32 GPIO_u32GetIDRAddress(t_GPIO_Ports tPort);
+
 /** @} */
 /** @} */
 #endif /* _GPIO_INTERFACE_H_ */
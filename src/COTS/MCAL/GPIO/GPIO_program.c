@@ -29,7 +29,7 @@
  * @param[in] tPort The GPIO port to get its base address
  * @param[out] ppu32PortBaseAddress The base address of the GPIO port
  */
-STATIC void GPIO_vGetPortAddress(t_GPIO_Ports tPort, P2VAR(P2VAR(t_GPIOx_RegisterMap)) ppu32PortBaseAddress)
+STATIC RAMFUNC void GPIO_vGetPortAddress(t_GPIO_Ports tPort, P2VAR(P2VAR(t_GPIOx_RegisterMap)) ppu32PortBaseAddress)
 {
 	P2VAR(VOLATILE t_GPIOx_RegisterMap)
 	pu32PortBaseAddress = (P2VAR(t_GPIOx_RegisterMap))NULL;
@@ -171,7 +171,7 @@ void GPIO_vSetPinOutputType(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_GPIO_Output_
 	*pu32TargetPinModeConfig = (*pu32TargetPinModeConfig & PIN_RESET_CONFIGURATIONS_MASK(u8PinSpan)) | (t_u32)(tOutputType << (u8PinSpan + PIN_CONFIGURATION_BITS_SHIFT_VALUE));
 }
 
-void GPIO_vSetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_GPIO_Value tValue)
+RAMFUNC void GPIO_vSetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_GPIO_Value tValue)
 {
 	/* Get the pin location (the number of bits to shift to reach the target pin) */
 	t_u32 u32PinLocation = tPin;
@@ -195,7 +195,7 @@ void GPIO_vSetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin, t_GPIO_Value tValue
 	pu32PortBaseAddress->BSRR = (t_u32)(TRUE << u32PinLocation);
 }
 
-t_GPIO_Value GPIO_tGetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin)
+RAMFUNC t_GPIO_Value GPIO_tGetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin)
 {
 	/* Store the base address of the GPIO port */
 	P2VAR(t_GPIOx_RegisterMap)
@@ -207,3 +207,27 @@ t_GPIO_Value GPIO_tGetPinValue(t_GPIO_Ports tPort, t_GPIO_Pins tPin)
 	/* Get the value of the pin */
 	return (t_GPIO_Value)((pu32PortBaseAddress->IDR >> tPin) & TRUE);
 }
+
+t_u32 GPIO_u32GetBSRRAddress(t_GPIO_Ports tPort)
+{
+	/* Store the base address of the GPIO port */
+	P2VAR(t_GPIOx_RegisterMap)
+	pu32PortBaseAddress = (P2VAR(t_GPIOx_RegisterMap))NULL;
+
+	/* Get the base address of the GPIO port */
+	GPIO_vGetPortAddress(tPort, &pu32PortBaseAddress);
+
+	return (t_u32)&pu32PortBaseAddress->BSRR;
+}
+
+t_u32 GPIO_u32GetIDRAddress(t_GPIO_Ports tPort)
+{
+	/* Store the base address of the GPIO port */
+	P2VAR(t_GPIOx_RegisterMap)
+	pu32PortBaseAddress = (P2VAR(t_GPIOx_RegisterMap))NULL;
+
+	/* Get the base address of the GPIO port */
+	GPIO_vGetPortAddress(tPort, &pu32PortBaseAddress);
+
+	return (t_u32)&pu32PortBaseAddress->IDR;
+}
@@ -0,0 +1,53 @@
+/**
+ * @file I2C_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the I2C module.
+ * @details This file contains the configuration parameters for the I2C module.
+ * @date 2026-10-19
+ */
+
+#ifndef _I2C_CONFIG_H_
+#define _I2C_CONFIG_H_
+
+#include "I2C_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup i2c_module
+ * @{
+ */
+
+/**
+ * @defgroup i2c_config I2C Configuration
+ * @brief This group contains the configuration parameters of the I2C module
+ * @{
+ */
+
+/**
+ * @def I2C_IRQ_PRIORITY
+ * @brief This macro defines the NVIC priority of the I2C event, error and DMA interrupts
+ * @details This macro defines the NVIC priority of the I2C event, error and DMA interrupts (0 to 15).
+ * The address and the last bytes of a read have timing constraints, so it should be higher than the other peripherals
+ */
+#define I2C_IRQ_PRIORITY (1)
+
+/**
+ * @def I2C_DMA_READ_THRESHOLD
+ * @brief This macro defines the minimum read length served by DMA
+ * @details Reads of at least this number of bytes are moved by the DMA instead of one interrupt per byte.
+ * Options:
+ * 	- 0: DMA is not used
+ * 	- 2 to 65535: The minimum read length served by DMA
+ */
+#define I2C_DMA_READ_THRESHOLD (4)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _I2C_CONFIG_H_ */
@@ -0,0 +1,163 @@
+/**
+ * @file I2C_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the I2C module.
+ * @details This file contains the prototypes of the functions of the I2C module.
+ * @date 2026-10-19
+ */
+
+#ifndef _I2C_INTERFACE_H_
+#define _I2C_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup i2c_module
+ * @{
+ */
+
+/**
+ * @typedef t_I2C_Peripherals
+ * @brief I2C Peripherals
+ * @details This type is used to select an I2C peripheral
+ */
+typedef enum
+{
+	/**
+	 * @brief I2C1, SCL: PB6, SDA: PB7
+	 */
+	I2C_Peripherals_I2C1 = 0,
+	/**
+	 * @brief I2C2, SCL: PB10, SDA: PB11
+	 */
+	I2C_Peripherals_I2C2
+} t_I2C_Peripherals;
+
+/**
+ * @typedef t_I2C_Status
+ * @brief I2C Transaction Status
+ * @details This type is used to report the result of a transaction
+ */
+typedef enum
+{
+	/**
+	 * @brief The transaction is queued or in progress
+	 */
+	I2C_Status_Pending = 0,
+	/**
+	 * @brief The transaction is done
+	 */
+	I2C_Status_Done,
+	/**
+	 * @brief The slave did not acknowledge its address or a written byte
+	 */
+	I2C_Status_Nack,
+	/**
+	 * @brief A misplaced start or stop condition was detected on the bus
+	 */
+	I2C_Status_BusError,
+	/**
+	 * @brief Another master took the bus
+	 */
+	I2C_Status_ArbitrationLost
+} t_I2C_Status;
+
+/**
+ * @struct s_I2C_Transaction
+ * @brief I2C Transaction
+ * @details This type describes one transaction: a write, a read, or a write then a read with a repeated start.
+ * It is owned by the caller and linked in the queue of the peripheral until its callback is called
+ */
+typedef struct s_I2C_Transaction
+{
+	/**
+	 * @brief The bytes to write (e.g. the register address of a sensor)
+	 */
+	P2CONST(t_u8) pu8TxData;
+	/**
+	 * @brief The buffer of the read bytes
+	 */
+	P2VAR(t_u8) pu8RxData;
+	/**
+	 * @brief The function called when the transaction ends (can be NULL)
+	 */
+	P2FUNC(void, pfCallback)(P2VAR(struct s_I2C_Transaction) ptTransaction);
+	/**
+	 * @brief The next transaction in the queue
+	 * @warning This field is used by the driver
+	 */
+	P2VAR(struct s_I2C_Transaction) ptNext;
+	/**
+	 * @brief The number of bytes to write (0 for a read-only transaction)
+	 */
+	t_u16 u16TxLength;
+	/**
+	 * @brief The number of bytes to read (0 for a write-only transaction)
+	 */
+	t_u16 u16RxLength;
+	/**
+	 * @brief The result of the transaction, set by the driver before the callback is called
+	 */
+	VOLATILE t_I2C_Status tStatus;
+	/**
+	 * @brief The 7-bit slave address
+	 */
+	t_u8 u8Address;
+	/**
+	 * @brief Unused, it completes the structure to a multiple of 4 bytes without any implicit padding
+	 */
+	t_u8 au8Reserved[3];
+} t_I2C_Transaction;
+
+/**
+ * @brief This function initializes an I2C peripheral as a master
+ * @details This function configures the pins, recovers the bus if a slave holds SDA low, then configures the clock timing
+ * @param[in] tI2C The I2C peripheral
+ * @param[in] u32ClockSpeed The SCL frequency in Hz (up to 100000 in standard mode, up to 400000 in fast mode)
+ * @note The clocks of the I2C, GPIO port B and DMA1 (if I2C_DMA_READ_THRESHOLD is not 0) must be enabled.
+ * The APB1 frequency must be a multiple of 10 MHz to reach exactly 400 kHz
+ * @see t_I2C_Peripherals
+ */
+void I2C_vInit(t_I2C_Peripherals tI2C, t_u32 u32ClockSpeed);
+
+/**
+ * @brief This function queues a transaction
+ * @details The transactions of a peripheral run in order from the event interrupt, the next one is started
+ * as soon as the stop condition of the previous one is sent, before its callback runs. A transaction without bytes to write
+ * or read probes the slave: it ends with I2C_Status_Done if the address is acknowledged, I2C_Status_Nack otherwise
+ * @param[in] tI2C The I2C peripheral
+ * @param[in] ptTransaction The transaction (owned by the driver until its callback is called)
+ * @see t_I2C_Peripherals t_I2C_Transaction
+ */
+void I2C_vSubmit(t_I2C_Peripherals tI2C, P2VAR(t_I2C_Transaction) ptTransaction);
+
+/**
+ * @brief This function checks whether an I2C peripheral has transactions in progress
+ * @details This function checks whether an I2C peripheral has transactions in progress
+ * @param[in] tI2C The I2C peripheral
+ * @return TRUE if the queue is not empty, FALSE otherwise
+ * @see t_I2C_Peripherals
+ */
+t_bool I2C_bIsBusy(t_I2C_Peripherals tI2C);
+
+/**
+ * @brief This function recovers a locked bus
+ * @details This function takes the pins as GPIOs, clocks SCL until the slave holding SDA low releases it, sends a stop condition,
+ * then resets the peripheral through RCC and configures it again. The pending transactions end with I2C_Status_BusError,
+ * their callbacks are called in order once the peripheral is ready
+ * @param[in] tI2C The I2C peripheral
+ * @see t_I2C_Peripherals
+ */
+void I2C_vRecoverBus(t_I2C_Peripherals tI2C);
+
+/** @} */
+/** @} */
+
+#endif /* _I2C_INTERFACE_H_ */
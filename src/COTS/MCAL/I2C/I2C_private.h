@@ -0,0 +1,332 @@
+/**
+ * @file I2C_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the I2C module.
+ * @details This file contains the private macros and registers for the I2C module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/I2C
+ * @brief I2C Module
+ * @details This module contains all the APIs related to the I2C peripherals
+ */
+
+#ifndef _I2C_PRIVATE_H_
+#define _I2C_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup i2c_module I2C Module
+ * @brief I2C Module
+ * @details This module contains all the APIs related to the I2C peripherals
+ * @{
+ */
+
+/**
+ * @defgroup i2c_registers I2C Registers
+ * @brief I2C Registers
+ * @{
+ */
+
+/**
+ * @struct t_I2C_RegisterMap
+ * @brief I2C Register Map
+ * @details This type is used to access the registers of one I2C peripheral
+ */
+typedef struct
+{
+	/**
+	 * @brief Control Register 1
+	 */
+	t_u32 CR1;
+	/**
+	 * @brief Control Register 2
+	 */
+	t_u32 CR2;
+	/**
+	 * @brief Own Address Register 1
+	 */
+	t_u32 OAR1;
+	/**
+	 * @brief Own Address Register 2
+	 */
+	t_u32 OAR2;
+	/**
+	 * @brief Data Register
+	 */
+	t_u32 DR;
+	/**
+	 * @brief Status Register 1
+	 */
+	t_u32 SR1;
+	/**
+	 * @brief Status Register 2
+	 */
+	t_u32 SR2;
+	/**
+	 * @brief Clock Control Register
+	 */
+	t_u32 CCR;
+	/**
+	 * @brief Rise Time Register
+	 */
+	t_u32 TRISE;
+} t_I2C_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup i2c_addresses I2C Addresses
+ * @brief I2C Addresses
+ * @details This module contains the addresses of the I2C registers
+ * @{
+ */
+
+/**
+ * @def I2C1_BASE_ADDRESS
+ * @brief I2C1 Base Address in the memory
+ */
+#define I2C1_BASE_ADDRESS REGISTER_ADDRESS(0x40005400, 0)
+
+/**
+ * @def I2C2_BASE_ADDRESS
+ * @brief I2C2 Base Address in the memory
+ */
+#define I2C2_BASE_ADDRESS REGISTER_ADDRESS(0x40005800, 0)
+
+/**
+ * @def I2C1
+ * @brief I2C1 Register Map
+ */
+#define I2C1 REGISTER(t_I2C_RegisterMap, I2C1_BASE_ADDRESS)
+
+/**
+ * @def I2C2
+ * @brief I2C2 Register Map
+ */
+#define I2C2 REGISTER(t_I2C_RegisterMap, I2C2_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup i2c_constants I2C Constants
+ * @brief I2C Constants
+ * @{
+ */
+
+/**
+ * @def I2C_PERIPHERALS_COUNT
+ * @brief Number of the I2C peripherals
+ */
+#define I2C_PERIPHERALS_COUNT (2)
+
+/**
+ * @def I2C_CR1_PE
+ * @brief Peripheral enable bit
+ */
+#define I2C_CR1_PE (0)
+
+/**
+ * @def I2C_CR1_START
+ * @brief Start generation bit
+ */
+#define I2C_CR1_START (8)
+
+/**
+ * @def I2C_CR1_STOP
+ * @brief Stop generation bit
+ */
+#define I2C_CR1_STOP (9)
+
+/**
+ * @def I2C_CR1_ACK
+ * @brief Acknowledge enable bit
+ */
+#define I2C_CR1_ACK (10)
+
+/**
+ * @def I2C_CR1_POS
+ * @brief Acknowledge position bit (`1`: ACK/NACK applies to the next byte)
+ */
+#define I2C_CR1_POS (11)
+
+/**
+ * @def I2C_CR2_FREQ
+ * @brief Position of the peripheral clock frequency field (in MHz)
+ */
+#define I2C_CR2_FREQ (0)
+
+/**
+ * @def I2C_CR2_ITERREN
+ * @brief Error interrupt enable bit
+ */
+#define I2C_CR2_ITERREN (8)
+
+/**
+ * @def I2C_CR2_ITEVTEN
+ * @brief Event interrupt enable bit
+ */
+#define I2C_CR2_ITEVTEN (9)
+
+/**
+ * @def I2C_CR2_ITBUFEN
+ * @brief Buffer interrupt enable bit (TXE/RXNE)
+ */
+#define I2C_CR2_ITBUFEN (10)
+
+/**
+ * @def I2C_CR2_DMAEN
+ * @brief DMA requests enable bit
+ */
+#define I2C_CR2_DMAEN (11)
+
+/**
+ * @def I2C_CR2_LAST
+ * @brief DMA last transfer bit (NACK the last received byte)
+ */
+#define I2C_CR2_LAST (12)
+
+/**
+ * @def I2C_SR1_SB
+ * @brief Start bit generated flag
+ */
+#define I2C_SR1_SB (0)
+
+/**
+ * @def I2C_SR1_ADDR
+ * @brief Address sent flag
+ */
+#define I2C_SR1_ADDR (1)
+
+/**
+ * @def I2C_SR1_BTF
+ * @brief Byte transfer finished flag
+ */
+#define I2C_SR1_BTF (2)
+
+/**
+ * @def I2C_SR1_RXNE
+ * @brief Data register not empty flag
+ */
+#define I2C_SR1_RXNE (6)
+
+/**
+ * @def I2C_SR1_TXE
+ * @brief Data register empty flag
+ */
+#define I2C_SR1_TXE (7)
+
+/**
+ * @def I2C_SR1_BERR
+ * @brief Bus error flag
+ */
+#define I2C_SR1_BERR (8)
+
+/**
+ * @def I2C_SR1_ARLO
+ * @brief Arbitration lost flag
+ */
+#define I2C_SR1_ARLO (9)
+
+/**
+ * @def I2C_SR1_AF
+ * @brief Acknowledge failure flag
+ */
+#define I2C_SR1_AF (10)
+
+/**
+ * @def I2C_SR1_ERRORS_MASK
+ * @brief Mask of the error flags (BERR, ARLO, AF, OVR, PECERR, TIMEOUT and SMBALERT)
+ */
+#define I2C_SR1_ERRORS_MASK ((t_u32)0x0000DF00U)
+
+/**
+ * @def I2C_SR2_BUSY
+ * @brief Bus busy flag
+ */
+#define I2C_SR2_BUSY (1)
+
+/**
+ * @def I2C_CCR_DUTY
+ * @brief Fast mode duty cycle bit (`1`: Tlow/Thigh = 16/9)
+ */
+#define I2C_CCR_DUTY (14)
+
+/**
+ * @def I2C_CCR_FS
+ * @brief Fast mode selection bit
+ */
+#define I2C_CCR_FS (15)
+
+/**
+ * @def I2C_STANDARD_MODE_MAX_SPEED
+ * @brief Maximum standard mode clock speed in Hz
+ */
+#define I2C_STANDARD_MODE_MAX_SPEED (100000UL)
+
+/**
+ * @def I2C_STANDARD_MODE_MAX_RISE_TIME_NS
+ * @brief Maximum SCL rise time in standard mode in ns
+ */
+#define I2C_STANDARD_MODE_MAX_RISE_TIME_NS (1000UL)
+
+/**
+ * @def I2C_FAST_MODE_MAX_RISE_TIME_NS
+ * @brief Maximum SCL rise time in fast mode in ns
+ */
+#define I2C_FAST_MODE_MAX_RISE_TIME_NS (300UL)
+
+/**
+ * @def I2C_RECOVERY_CLOCK_PULSES
+ * @brief Number of SCL pulses that release a slave stuck in the middle of a byte
+ */
+#define I2C_RECOVERY_CLOCK_PULSES (9)
+
+/**
+ * @def I2C_RECOVERY_HALF_PERIOD_US
+ * @brief Half period of the recovery clock in microseconds (~100 kHz)
+ */
+#define I2C_RECOVERY_HALF_PERIOD_US (5)
+
+/** @} */
+
+/**
+ * @defgroup i2c_handlers I2C Interrupt Handlers
+ * @brief The interrupt handlers of the I2C module, they are referenced by the vector table
+ * @{
+ */
+
+/**
+ * @brief I2C1 event interrupt handler
+ */
+void I2C1_EV_IRQHandler(void);
+
+/**
+ * @brief I2C1 error interrupt handler
+ */
+void I2C1_ER_IRQHandler(void);
+
+/**
+ * @brief I2C2 event interrupt handler
+ */
+void I2C2_EV_IRQHandler(void);
+
+/**
+ * @brief I2C2 error interrupt handler
+ */
+void I2C2_ER_IRQHandler(void);
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _I2C_PRIVATE_H_ */
@@ -0,0 +1,706 @@
+/**
+ * @file I2C_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the I2C module.
+ * @details This file contains the implementation for the I2C module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../RCC/RCC_interface.h"
+#include "../GPIO/GPIO_interface.h"
+#include "../NVIC/NVIC_interface.h"
+#include "../DMA/DMA_interface.h"
+#include "I2C_private.h"
+#include "I2C_interface.h"
+#include "I2C_config.h"
+
+/**
+ * @brief The register maps of the I2C peripherals
+ */
+STATIC P2VAR(VOLATILE t_I2C_RegisterMap) CONST aptI2Cs[I2C_PERIPHERALS_COUNT] = {&I2C1, &I2C2};
+
+/**
+ * @brief The NVIC event interrupts of the I2C peripherals
+ */
+STATIC CONST t_NVIC_IRQs atI2CEventIRQs[I2C_PERIPHERALS_COUNT] = {NVIC_IRQs_I2C1_EV, NVIC_IRQs_I2C2_EV};
+
+/**
+ * @brief The NVIC error interrupts of the I2C peripherals
+ */
+STATIC CONST t_NVIC_IRQs atI2CErrorIRQs[I2C_PERIPHERALS_COUNT] = {NVIC_IRQs_I2C1_ER, NVIC_IRQs_I2C2_ER};
+
+/**
+ * @brief The RCC reset/clock bits of the I2C peripherals
+ */
+STATIC CONST t_RCC_APB1Peripherals atI2CRCCPeripherals[I2C_PERIPHERALS_COUNT] = {RCC_APB1Peripherals_I2C1, RCC_APB1Peripherals_I2C2};
+
+/**
+ * @brief The SCL pins of the I2C peripherals (port B)
+ */
+STATIC CONST t_GPIO_Pins atI2CSCLPins[I2C_PERIPHERALS_COUNT] = {GPIO_Pins_6, GPIO_Pins_10};
+
+/**
+ * @brief The SDA pins of the I2C peripherals (port B)
+ */
+STATIC CONST t_GPIO_Pins atI2CSDAPins[I2C_PERIPHERALS_COUNT] = {GPIO_Pins_7, GPIO_Pins_11};
+
+/**
+ * @brief The DMA channels that serve the I2C receivers
+ */
+STATIC CONST t_DMA_Channels atI2CDMARxChannels[I2C_PERIPHERALS_COUNT] = {DMA_CHANNEL_I2C1_RX, DMA_CHANNEL_I2C2_RX};
+
+/**
+ * @brief The SCL frequencies of the I2C peripherals
+ */
+STATIC t_u32 au32I2CClockSpeeds[I2C_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief Whether the receive DMA channel of each peripheral is reserved
+ */
+STATIC t_bool abI2CDMAAvailable[I2C_PERIPHERALS_COUNT] = {FALSE};
+
+/**
+ * @brief The first transaction of each queue (the one in progress)
+ */
+STATIC P2VAR(t_I2C_Transaction) VOLATILE aptI2CQueueHeads[I2C_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief The last transaction of each queue
+ */
+STATIC P2VAR(t_I2C_Transaction) VOLATILE aptI2CQueueTails[I2C_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief Whether the transaction in progress is in its read phase
+ */
+STATIC t_bool abI2CReading[I2C_PERIPHERALS_COUNT] = {FALSE};
+
+/**
+ * @brief The number of bytes written by the transaction in progress
+ */
+STATIC t_u16 au16I2CTxIndices[I2C_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The number of bytes read by the transaction in progress
+ */
+STATIC t_u16 au16I2CRxIndices[I2C_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief This function waits for a number of microseconds
+ * @details This function is only used by the bus recovery, its accuracy is about one loop iteration (4 cycles)
+ * @param[in] u32Microseconds The time to wait
+ */
+STATIC void I2C_vDelayMicroseconds(t_u32 u32Microseconds)
+{
+	VOLATILE t_u32 u32Count = (RCC_u32GetAHBClockFrequency() / 1000000UL / 4U) * u32Microseconds;
+
+	while (u32Count != 0U)
+	{
+		u32Count--;
+	}
+}
+
+/**
+ * @brief This function configures the clock timing and enables an I2C peripheral
+ * @details The timing is derived from the current APB1 frequency, fast mode uses a Tlow/Thigh ratio of 2
+ * @param[in] tI2C The I2C peripheral
+ */
+STATIC void I2C_vConfigurePeripheral(t_I2C_Peripherals tI2C)
+{
+	P2VAR(VOLATILE t_I2C_RegisterMap) ptI2C = aptI2Cs[tI2C];
+	t_u32 u32PCLK = RCC_u32GetAPB1ClockFrequency();
+	t_u32 u32PCLKMHz = u32PCLK / 1000000UL;
+	t_u32 u32Speed = au32I2CClockSpeeds[tI2C];
+	t_u32 u32CCR = 0;
+
+	/* The timing can only be changed while the peripheral is disabled */
+	ptI2C->CR1 = 0U;
+	ptI2C->CR2 = (u32PCLKMHz << I2C_CR2_FREQ) | ((t_u32)1 << I2C_CR2_ITERREN);
+
+	if (u32Speed <= I2C_STANDARD_MODE_MAX_SPEED)
+	{
+		/* Thigh = Tlow = CCR * TPCLK, rounded up so the bus never runs faster than requested */
+		u32CCR = (u32PCLK + (2U * u32Speed) - 1U) / (2U * u32Speed);
+		u32CCR = (u32CCR < 4U) ? 4U : u32CCR;
+		ptI2C->TRISE = ((u32PCLKMHz * I2C_STANDARD_MODE_MAX_RISE_TIME_NS) / 1000U) + 1U;
+	}
+	else
+	{
+		/* Tlow = 2 * CCR * TPCLK, Thigh = CCR * TPCLK */
+		u32CCR = (u32PCLK + (3U * u32Speed) - 1U) / (3U * u32Speed);
+		u32CCR = (u32CCR < 1U) ? 1U : u32CCR;
+		u32CCR |= ((t_u32)1 << I2C_CCR_FS);
+		ptI2C->TRISE = ((u32PCLKMHz * I2C_FAST_MODE_MAX_RISE_TIME_NS) / 1000U) + 1U;
+	}
+
+	ptI2C->CCR = u32CCR;
+	SET_BIT(ptI2C->CR1, I2C_CR1_PE);
+}
+
+/**
+ * @brief This function gives the pins of an I2C peripheral to the peripheral or to the GPIO module
+ * @details Both pins are open-drain, as alternate function outputs or as plain GPIO outputs driven high
+ * @param[in] tI2C The I2C peripheral
+ * @param[in] tOutputType GPIO_Output_Type_Alternate_Open_Drain or GPIO_Output_Type_Open_Drain
+ */
+STATIC void I2C_vSetPinsOutputType(t_I2C_Peripherals tI2C, t_GPIO_Output_Type tOutputType)
+{
+	GPIO_vSetPinValue(GPIO_Ports_B, atI2CSCLPins[tI2C], GPIO_Value_High);
+	GPIO_vSetPinValue(GPIO_Ports_B, atI2CSDAPins[tI2C], GPIO_Value_High);
+	GPIO_vSetPinDirection(GPIO_Ports_B, atI2CSCLPins[tI2C], GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinOutputType(GPIO_Ports_B, atI2CSCLPins[tI2C], tOutputType);
+	GPIO_vSetPinDirection(GPIO_Ports_B, atI2CSDAPins[tI2C], GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinOutputType(GPIO_Ports_B, atI2CSDAPins[tI2C], tOutputType);
+}
+
+/**
+ * @brief This function starts a transaction
+ * @details This function generates the start condition, the rest runs from the event interrupt
+ * @param[in] tI2C The I2C peripheral
+ * @param[in] ptTransaction The transaction
+ */
+STATIC void I2C_vStartTransaction(t_I2C_Peripherals tI2C, P2VAR(t_I2C_Transaction) ptTransaction)
+{
+	P2VAR(VOLATILE t_I2C_RegisterMap) ptI2C = aptI2Cs[tI2C];
+
+	ptTransaction->tStatus = I2C_Status_Pending;
+	/* An address-only transaction (probe) is a write without data */
+	abI2CReading[tI2C] = ((ptTransaction->u16TxLength == 0U) && (ptTransaction->u16RxLength != 0U)) ? TRUE : FALSE;
+	au16I2CTxIndices[tI2C] = 0U;
+	au16I2CRxIndices[tI2C] = 0U;
+
+	ptI2C->CR1 &= ~((t_u32)1U << I2C_CR1_POS);
+	SET_BIT(ptI2C->CR2, I2C_CR2_ITEVTEN);
+	SET_BIT(ptI2C->CR2, I2C_CR2_ITBUFEN);
+	SET_BIT(ptI2C->CR1, I2C_CR1_START);
+}
+
+/**
+ * @brief This function ends the transaction in progress and starts the next one
+ * @details This function ends the transaction in progress and starts the next one before calling the callback of the ended one
+ * @param[in] tI2C The I2C peripheral
+ * @param[in] tStatus The result of the transaction
+ */
+STATIC void I2C_vCompleteTransaction(t_I2C_Peripherals tI2C, t_I2C_Status tStatus)
+{
+	P2VAR(VOLATILE t_I2C_RegisterMap) ptI2C = aptI2Cs[tI2C];
+	P2VAR(t_I2C_Transaction) ptDone = aptI2CQueueHeads[tI2C];
+	P2VAR(t_I2C_Transaction) ptNext = NULL;
+	t_u32 u32PRIMASK = 0;
+
+	ptI2C->CR2 &= ~(((t_u32)1 << I2C_CR2_ITBUFEN) | ((t_u32)1 << I2C_CR2_DMAEN) | ((t_u32)1 << I2C_CR2_LAST));
+	ptI2C->CR1 &= ~((t_u32)1U << I2C_CR1_POS);
+
+	/* A higher priority interrupt can submit a transaction in between */
+	u32PRIMASK = CPU_u32EnterCritical();
+
+	ptNext = ptDone->ptNext;
+	aptI2CQueueHeads[tI2C] = ptNext;
+
+	if (ptNext == NULL)
+	{
+		aptI2CQueueTails[tI2C] = NULL;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+
+	ptDone->tStatus = tStatus;
+
+	if (ptNext != NULL)
+	{
+		/* A start requested before the stop condition is sent would be lost (a few microseconds at most) */
+		while (GET_BIT(ptI2C->CR1, I2C_CR1_STOP) != 0)
+			;
+
+		I2C_vStartTransaction(tI2C, ptNext);
+	}
+	else
+	{
+		ptI2C->CR2 &= ~((t_u32)1U << I2C_CR2_ITEVTEN);
+	}
+
+	if (ptDone->pfCallback != NULL)
+	{
+		ptDone->pfCallback(ptDone);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function ends a DMA read
+ * @details This function ends a DMA read
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void I2C_vDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent);
+
+/**
+ * @brief This function prepares the reception after the read address is acknowledged
+ * @details The acknowledge bit of the last bytes must be set before they are received, the sequences follow the
+ * reference manual for 1 byte, 2 bytes, 3 bytes or more, and DMA reads
+ * @param[in] tI2C The I2C peripheral
+ * @param[in] ptTransaction The transaction in progress
+ */
+STATIC void I2C_vPrepareReception(t_I2C_Peripherals tI2C, P2CONST(t_I2C_Transaction) ptTransaction)
+{
+	P2VAR(VOLATILE t_I2C_RegisterMap) ptI2C = aptI2Cs[tI2C];
+	t_u16 u16Length = ptTransaction->u16RxLength;
+	t_DMA_ChannelConfig tDMAConfig;
+
+	if ((abI2CDMAAvailable[tI2C] == TRUE) && (u16Length >= I2C_DMA_READ_THRESHOLD))
+	{
+		tDMAConfig.u32PeripheralAddress = (t_u32)&ptI2C->DR;
+		tDMAConfig.u32MemoryAddress = (t_u32)ptTransaction->pu8RxData;
+		tDMAConfig.u16Count = u16Length;
+		tDMAConfig.tDirection = DMA_Direction_PeripheralToMemory;
+		tDMAConfig.tPeripheralSize = DMA_Size_8Bits;
+		tDMAConfig.tMemorySize = DMA_Size_8Bits;
+		tDMAConfig.bPeripheralIncrement = FALSE;
+		tDMAConfig.bMemoryIncrement = TRUE;
+		tDMAConfig.bCircular = FALSE;
+		tDMAConfig.tPriority = DMA_Priority_VeryHigh;
+		tDMAConfig.u8Events = DMA_Events_TransferComplete | DMA_Events_TransferError;
+		tDMAConfig.pfCallback = I2C_vDMAEventHandler;
+		DMA_vConfigureChannel(atI2CDMARxChannels[tI2C], &tDMAConfig);
+		DMA_vStartChannel(atI2CDMARxChannels[tI2C]);
+
+		/* LAST makes the peripheral NACK the byte of the last DMA request */
+		SET_BIT(ptI2C->CR1, I2C_CR1_ACK);
+		ptI2C->CR2 &= ~((t_u32)1U << I2C_CR2_ITBUFEN);
+		ptI2C->CR2 |= ((t_u32)1 << I2C_CR2_DMAEN) | ((t_u32)1 << I2C_CR2_LAST);
+		(void)ptI2C->SR2;
+	}
+	else if (u16Length == 1U)
+	{
+		/* NACK the only byte and request the stop right after the address phase */
+		ptI2C->CR1 &= ~((t_u32)1U << I2C_CR1_ACK);
+		(void)ptI2C->SR2;
+		SET_BIT(ptI2C->CR1, I2C_CR1_STOP);
+		SET_BIT(ptI2C->CR2, I2C_CR2_ITBUFEN);
+	}
+	else if (u16Length == 2U)
+	{
+		/* NACK the second byte, both bytes are read on BTF */
+		ptI2C->CR1 &= ~((t_u32)1U << I2C_CR1_ACK);
+		SET_BIT(ptI2C->CR1, I2C_CR1_POS);
+		(void)ptI2C->SR2;
+		ptI2C->CR2 &= ~((t_u32)1U << I2C_CR2_ITBUFEN);
+	}
+	else
+	{
+		/* Acknowledge the bytes until the last three, which are handled on BTF */
+		SET_BIT(ptI2C->CR1, I2C_CR1_ACK);
+		(void)ptI2C->SR2;
+
+		if (u16Length == 3U)
+		{
+			ptI2C->CR2 &= ~((t_u32)1U << I2C_CR2_ITBUFEN);
+		}
+		else
+		{
+			SET_BIT(ptI2C->CR2, I2C_CR2_ITBUFEN);
+		}
+	}
+}
+
+/**
+ * @brief This function serves the data events of the read phase
+ * @details This function serves the data events of the read phase
+ * @param[in] tI2C The I2C peripheral
+ * @param[in] ptTransaction The transaction in progress
+ * @param[in] u32SR1 The status register 1 value
+ */
+STATIC void I2C_vHandleReceive(t_I2C_Peripherals tI2C, P2VAR(t_I2C_Transaction) ptTransaction, t_u32 u32SR1)
+{
+	P2VAR(VOLATILE t_I2C_RegisterMap) ptI2C = aptI2Cs[tI2C];
+	t_u16 u16Remaining = ptTransaction->u16RxLength - au16I2CRxIndices[tI2C];
+
+	if (GET_BIT(u32SR1, I2C_SR1_BTF) != 0)
+	{
+		if (u16Remaining == 3U)
+		{
+			/* Byte N-2 is in DR and byte N-1 in the shift register, NACK byte N */
+			ptI2C->CR1 &= ~((t_u32)1U << I2C_CR1_ACK);
+			ptTransaction->pu8RxData[au16I2CRxIndices[tI2C]++] = (t_u8)ptI2C->DR;
+		}
+		else if (u16Remaining == 2U)
+		{
+			/* Bytes N-1 and N are received, the clock is stretched until DR is read */
+			SET_BIT(ptI2C->CR1, I2C_CR1_STOP);
+			ptTransaction->pu8RxData[au16I2CRxIndices[tI2C]++] = (t_u8)ptI2C->DR;
+			ptTransaction->pu8RxData[au16I2CRxIndices[tI2C]++] = (t_u8)ptI2C->DR;
+			I2C_vCompleteTransaction(tI2C, I2C_Status_Done);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else if (GET_BIT(u32SR1, I2C_SR1_RXNE) != 0)
+	{
+		if (u16Remaining == 1U)
+		{
+			ptTransaction->pu8RxData[au16I2CRxIndices[tI2C]++] = (t_u8)ptI2C->DR;
+			I2C_vCompleteTransaction(tI2C, I2C_Status_Done);
+		}
+		else if (u16Remaining > 3U)
+		{
+			ptTransaction->pu8RxData[au16I2CRxIndices[tI2C]++] = (t_u8)ptI2C->DR;
+		}
+		else
+		{
+			/* The last three bytes are handled on BTF */
+			ptI2C->CR2 &= ~((t_u32)1U << I2C_CR2_ITBUFEN);
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function serves the event interrupt of an I2C peripheral
+ * @details This function serves the event interrupt of an I2C peripheral
+ * @param[in] tI2C The I2C peripheral
+ */
+STATIC void I2C_vHandleEvent(t_I2C_Peripherals tI2C)
+{
+	P2VAR(VOLATILE t_I2C_RegisterMap) ptI2C = aptI2Cs[tI2C];
+	P2VAR(t_I2C_Transaction) ptTransaction = aptI2CQueueHeads[tI2C];
+	t_u32 u32SR1 = ptI2C->SR1;
+
+	if (ptTransaction == NULL)
+	{
+		/* No transaction in progress, stop the events */
+		ptI2C->CR2 &= ~((t_u32)1U << I2C_CR2_ITEVTEN);
+	}
+	else if (GET_BIT(u32SR1, I2C_SR1_SB) != 0)
+	{
+		/* Reading SR1 then writing DR clears SB */
+		ptI2C->DR = ((t_u32)ptTransaction->u8Address << 1) | ((abI2CReading[tI2C] == TRUE) ? 1U : 0U);
+	}
+	else if (GET_BIT(u32SR1, I2C_SR1_ADDR) != 0)
+	{
+		if (abI2CReading[tI2C] == TRUE)
+		{
+			I2C_vPrepareReception(tI2C, ptTransaction);
+		}
+		else
+		{
+			/* Reading SR1 then SR2 clears ADDR */
+			(void)ptI2C->SR2;
+
+			if ((ptTransaction->u16TxLength == 0U) && (ptTransaction->u16RxLength == 0U))
+			{
+				/* The slave acknowledged its address and there is nothing to transfer */
+				SET_BIT(ptI2C->CR1, I2C_CR1_STOP);
+				I2C_vCompleteTransaction(tI2C, I2C_Status_Done);
+			}
+			else
+			{
+				/* Do nothing */
+			}
+		}
+	}
+	else if (abI2CReading[tI2C] == FALSE)
+	{
+		if (au16I2CTxIndices[tI2C] < ptTransaction->u16TxLength)
+		{
+			if (GET_BIT(u32SR1, I2C_SR1_TXE) != 0)
+			{
+				ptI2C->DR = ptTransaction->pu8TxData[au16I2CTxIndices[tI2C]++];
+			}
+			else
+			{
+				/* Do nothing */
+			}
+		}
+		else if (GET_BIT(u32SR1, I2C_SR1_BTF) != 0)
+		{
+			/* The last byte is acknowledged */
+			if (ptTransaction->u16RxLength != 0U)
+			{
+				/* Repeated start for the read phase */
+				abI2CReading[tI2C] = TRUE;
+				SET_BIT(ptI2C->CR2, I2C_CR2_ITBUFEN);
+				SET_BIT(ptI2C->CR1, I2C_CR1_START);
+			}
+			else
+			{
+				SET_BIT(ptI2C->CR1, I2C_CR1_STOP);
+				I2C_vCompleteTransaction(tI2C, I2C_Status_Done);
+			}
+		}
+		else
+		{
+			/* All bytes are in the data register, wait for BTF without TXE interrupts */
+			ptI2C->CR2 &= ~((t_u32)1U << I2C_CR2_ITBUFEN);
+		}
+	}
+	else
+	{
+		I2C_vHandleReceive(tI2C, ptTransaction, u32SR1);
+	}
+}
+
+/**
+ * @brief This function serves the error interrupt of an I2C peripheral
+ * @details This function serves the error interrupt of an I2C peripheral
+ * @param[in] tI2C The I2C peripheral
+ */
+STATIC void I2C_vHandleError(t_I2C_Peripherals tI2C)
+{
+	P2VAR(VOLATILE t_I2C_RegisterMap) ptI2C = aptI2Cs[tI2C];
+	t_u32 u32SR1 = ptI2C->SR1;
+	t_I2C_Status tStatus = I2C_Status_BusError;
+
+	/* The error flags are cleared by writing 0 */
+	ptI2C->SR1 = ~(u32SR1 & I2C_SR1_ERRORS_MASK);
+
+	if (GET_BIT(u32SR1, I2C_SR1_ARLO) != 0)
+	{
+		/* The peripheral already switched to slave mode and released the bus */
+		tStatus = I2C_Status_ArbitrationLost;
+	}
+	else
+	{
+		if (GET_BIT(u32SR1, I2C_SR1_AF) != 0)
+		{
+			tStatus = I2C_Status_Nack;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		SET_BIT(ptI2C->CR1, I2C_CR1_STOP);
+	}
+
+	if (GET_BIT(ptI2C->CR2, I2C_CR2_DMAEN) != 0)
+	{
+		DMA_vStopChannel(atI2CDMARxChannels[tI2C]);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (aptI2CQueueHeads[tI2C] != NULL)
+	{
+		I2C_vCompleteTransaction(tI2C, tStatus);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function ends a DMA read
+ * @details The last byte is already NACKed (LAST bit), only the stop condition is left
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void I2C_vDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent)
+{
+	t_I2C_Peripherals tI2C = (tChannel == atI2CDMARxChannels[I2C_Peripherals_I2C1]) ? I2C_Peripherals_I2C1 : I2C_Peripherals_I2C2;
+
+	DMA_vStopChannel(tChannel);
+	SET_BIT(aptI2Cs[tI2C]->CR1, I2C_CR1_STOP);
+	I2C_vCompleteTransaction(tI2C, (tEvent == DMA_Events_TransferComplete) ? I2C_Status_Done : I2C_Status_BusError);
+}
+
+void I2C_vInit(t_I2C_Peripherals tI2C, t_u32 u32ClockSpeed)
+{
+	au32I2CClockSpeeds[tI2C] = u32ClockSpeed;
+	aptI2CQueueHeads[tI2C] = NULL;
+	aptI2CQueueTails[tI2C] = NULL;
+
+	if (I2C_DMA_READ_THRESHOLD != 0)
+	{
+		/* Without the channel the reads fall back to one interrupt per byte */
+		abI2CDMAAvailable[tI2C] = DMA_bAllocateChannel(atI2CDMARxChannels[tI2C], (P2CONST(void))aptI2Cs[tI2C]);
+
+		if (abI2CDMAAvailable[tI2C] == TRUE)
+		{
+			DMA_vSetChannelPriority(atI2CDMARxChannels[tI2C], I2C_IRQ_PRIORITY);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	NVIC_vSetPriority(atI2CEventIRQs[tI2C], I2C_IRQ_PRIORITY);
+	NVIC_vSetPriority(atI2CErrorIRQs[tI2C], I2C_IRQ_PRIORITY);
+
+	/* A slave reset in the middle of a read can still hold SDA low */
+	I2C_vRecoverBus(tI2C);
+}
+
+void I2C_vSubmit(t_I2C_Peripherals tI2C, P2VAR(t_I2C_Transaction) ptTransaction)
+{
+	t_bool bStart = FALSE;
+	/* The completion interrupt removes transactions from the head of the same queue */
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	ptTransaction->ptNext = NULL;
+	ptTransaction->tStatus = I2C_Status_Pending;
+
+	if (aptI2CQueueTails[tI2C] == NULL)
+	{
+		aptI2CQueueHeads[tI2C] = ptTransaction;
+		bStart = TRUE;
+	}
+	else
+	{
+		aptI2CQueueTails[tI2C]->ptNext = ptTransaction;
+	}
+
+	aptI2CQueueTails[tI2C] = ptTransaction;
+
+	CPU_vExitCritical(u32PRIMASK);
+
+	/* The queue was idle, no interrupt will start this transaction */
+	if (bStart == TRUE)
+	{
+		I2C_vStartTransaction(tI2C, ptTransaction);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool I2C_bIsBusy(t_I2C_Peripherals tI2C)
+{
+	return (aptI2CQueueHeads[tI2C] != NULL) ? TRUE : FALSE;
+}
+
+void I2C_vRecoverBus(t_I2C_Peripherals tI2C)
+{
+	P2VAR(t_I2C_Transaction) ptDropped = NULL;
+	P2VAR(t_I2C_Transaction) ptNext = NULL;
+	t_u32 u32PRIMASK = 0;
+	t_u8 u8Pulse = 0;
+
+	NVIC_vDisableIRQ(atI2CEventIRQs[tI2C]);
+	NVIC_vDisableIRQ(atI2CErrorIRQs[tI2C]);
+
+	if (abI2CDMAAvailable[tI2C] == TRUE)
+	{
+		DMA_vStopChannel(atI2CDMARxChannels[tI2C]);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* A higher priority interrupt can submit a transaction in between */
+	u32PRIMASK = CPU_u32EnterCritical();
+	ptDropped = aptI2CQueueHeads[tI2C];
+	aptI2CQueueHeads[tI2C] = NULL;
+	aptI2CQueueTails[tI2C] = NULL;
+	CPU_vExitCritical(u32PRIMASK);
+
+	/* Take the pins as open-drain GPIOs released high */
+	aptI2Cs[tI2C]->CR1 &= ~((t_u32)1U << I2C_CR1_PE);
+	I2C_vSetPinsOutputType(tI2C, GPIO_Output_Type_Open_Drain);
+	I2C_vDelayMicroseconds(I2C_RECOVERY_HALF_PERIOD_US);
+
+	/* Clock SCL until the slave finishes its byte and releases SDA */
+	for (u8Pulse = 0; (u8Pulse < I2C_RECOVERY_CLOCK_PULSES) && (GPIO_tGetPinValue(GPIO_Ports_B, atI2CSDAPins[tI2C]) == GPIO_Value_Low); u8Pulse++)
+	{
+		GPIO_vSetPinValue(GPIO_Ports_B, atI2CSCLPins[tI2C], GPIO_Value_Low);
+		I2C_vDelayMicroseconds(I2C_RECOVERY_HALF_PERIOD_US);
+		GPIO_vSetPinValue(GPIO_Ports_B, atI2CSCLPins[tI2C], GPIO_Value_High);
+		I2C_vDelayMicroseconds(I2C_RECOVERY_HALF_PERIOD_US);
+	}
+
+	/* Stop condition: SDA rises while SCL is high */
+	GPIO_vSetPinValue(GPIO_Ports_B, atI2CSCLPins[tI2C], GPIO_Value_Low);
+	I2C_vDelayMicroseconds(I2C_RECOVERY_HALF_PERIOD_US);
+	GPIO_vSetPinValue(GPIO_Ports_B, atI2CSDAPins[tI2C], GPIO_Value_Low);
+	I2C_vDelayMicroseconds(I2C_RECOVERY_HALF_PERIOD_US);
+	GPIO_vSetPinValue(GPIO_Ports_B, atI2CSCLPins[tI2C], GPIO_Value_High);
+	I2C_vDelayMicroseconds(I2C_RECOVERY_HALF_PERIOD_US);
+	GPIO_vSetPinValue(GPIO_Ports_B, atI2CSDAPins[tI2C], GPIO_Value_High);
+	I2C_vDelayMicroseconds(I2C_RECOVERY_HALF_PERIOD_US);
+
+	/* Give the pins back and clear the stuck BUSY state with a peripheral reset */
+	I2C_vSetPinsOutputType(tI2C, GPIO_Output_Type_Alternate_Open_Drain);
+	RCC_vResetPeripheralAPB1(atI2CRCCPeripherals[tI2C]);
+	I2C_vConfigurePeripheral(tI2C);
+
+	NVIC_vClearPendingIRQ(atI2CEventIRQs[tI2C]);
+	NVIC_vClearPendingIRQ(atI2CErrorIRQs[tI2C]);
+	NVIC_vEnableIRQ(atI2CEventIRQs[tI2C]);
+	NVIC_vEnableIRQ(atI2CErrorIRQs[tI2C]);
+
+	/* Fail the dropped transactions once the peripheral is ready, so their callbacks can submit new ones */
+	while (ptDropped != NULL)
+	{
+		ptNext = ptDropped->ptNext;
+		ptDropped->tStatus = I2C_Status_BusError;
+
+		if (ptDropped->pfCallback != NULL)
+		{
+			ptDropped->pfCallback(ptDropped);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		ptDropped = ptNext;
+	}
+}
+
+/**
+ * @brief I2C1 event interrupt handler
+ */
+void I2C1_EV_IRQHandler(void)
+{
+	I2C_vHandleEvent(I2C_Peripherals_I2C1);
+}
+
+/**
+ * @brief I2C1 error interrupt handler
+ */
+void I2C1_ER_IRQHandler(void)
+{
+	I2C_vHandleError(I2C_Peripherals_I2C1);
+}
+
+/**
+ * @brief I2C2 event interrupt handler
+ */
+void I2C2_EV_IRQHandler(void)
+{
+	I2C_vHandleEvent(I2C_Peripherals_I2C2);
+}
+
+/**
+ * @brief I2C2 error interrupt handler
+ */
+void I2C2_ER_IRQHandler(void)
+{
+	I2C_vHandleError(I2C_Peripherals_I2C2);
+}
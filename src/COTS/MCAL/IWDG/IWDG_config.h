@@ -0,0 +1,49 @@
+/**
+ * @file IWDG_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the IWDG module.
+ * @details This file contains the configuration parameters for the IWDG module.
+ * @date 2026-10-19
+ */
+
+#ifndef _IWDG_CONFIG_H_
+#define _IWDG_CONFIG_H_
+
+#include "IWDG_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup iwdg_module
+ * @{
+ */
+
+/**
+ * @defgroup iwdg_config IWDG Configuration
+ * @brief This group contains the configuration parameters of the IWDG module
+ * @{
+ */
+
+/**
+ * @def IWDG_LSI_FREQUENCY
+ * @brief This macro defines the nominal frequency of the LSI oscillator that clocks the watchdog in Hz
+ * @details The LSI of the STM32F103 is only specified between 30 kHz and 60 kHz, so the real timeout can be
+ * from 0.67 to 1.33 times the requested one. Keep the refresh period well below half the requested timeout
+ */
+#define IWDG_LSI_FREQUENCY (40000U)
+
+/**
+ * @def IWDG_STOP_IN_DEBUG
+ * @brief This macro defines whether the watchdog stops while the core is halted by the debugger (1) or not (0)
+ */
+#define IWDG_STOP_IN_DEBUG (1)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _IWDG_CONFIG_H_ */
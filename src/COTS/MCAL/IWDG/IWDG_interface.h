@@ -0,0 +1,51 @@
+/**
+ * @file IWDG_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the IWDG module.
+ * @details This file contains the prototypes of the functions of the IWDG module.
+ * @date 2026-10-19
+ */
+
+#ifndef _IWDG_INTERFACE_H_
+#define _IWDG_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup iwdg_module
+ * @{
+ */
+
+/**
+ * @brief This function starts the independent watchdog with a given timeout
+ * @details The smallest prescaler that fits the timeout in the 12-bit reload register is used, which gives the finest
+ * resolution. The LSI oscillator is started by the hardware
+ * @param[in] u32TimeoutMs The timeout in milliseconds (1 to 26214 with the nominal 40 kHz LSI)
+ * @return TRUE if the watchdog is started, FALSE if the timeout is out of range
+ * @warning The watchdog cannot be stopped once started, only its timeout can be changed by another call
+ * @see IWDG_LSI_FREQUENCY
+ */
+t_bool IWDG_bStart(t_u32 u32TimeoutMs);
+
+/**
+ * @brief This function reloads the watchdog counter
+ */
+void IWDG_vRefresh(void);
+
+/**
+ * @brief This function gets the timeout programmed by IWDG_bStart()
+ * @return The nominal timeout in milliseconds after the rounding to the counter resolution (0 if not started)
+ */
+t_u32 IWDG_u32GetTimeoutMs(void);
+
+/** @} */
+/** @} */
+
+#endif /* _IWDG_INTERFACE_H_ */
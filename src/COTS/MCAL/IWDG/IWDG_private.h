@@ -0,0 +1,154 @@
+/**
+ * @file IWDG_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the IWDG module.
+ * @details This file contains the private macros and registers for the IWDG module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/IWDG
+ * @brief IWDG Module
+ * @details This module contains all the APIs related to the Independent Watchdog
+ */
+
+#ifndef _IWDG_PRIVATE_H_
+#define _IWDG_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup iwdg_module IWDG Module
+ * @brief IWDG Module
+ * @details This module contains all the APIs related to the Independent Watchdog
+ * @{
+ */
+
+/**
+ * @defgroup iwdg_registers IWDG Registers
+ * @brief IWDG Registers
+ * @{
+ */
+
+/**
+ * @struct t_IWDG_RegisterMap
+ * @brief IWDG Register Map
+ * @details This type is used to access the IWDG registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Key Register
+	 * @warning This register is write-only
+	 */
+	t_u32 KR;
+	/**
+	 * @brief Prescaler Register
+	 */
+	t_u32 PR;
+	/**
+	 * @brief Reload Register
+	 */
+	t_u32 RLR;
+	/**
+	 * @brief Status Register
+	 * @warning This register is read-only
+	 */
+	t_u32 SR;
+} t_IWDG_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup iwdg_addresses IWDG Addresses
+ * @brief IWDG Addresses
+ * @details This module contains the addresses of the IWDG registers
+ * @{
+ */
+
+/**
+ * @def IWDG_BASE_ADDRESS
+ * @brief IWDG Base Address in the memory
+ */
+#define IWDG_BASE_ADDRESS REGISTER_ADDRESS(0x40003000, 0)
+
+/**
+ * @def IWDG
+ * @brief IWDG Register Map
+ */
+#define IWDG REGISTER(t_IWDG_RegisterMap, IWDG_BASE_ADDRESS)
+
+/**
+ * @def IWDG_DBGMCU_CR
+ * @brief Debug MCU Configuration Register, it holds the bit that stops the watchdog while the core is halted
+ */
+#define IWDG_DBGMCU_CR REGISTER_U32(REGISTER_ADDRESS(0xE0042004, 0))
+
+/** @} */
+
+/**
+ * @defgroup iwdg_constants IWDG Constants
+ * @brief IWDG Constants
+ * @{
+ */
+
+/**
+ * @def IWDG_KEY_RELOAD
+ * @brief The key that reloads the counter
+ */
+#define IWDG_KEY_RELOAD ((t_u32)0xAAAAU)
+
+/**
+ * @def IWDG_KEY_ACCESS
+ * @brief The key that unlocks the PR and RLR registers
+ */
+#define IWDG_KEY_ACCESS ((t_u32)0x5555U)
+
+/**
+ * @def IWDG_KEY_START
+ * @brief The key that starts the watchdog, it cannot be stopped afterwards except by a reset
+ */
+#define IWDG_KEY_START ((t_u32)0xCCCCU)
+
+/**
+ * @def IWDG_SR_PVU
+ * @brief Set while a prescaler value update is in progress
+ */
+#define IWDG_SR_PVU (0)
+
+/**
+ * @def IWDG_SR_RVU
+ * @brief Set while a reload value update is in progress
+ */
+#define IWDG_SR_RVU (1)
+
+/**
+ * @def IWDG_PRESCALER_MAX
+ * @brief The largest value of the prescaler register (divide by 256)
+ */
+#define IWDG_PRESCALER_MAX (6U)
+
+/**
+ * @def IWDG_RELOAD_MAX
+ * @brief The largest value of the 12-bit reload register
+ */
+#define IWDG_RELOAD_MAX ((t_u32)0x0FFFU)
+
+/**
+ * @def IWDG_DBGMCU_CR_DBG_IWDG_STOP
+ * @brief The bit that stops the watchdog counter while the core is halted by the debugger
+ */
+#define IWDG_DBGMCU_CR_DBG_IWDG_STOP (8)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _IWDG_PRIVATE_H_ */
@@ -0,0 +1,83 @@
+/**
+ * @file IWDG_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the IWDG module.
+ * @details This file contains the implementation for the IWDG module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "IWDG_private.h"
+#include "IWDG_interface.h"
+#include "IWDG_config.h"
+
+/**
+ * @brief The programmed timeout in milliseconds
+ */
+STATIC t_u32 u32IWDGTimeoutMs = 0;
+
+t_bool IWDG_bStart(t_u32 u32TimeoutMs)
+{
+	t_bool bStatus = FALSE;
+	t_u32 u32Prescaler = 0;
+	t_u32 u32Ticks = 0;
+
+	/* The LSI counts IWDG_LSI_FREQUENCY / 1000 cycles per millisecond, the prescaler divides by 4 << PR */
+	if ((u32TimeoutMs != 0U) && (u32TimeoutMs <= ((IWDG_RELOAD_MAX + 1U) * (4U << IWDG_PRESCALER_MAX) / (IWDG_LSI_FREQUENCY / 1000U))))
+	{
+		u32Ticks = (u32TimeoutMs * (IWDG_LSI_FREQUENCY / 1000U)) / 4U;
+
+		while (u32Ticks > (IWDG_RELOAD_MAX + 1U))
+		{
+			u32Prescaler++;
+			u32Ticks = (u32TimeoutMs * (IWDG_LSI_FREQUENCY / 1000U)) / (4U << u32Prescaler);
+		}
+
+		if (u32Ticks == 0U)
+		{
+			u32Ticks = 1U;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+#if IWDG_STOP_IN_DEBUG == 1
+		SET_BIT(IWDG_DBGMCU_CR, IWDG_DBGMCU_CR_DBG_IWDG_STOP);
+#endif
+
+		/* Start first so that the LSI runs, the registers of the low-speed domain take a few LSI cycles to update */
+		IWDG.KR = IWDG_KEY_START;
+		IWDG.KR = IWDG_KEY_ACCESS;
+		IWDG.PR = u32Prescaler;
+		IWDG.RLR = u32Ticks - 1U;
+
+		while ((GET_BIT(IWDG.SR, IWDG_SR_PVU) != 0U) || (GET_BIT(IWDG.SR, IWDG_SR_RVU) != 0U))
+			;
+
+		IWDG.KR = IWDG_KEY_RELOAD;
+
+		u32IWDGTimeoutMs = (u32Ticks * (4U << u32Prescaler)) / (IWDG_LSI_FREQUENCY / 1000U);
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void IWDG_vRefresh(void)
+{
+	IWDG.KR = IWDG_KEY_RELOAD;
+}
+
+t_u32 IWDG_u32GetTimeoutMs(void)
+{
+	return u32IWDGTimeoutMs;
+}
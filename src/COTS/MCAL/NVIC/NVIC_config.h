@@ -0,0 +1,55 @@
+/**
+ * @file NVIC_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the NVIC module.
+ * @details This file contains the configuration parameters for the NVIC module.
+ * @date 2026-10-19
+ */
+
+#ifndef _NVIC_CONFIG_H_
+#define _NVIC_CONFIG_H_
+
+#include "../../LIB/LSTD_VALUES.h"
+#include "NVIC_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup nvic_module
+ * @{
+ */
+
+/**
+ * @defgroup nvic_config NVIC Configuration
+ * @brief This group contains the configuration parameters of the NVIC module
+ * @{
+ */
+
+/**
+ * @def NVIC_PRIORITY_GROUPING
+ * @brief This macro defines the priority grouping
+ * @details This macro defines how the priority bits are split between group priority and sub-priority
+ * @see t_NVIC_PriorityGrouping
+ */
+#define NVIC_PRIORITY_GROUPING (NVIC_PriorityGrouping_16Groups_0Sub)
+
+/**
+ * @def NVIC_VECTOR_TABLE_IN_RAM
+ * @brief This macro defines whether the vector table is relocated to RAM
+ * @details When enabled, NVIC_vInit() copies the flash vector table into the `.isr_vector_ram` section and points VTOR at it,
+ * so handlers can be installed at run time using NVIC_bSetHandler()
+ * Options:
+ * 	- FALSE: The vector table stays in flash
+ * 	- TRUE: The vector table is relocated to RAM
+ */
+#define NVIC_VECTOR_TABLE_IN_RAM (FALSE)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _NVIC_CONFIG_H_ */
@@ -0,0 +1,420 @@
+/**
+ * @file NVIC_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the NVIC module.
+ * @details This file contains the prototypes of the functions of the NVIC module.
+ * @date 2026-10-19
+ */
+
+#ifndef _NVIC_INTERFACE_H_
+#define _NVIC_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup nvic_module
+ * @{
+ */
+
+/**
+ * @typedef t_NVIC_IRQs
+ * @brief NVIC Interrupt Numbers
+ * @details This type is used to select a peripheral interrupt of the STM32F103 (medium density) microcontroller
+ */
+typedef enum
+{
+	/**
+	 * @brief Window watchdog interrupt
+	 */
+	NVIC_IRQs_WWDG = 0,
+	/**
+	 * @brief PVD through EXTI line detection interrupt
+	 */
+	NVIC_IRQs_PVD,
+	/**
+	 * @brief Tamper interrupt
+	 */
+	NVIC_IRQs_TAMPER,
+	/**
+	 * @brief RTC global interrupt
+	 */
+	NVIC_IRQs_RTC,
+	/**
+	 * @brief Flash global interrupt
+	 */
+	NVIC_IRQs_FLASH,
+	/**
+	 * @brief RCC global interrupt
+	 */
+	NVIC_IRQs_RCC,
+	/**
+	 * @brief EXTI line 0 interrupt
+	 */
+	NVIC_IRQs_EXTI0,
+	/**
+	 * @brief EXTI line 1 interrupt
+	 */
+	NVIC_IRQs_EXTI1,
+	/**
+	 * @brief EXTI line 2 interrupt
+	 */
+	NVIC_IRQs_EXTI2,
+	/**
+	 * @brief EXTI line 3 interrupt
+	 */
+	NVIC_IRQs_EXTI3,
+	/**
+	 * @brief EXTI line 4 interrupt
+	 */
+	NVIC_IRQs_EXTI4,
+	/**
+	 * @brief DMA1 channel 1 global interrupt
+	 */
+	NVIC_IRQs_DMA1_Channel1,
+	/**
+	 * @brief DMA1 channel 2 global interrupt
+	 */
+	NVIC_IRQs_DMA1_Channel2,
+	/**
+	 * @brief DMA1 channel 3 global interrupt
+	 */
+	NVIC_IRQs_DMA1_Channel3,
+	/**
+	 * @brief DMA1 channel 4 global interrupt
+	 */
+	NVIC_IRQs_DMA1_Channel4,
+	/**
+	 * @brief DMA1 channel 5 global interrupt
+	 */
+	NVIC_IRQs_DMA1_Channel5,
+	/**
+	 * @brief DMA1 channel 6 global interrupt
+	 */
+	NVIC_IRQs_DMA1_Channel6,
+	/**
+	 * @brief DMA1 channel 7 global interrupt
+	 */
+	NVIC_IRQs_DMA1_Channel7,
+	/**
+	 * @brief ADC1 and ADC2 global interrupt
+	 */
+	NVIC_IRQs_ADC1_2,
+	/**
+	 * @brief USB high priority or CAN TX interrupts
+	 */
+	NVIC_IRQs_USB_HP_CAN_TX,
+	/**
+	 * @brief USB low priority or CAN RX0 interrupts
+	 */
+	NVIC_IRQs_USB_LP_CAN_RX0,
+	/**
+	 * @brief CAN RX1 interrupt
+	 */
+	NVIC_IRQs_CAN_RX1,
+	/**
+	 * @brief CAN SCE interrupt
+	 */
+	NVIC_IRQs_CAN_SCE,
+	/**
+	 * @brief EXTI lines [9:5] interrupts
+	 */
+	NVIC_IRQs_EXTI9_5,
+	/**
+	 * @brief TIM1 break interrupt
+	 */
+	NVIC_IRQs_TIM1_BRK,
+	/**
+	 * @brief TIM1 update interrupt
+	 */
+	NVIC_IRQs_TIM1_UP,
+	/**
+	 * @brief TIM1 trigger and commutation interrupts
+	 */
+	NVIC_IRQs_TIM1_TRG_COM,
+	/**
+	 * @brief TIM1 capture compare interrupt
+	 */
+	NVIC_IRQs_TIM1_CC,
+	/**
+	 * @brief TIM2 global interrupt
+	 */
+	NVIC_IRQs_TIM2,
+	/**
+	 * @brief TIM3 global interrupt
+	 */
+	NVIC_IRQs_TIM3,
+	/**
+	 * @brief TIM4 global interrupt
+	 */
+	NVIC_IRQs_TIM4,
+	/**
+	 * @brief I2C1 event interrupt
+	 */
+	NVIC_IRQs_I2C1_EV,
+	/**
+	 * @brief I2C1 error interrupt
+	 */
+	NVIC_IRQs_I2C1_ER,
+	/**
+	 * @brief I2C2 event interrupt
+	 */
+	NVIC_IRQs_I2C2_EV,
+	/**
+	 * @brief I2C2 error interrupt
+	 */
+	NVIC_IRQs_I2C2_ER,
+	/**
+	 * @brief SPI1 global interrupt
+	 */
+	NVIC_IRQs_SPI1,
+	/**
+	 * @brief SPI2 global interrupt
+	 */
+	NVIC_IRQs_SPI2,
+	/**
+	 * @brief USART1 global interrupt
+	 */
+	NVIC_IRQs_USART1,
+	/**
+	 * @brief USART2 global interrupt
+	 */
+	NVIC_IRQs_USART2,
+	/**
+	 * @brief USART3 global interrupt
+	 */
+	NVIC_IRQs_USART3,
+	/**
+	 * @brief EXTI lines [15:10] interrupts
+	 */
+	NVIC_IRQs_EXTI15_10,
+	/**
+	 * @brief RTC alarm through EXTI line interrupt
+	 */
+	NVIC_IRQs_RTCAlarm,
+	/**
+	 * @brief USB wakeup from suspend through EXTI line interrupt
+	 */
+	NVIC_IRQs_USBWakeUp
+} t_NVIC_IRQs;
+
+/**
+ * @typedef t_NVIC_PriorityGrouping
+ * @brief NVIC Priority Grouping
+ * @details This type is used to select how the 4 implemented priority bits are split between group (preemption) priority and sub-priority
+ */
+typedef enum
+{
+	/**
+	 * @brief 4 bits for group priority, 0 bits for sub-priority
+	 */
+	NVIC_PriorityGrouping_16Groups_0Sub = 3,
+	/**
+	 * @brief 3 bits for group priority, 1 bit for sub-priority
+	 */
+	NVIC_PriorityGrouping_8Groups_2Sub,
+	/**
+	 * @brief 2 bits for group priority, 2 bits for sub-priority
+	 */
+	NVIC_PriorityGrouping_4Groups_4Sub,
+	/**
+	 * @brief 1 bit for group priority, 3 bits for sub-priority
+	 */
+	NVIC_PriorityGrouping_2Groups_8Sub,
+	/**
+	 * @brief 0 bits for group priority, 4 bits for sub-priority
+	 */
+	NVIC_PriorityGrouping_1Group_16Sub
+} t_NVIC_PriorityGrouping;
+
+/**
+ * @typedef t_NVIC_SystemHandlers
+ * @brief NVIC System Handlers
+ * @details This type is used to select a core exception that has a configurable priority, the values are the exception numbers
+ */
+typedef enum
+{
+	/**
+	 * @brief Memory management fault
+	 */
+	NVIC_SystemHandlers_MemManage = 4,
+	/**
+	 * @brief Bus fault
+	 */
+	NVIC_SystemHandlers_BusFault,
+	/**
+	 * @brief Usage fault
+	 */
+	NVIC_SystemHandlers_UsageFault,
+	/**
+	 * @brief Supervisor call
+	 */
+	NVIC_SystemHandlers_SVCall = 11,
+	/**
+	 * @brief Debug monitor
+	 */
+	NVIC_SystemHandlers_DebugMonitor,
+	/**
+	 * @brief Pendable service request
+	 */
+	NVIC_SystemHandlers_PendSV = 14,
+	/**
+	 * @brief System tick timer
+	 */
+	NVIC_SystemHandlers_SysTick
+} t_NVIC_SystemHandlers;
+
+/**
+ * @struct t_NVIC_FaultStatus
+ * @brief NVIC Fault Status
+ * @details This type is used to read the fault status and address registers of the core at once
+ */
+typedef struct
+{
+	/**
+	 * @brief Configurable Fault Status Register (MemManage, BusFault and UsageFault status)
+	 */
+	t_u32 u32CFSR;
+	/**
+	 * @brief HardFault Status Register
+	 */
+	t_u32 u32HFSR;
+	/**
+	 * @brief MemManage Fault Address Register (valid if CFSR.MMARVALID is set)
+	 */
+	t_u32 u32MMFAR;
+	/**
+	 * @brief BusFault Address Register (valid if CFSR.BFARVALID is set)
+	 */
+	t_u32 u32BFAR;
+} t_NVIC_FaultStatus;
+
+/**
+ * @typedef t_NVIC_Handler
+ * @brief NVIC Interrupt Handler
+ * @details This type is used to define an interrupt service routine installed at run time
+ */
+typedef P2FUNC(void, t_NVIC_Handler)(void);
+
+/**
+ * @brief This function initializes the NVIC
+ * @details This function applies the configured priority grouping and relocates the vector table to RAM if enabled
+ * @see NVIC_PRIORITY_GROUPING NVIC_VECTOR_TABLE_IN_RAM
+ */
+void NVIC_vInit(void);
+
+/**
+ * @brief This function enables a peripheral interrupt
+ * @details This function enables a peripheral interrupt in the NVIC
+ * @param[in] tIRQ The interrupt to enable
+ * @see t_NVIC_IRQs
+ */
+void NVIC_vEnableIRQ(t_NVIC_IRQs tIRQ);
+
+/**
+ * @brief This function disables a peripheral interrupt
+ * @details This function disables a peripheral interrupt in the NVIC
+ * @param[in] tIRQ The interrupt to disable
+ * @see t_NVIC_IRQs
+ */
+void NVIC_vDisableIRQ(t_NVIC_IRQs tIRQ);
+
+/**
+ * @brief This function sets the pending flag of a peripheral interrupt
+ * @details This function sets the pending flag of a peripheral interrupt (software triggered interrupt)
+ * @param[in] tIRQ The interrupt to set pending
+ * @see t_NVIC_IRQs
+ */
+void NVIC_vSetPendingIRQ(t_NVIC_IRQs tIRQ);
+
+/**
+ * @brief This function clears the pending flag of a peripheral interrupt
+ * @details This function clears the pending flag of a peripheral interrupt
+ * @param[in] tIRQ The interrupt to clear its pending flag
+ * @see t_NVIC_IRQs
+ */
+void NVIC_vClearPendingIRQ(t_NVIC_IRQs tIRQ);
+
+/**
+ * @brief This function checks whether a peripheral interrupt is currently being serviced
+ * @details This function checks whether a peripheral interrupt is currently being serviced
+ * @param[in] tIRQ The interrupt to check
+ * @return TRUE if the interrupt is active, FALSE otherwise
+ * @see t_NVIC_IRQs
+ */
+t_bool NVIC_bIsActiveIRQ(t_NVIC_IRQs tIRQ);
+
+/**
+ * @brief This function sets the priority of a peripheral interrupt
+ * @details This function sets the priority of a peripheral interrupt, lower values mean higher priority
+ * @param[in] tIRQ The interrupt to set its priority
+ * @param[in] u8Priority The priority value (0 to 15), its split between group and sub-priority depends on the priority grouping
+ * @see t_NVIC_IRQs t_NVIC_PriorityGrouping
+ */
+void NVIC_vSetPriority(t_NVIC_IRQs tIRQ, t_u8 u8Priority);
+
+/**
+ * @brief This function sets the priority of a core exception
+ * @details This function sets the priority of a core exception, lower values mean higher priority
+ * @param[in] tHandler The core exception to set its priority
+ * @param[in] u8Priority The priority value (0 to 15), its split between group and sub-priority depends on the priority grouping
+ * @see t_NVIC_SystemHandlers t_NVIC_PriorityGrouping
+ */
+void NVIC_vSetSystemHandlerPriority(t_NVIC_SystemHandlers tHandler, t_u8 u8Priority);
+
+/**
+ * @brief This function sets the pending flag of the PendSV exception
+ * @details The exception is taken once no other exception of a higher priority is active, this is where
+ * a kernel switches the context
+ */
+void NVIC_vSetPendingPendSV(void);
+
+/**
+ * @brief This function installs an interrupt service routine at run time
+ * @details This function writes the handler directly into the RAM vector table, so the core jumps to it without any extra indirection
+ * @param[in] tIRQ The interrupt to install its handler
+ * @param[in] pfHandler The interrupt service routine
+ * @return TRUE if the handler is installed, FALSE if the vector table is not relocated to RAM
+ * @note The handler replaces the one linked in the flash vector table (e.g. a driver's `<PERIPHERAL>_IRQHandler`)
+ * @see t_NVIC_IRQs t_NVIC_Handler NVIC_VECTOR_TABLE_IN_RAM
+ */
+t_bool NVIC_bSetHandler(t_NVIC_IRQs tIRQ, t_NVIC_Handler pfHandler);
+
+/**
+ * @brief This function gets the interrupt service routine currently installed for an interrupt
+ * @details This function reads the handler from the active vector table (RAM or flash)
+ * @param[in] tIRQ The interrupt to get its handler
+ * @return The installed interrupt service routine
+ * @see t_NVIC_IRQs t_NVIC_Handler
+ */
+t_NVIC_Handler NVIC_pfGetHandler(t_NVIC_IRQs tIRQ);
+
+/**
+ * @brief This function gets the number of the active exception
+ * @return The exception number (0 in thread mode, 3 for a HardFault, 16 and above for the peripheral interrupts)
+ */
+t_u16 NVIC_u16GetActiveException(void);
+
+/**
+ * @brief This function reads the fault status and address registers
+ * @param[out] ptStatus The fault status
+ * @see t_NVIC_FaultStatus
+ */
+void NVIC_vGetFaultStatus(P2VAR(t_NVIC_FaultStatus) ptStatus);
+
+/**
+ * @brief This function requests a system reset and waits for it
+ * @details The reset keeps the SRAM content, so the `.noinit` variables survive it
+ */
+void NVIC_vSystemReset(void);
+
+/** @} */
+/** @} */
+
+#endif /* _NVIC_INTERFACE_H_ */
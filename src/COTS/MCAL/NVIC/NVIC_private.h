@@ -0,0 +1,293 @@
+/**
+ * @file NVIC_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the NVIC module.
+ * @details This file contains the private macros and registers for the NVIC module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/NVIC
+ * @brief NVIC Module
+ * @details This module contains all the APIs related to the nested vectored interrupt controller
+ */
+
+#ifndef _NVIC_PRIVATE_H_
+#define _NVIC_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup nvic_module NVIC Module
+ * @brief NVIC Module
+ * @details This module contains all the APIs related to the nested vectored interrupt controller
+ * @{
+ */
+
+/**
+ * @defgroup nvic_registers NVIC Registers
+ * @brief NVIC Registers
+ * @{
+ */
+
+/**
+ * @struct t_NVIC_RegisterMap
+ * @brief NVIC Register Map
+ * @details This type is used to access the NVIC registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Interrupt Set-Enable Registers
+	 */
+	t_u32 ISER[8];
+	/**
+	 * @brief Reserved
+	 */
+	t_u32 RESERVED0[24];
+	/**
+	 * @brief Interrupt Clear-Enable Registers
+	 */
+	t_u32 ICER[8];
+	/**
+	 * @brief Reserved
+	 */
+	t_u32 RESERVED1[24];
+	/**
+	 * @brief Interrupt Set-Pending Registers
+	 */
+	t_u32 ISPR[8];
+	/**
+	 * @brief Reserved
+	 */
+	t_u32 RESERVED2[24];
+	/**
+	 * @brief Interrupt Clear-Pending Registers
+	 */
+	t_u32 ICPR[8];
+	/**
+	 * @brief Reserved
+	 */
+	t_u32 RESERVED3[24];
+	/**
+	 * @brief Interrupt Active Bit Registers
+	 * @warning This register is read-only
+	 */
+	t_u32 IABR[8];
+	/**
+	 * @brief Reserved
+	 */
+	t_u32 RESERVED4[56];
+	/**
+	 * @brief Interrupt Priority Registers (one byte per interrupt)
+	 */
+	t_u8 IPR[240];
+} t_NVIC_RegisterMap;
+
+/**
+ * @struct t_SCB_RegisterMap
+ * @brief System Control Block Register Map
+ * @details This type is used to access the SCB registers needed by the NVIC module
+ */
+typedef struct
+{
+	/**
+	 * @brief CPUID Base Register
+	 * @warning This register is read-only
+	 */
+	t_u32 CPUID;
+	/**
+	 * @brief Interrupt Control and State Register
+	 */
+	t_u32 ICSR;
+	/**
+	 * @brief Vector Table Offset Register
+	 */
+	t_u32 VTOR;
+	/**
+	 * @brief Application Interrupt and Reset Control Register
+	 */
+	t_u32 AIRCR;
+	/**
+	 * @brief System Control Register
+	 */
+	t_u32 SCR;
+	/**
+	 * @brief Configuration and Control Register
+	 */
+	t_u32 CCR;
+	/**
+	 * @brief System Handler Priority Registers (one byte per system handler, starting from MemManage)
+	 */
+	t_u8 SHPR[12];
+	/**
+	 * @brief System Handler Control and State Register
+	 */
+	t_u32 SHCSR;
+	/**
+	 * @brief Configurable Fault Status Register
+	 */
+	t_u32 CFSR;
+	/**
+	 * @brief HardFault Status Register
+	 */
+	t_u32 HFSR;
+	/**
+	 * @brief Debug Fault Status Register
+	 */
+	t_u32 DFSR;
+	/**
+	 * @brief MemManage Fault Address Register
+	 */
+	t_u32 MMFAR;
+	/**
+	 * @brief BusFault Address Register
+	 */
+	t_u32 BFAR;
+} t_SCB_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup nvic_addresses NVIC Addresses
+ * @brief NVIC Addresses
+ * @details This module contains the addresses of the NVIC registers
+ * @{
+ */
+
+/**
+ * @def NVIC_BASE_ADDRESS
+ * @brief NVIC Base Address in the memory
+ */
+#define NVIC_BASE_ADDRESS REGISTER_ADDRESS(0xE000E100, 0)
+
+/**
+ * @def NVIC
+ * @brief NVIC Register Map
+ */
+#define NVIC REGISTER(t_NVIC_RegisterMap, NVIC_BASE_ADDRESS)
+
+/**
+ * @def SCB_BASE_ADDRESS
+ * @brief System Control Block Base Address in the memory
+ */
+#define SCB_BASE_ADDRESS REGISTER_ADDRESS(0xE000ED00, 0)
+
+/**
+ * @def SCB
+ * @brief System Control Block Register Map
+ */
+#define SCB REGISTER(t_SCB_RegisterMap, SCB_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup nvic_constants NVIC Constants
+ * @brief NVIC Constants
+ * @{
+ */
+
+/**
+ * @def NVIC_REGISTER_INDEX
+ * @brief Get the index of the 32-bit register that holds the bit of a certain interrupt
+ * @param[in] IRQ The interrupt number
+ */
+#define NVIC_REGISTER_INDEX(IRQ) ((IRQ) >> 5)
+
+/**
+ * @def NVIC_REGISTER_BIT
+ * @brief Get the bit mask of a certain interrupt inside its 32-bit register
+ * @param[in] IRQ The interrupt number
+ */
+#define NVIC_REGISTER_BIT(IRQ) ((t_u32)1U << ((IRQ) & 0x1FU))
+
+/**
+ * @def NVIC_PRIORITY_BITS
+ * @brief Number of implemented priority bits in the STM32F1 family
+ */
+#define NVIC_PRIORITY_BITS (4)
+
+/**
+ * @def NVIC_PRIORITY_SHIFT
+ * @brief Shift of the implemented priority bits inside the 8-bit priority field
+ */
+#define NVIC_PRIORITY_SHIFT (8 - NVIC_PRIORITY_BITS)
+
+/**
+ * @def SCB_ICSR_PENDSVSET
+ * @brief PendSV set-pending bit in the ICSR register
+ */
+#define SCB_ICSR_PENDSVSET (28)
+
+/**
+ * @def SCB_ICSR_VECTACTIVE_MASK
+ * @brief Mask of the active exception number field in the ICSR register
+ */
+#define SCB_ICSR_VECTACTIVE_MASK ((t_u32)0x000001FFU)
+
+/**
+ * @def SCB_AIRCR_SYSRESETREQ
+ * @brief System reset request bit in the AIRCR register
+ */
+#define SCB_AIRCR_SYSRESETREQ (2)
+
+/**
+ * @def SCB_AIRCR_VECTKEY
+ * @brief The key that must be written with any write to the AIRCR register
+ */
+#define SCB_AIRCR_VECTKEY ((t_u32)0x05FA0000U)
+
+/**
+ * @def SCB_AIRCR_VECTKEY_MASK
+ * @brief Mask of the VECTKEY field in the AIRCR register (reads back as VECTKEYSTAT)
+ */
+#define SCB_AIRCR_VECTKEY_MASK ((t_u32)0xFFFF0000U)
+
+/**
+ * @def SCB_AIRCR_PRIGROUP_SHIFT
+ * @brief Shift of the PRIGROUP field in the AIRCR register
+ */
+#define SCB_AIRCR_PRIGROUP_SHIFT (8)
+
+/**
+ * @def SCB_AIRCR_PRIGROUP_MASK
+ * @brief Mask of the PRIGROUP field in the AIRCR register
+ */
+#define SCB_AIRCR_PRIGROUP_MASK ((t_u32)0x00000700U)
+
+/**
+ * @def NVIC_SYSTEM_VECTORS_COUNT
+ * @brief Number of the core exception vectors preceding the peripheral interrupts in the vector table
+ */
+#define NVIC_SYSTEM_VECTORS_COUNT (16)
+
+/**
+ * @def NVIC_VECTORS_COUNT
+ * @brief Number of the vectors copied to the RAM vector table (core exceptions and STM32F103 interrupts)
+ */
+#define NVIC_VECTORS_COUNT (NVIC_SYSTEM_VECTORS_COUNT + NVIC_IRQs_USBWakeUp + 1)
+
+/**
+ * @def NVIC_RAM_VECTOR_TABLE_SIZE
+ * @brief Number of entries reserved for the RAM vector table (power of two, not less than NVIC_VECTORS_COUNT)
+ */
+#define NVIC_RAM_VECTOR_TABLE_SIZE (64)
+
+/**
+ * @def NVIC_RAM_VECTOR_TABLE_ALIGNMENT
+ * @brief Alignment of the RAM vector table in bytes, VTOR needs the table size rounded up to a power of two
+ */
+#define NVIC_RAM_VECTOR_TABLE_ALIGNMENT (NVIC_RAM_VECTOR_TABLE_SIZE * 4)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _NVIC_PRIVATE_H_ */
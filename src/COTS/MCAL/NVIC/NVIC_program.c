@@ -0,0 +1,174 @@
+/**
+ * @file NVIC_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the NVIC module.
+ * @details This file contains the implementation for the NVIC module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "NVIC_private.h"
+#include "NVIC_interface.h"
+#include "NVIC_config.h"
+
+/**
+ * @brief The RAM copy of the vector table
+ * @details It is only referenced when NVIC_VECTOR_TABLE_IN_RAM is enabled, otherwise it is removed by the linker
+ */
+STATIC t_NVIC_Handler apfRAMVectorTable[NVIC_RAM_VECTOR_TABLE_SIZE] SECTION(".isr_vector_ram") ALIGNED(NVIC_RAM_VECTOR_TABLE_ALIGNMENT);
+
+/**
+ * @brief This function relocates the vector table to RAM
+ * @details This function copies the active vector table into the RAM table then points VTOR at it
+ */
+STATIC void NVIC_vRelocateVectorTable(void)
+{
+	/* Get the active vector table (flash) */
+	P2CONST(t_NVIC_Handler)
+	pfFlashVectorTable = (P2CONST(t_NVIC_Handler))SCB.VTOR;
+	/* Store the interrupts state */
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+	/* Store the index of the vector being copied */
+	t_u8 u8Vector = 0;
+
+	if (SCB.VTOR != (t_u32)apfRAMVectorTable)
+	{
+		/* Copy the vectors */
+		for (u8Vector = 0; u8Vector < NVIC_VECTORS_COUNT; u8Vector++)
+		{
+			apfRAMVectorTable[u8Vector] = pfFlashVectorTable[u8Vector];
+		}
+
+		/* Make sure the table is written before the core fetches any vector from it */
+		CPU_DSB();
+		SCB.VTOR = (t_u32)apfRAMVectorTable;
+		CPU_DSB();
+		CPU_ISB();
+	}
+	else
+	{
+		/* Do nothing, already relocated */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+}
+
+void NVIC_vInit(void)
+{
+	/* Set the priority grouping (the write must carry the VECTKEY) */
+	SCB.AIRCR = SCB_AIRCR_VECTKEY | (SCB.AIRCR & ~(SCB_AIRCR_VECTKEY_MASK | SCB_AIRCR_PRIGROUP_MASK)) | ((t_u32)NVIC_PRIORITY_GROUPING << SCB_AIRCR_PRIGROUP_SHIFT);
+
+	if (NVIC_VECTOR_TABLE_IN_RAM == TRUE)
+	{
+		NVIC_vRelocateVectorTable();
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+void NVIC_vEnableIRQ(t_NVIC_IRQs tIRQ)
+{
+	/* The set-enable registers ignore zeros, so no read-modify-write is needed */
+	NVIC.ISER[NVIC_REGISTER_INDEX(tIRQ)] = NVIC_REGISTER_BIT(tIRQ);
+}
+
+void NVIC_vDisableIRQ(t_NVIC_IRQs tIRQ)
+{
+	/* The clear-enable registers ignore zeros, so no read-modify-write is needed */
+	NVIC.ICER[NVIC_REGISTER_INDEX(tIRQ)] = NVIC_REGISTER_BIT(tIRQ);
+}
+
+void NVIC_vSetPendingIRQ(t_NVIC_IRQs tIRQ)
+{
+	NVIC.ISPR[NVIC_REGISTER_INDEX(tIRQ)] = NVIC_REGISTER_BIT(tIRQ);
+}
+
+void NVIC_vClearPendingIRQ(t_NVIC_IRQs tIRQ)
+{
+	NVIC.ICPR[NVIC_REGISTER_INDEX(tIRQ)] = NVIC_REGISTER_BIT(tIRQ);
+}
+
+t_bool NVIC_bIsActiveIRQ(t_NVIC_IRQs tIRQ)
+{
+	return ((NVIC.IABR[NVIC_REGISTER_INDEX(tIRQ)] & NVIC_REGISTER_BIT(tIRQ)) != 0U) ? TRUE : FALSE;
+}
+
+void NVIC_vSetPriority(t_NVIC_IRQs tIRQ, t_u8 u8Priority)
+{
+	/* Only the upper bits of the priority byte are implemented */
+	NVIC.IPR[tIRQ] = (t_u8)(u8Priority << NVIC_PRIORITY_SHIFT);
+}
+
+void NVIC_vSetSystemHandlerPriority(t_NVIC_SystemHandlers tHandler, t_u8 u8Priority)
+{
+	/* The system handler priority bytes start from the MemManage exception */
+	SCB.SHPR[tHandler - NVIC_SystemHandlers_MemManage] = (t_u8)(u8Priority << NVIC_PRIORITY_SHIFT);
+}
+
+void NVIC_vSetPendingPendSV(void)
+{
+	/* The other bits of the register are either read-only or ignore zeros */
+	SCB.ICSR = (t_u32)1 << SCB_ICSR_PENDSVSET;
+}
+
+t_bool NVIC_bSetHandler(t_NVIC_IRQs tIRQ, t_NVIC_Handler pfHandler)
+{
+	t_bool bInstalled = FALSE;
+
+	if ((NVIC_VECTOR_TABLE_IN_RAM == TRUE) && (SCB.VTOR == (t_u32)apfRAMVectorTable))
+	{
+		/* A single aligned word write, so the vector is never seen half-written */
+		apfRAMVectorTable[NVIC_SYSTEM_VECTORS_COUNT + tIRQ] = pfHandler;
+		CPU_DSB();
+		bInstalled = TRUE;
+	}
+	else
+	{
+		/* Do nothing, the flash vector table cannot be modified */
+	}
+
+	return bInstalled;
+}
+
+t_NVIC_Handler NVIC_pfGetHandler(t_NVIC_IRQs tIRQ)
+{
+	/* Get the active vector table */
+	P2CONST(t_NVIC_Handler)
+	pfVectorTable = (P2CONST(t_NVIC_Handler))SCB.VTOR;
+
+	return pfVectorTable[NVIC_SYSTEM_VECTORS_COUNT + tIRQ];
+}
+
+t_u16 NVIC_u16GetActiveException(void)
+{
+	return (t_u16)(SCB.ICSR & SCB_ICSR_VECTACTIVE_MASK);
+}
+
+void NVIC_vGetFaultStatus(P2VAR(t_NVIC_FaultStatus) ptStatus)
+{
+	ptStatus->u32CFSR = SCB.CFSR;
+	ptStatus->u32HFSR = SCB.HFSR;
+	ptStatus->u32MMFAR = SCB.MMFAR;
+	ptStatus->u32BFAR = SCB.BFAR;
+}
+
+void NVIC_vSystemReset(void)
+{
+	/* Let the pending memory writes complete before the reset */
+	CPU_DSB();
+
+	/* Keep the priority grouping, the write must carry the VECTKEY */
+	SCB.AIRCR = SCB_AIRCR_VECTKEY | (SCB.AIRCR & SCB_AIRCR_PRIGROUP_MASK) | ((t_u32)1 << SCB_AIRCR_SYSRESETREQ);
+	CPU_DSB();
+
+	for (;;)
+	{
+		/* Wait for the reset */
+	}
+}
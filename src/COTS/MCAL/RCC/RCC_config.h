@@ -29,6 +29,13 @@
  * @{
  */
 
+/**
+ * @def RCC_HSE_FREQUENCY
+ * @brief This macro defines the frequency of the external clock in Hz
+ * @details This macro defines the frequency of the external clock, it is used to compute the bus frequencies at run time
+ */
+#define RCC_HSE_FREQUENCY ((t_u32)8000000UL)
+
 /**
  * @def RCC_PLL_SRC
  * @brief This macro defines the PLL source
@@ -10,6 +10,8 @@
 #ifndef _RCC_INTERFACE_H_
 #define _RCC_INTERFACE_H_
 
+#include "../../LIB/LSTD_TYPES.h"
+
 /**
  * @addtogroup mcal
  * @{
@@ -508,6 +510,51 @@ void RCC_vEnablePeripheralAHB(t_RCC_AHBPeripherals enuPeripheral);
  */
 void RCC_vDisablePeripheralAHB(t_RCC_AHBPeripherals enuPeripheral);
 
+/**
+ * @brief This function resets a peripheral connected to the APB2 bus
+ * @details This function pulses the reset bit of the peripheral, all its registers return to their reset values
+ * @param[in] enuPeripheral Peripheral to be reset
+ * @note The peripheral values are the bit positions in both RCC_APB2ENR and RCC_APB2RSTR
+ */
+void RCC_vResetPeripheralAPB2(t_RCC_APB2Peripherals enuPeripheral);
+
+/**
+ * @brief This function resets a peripheral connected to the APB1 bus
+ * @details This function pulses the reset bit of the peripheral, all its registers return to their reset values
+ * @param[in] enuPeripheral Peripheral to be reset
+ * @note The peripheral values are the bit positions in both RCC_APB1ENR and RCC_APB1RSTR
+ */
+void RCC_vResetPeripheralAPB1(t_RCC_APB1Peripherals enuPeripheral);
+
+/**
+ * @brief This function gets the system clock frequency
+ * @details This function computes the system clock frequency from the current clock source and PLL settings
+ * @return The system clock frequency in Hz
+ * @see RCC_HSE_FREQUENCY
+ */
+t_u32 RCC_u32GetSystemClockFrequency(void);
+
+/**
+ * @brief This function gets the AHB bus clock frequency
+ * @details This function computes the AHB bus (HCLK) frequency from the system clock and the current AHB prescaler
+ * @return The AHB clock frequency in Hz
+ */
+t_u32 RCC_u32GetAHBClockFrequency(void);
+
+/**
+ * @brief This function gets the APB1 bus clock frequency
+ * @details This function computes the APB1 bus (PCLK1) frequency from the AHB clock and the current APB1 prescaler
+ * @return The APB1 clock frequency in Hz
+ */
+t_u32 RCC_u32GetAPB1ClockFrequency(void);
+
+/**
+ * @brief This function gets the APB2 bus clock frequency
+ * @details This function computes the APB2 bus (PCLK2) frequency from the AHB clock and the current APB2 prescaler
+ * @return The APB2 clock frequency in Hz
+ */
+t_u32 RCC_u32GetAPB2ClockFrequency(void);
+
 /** @} */
 /** @} */
 /** @} */
@@ -1010,6 +1010,51 @@ typedef struct
  */
 #define RCC_SET_REGISTER_BIT_STATUS(REG, BIT, BSTATUS) SET_REGISTER_BIT_STATUS(RCC, REG, BIT, BSTATUS)
 
+/** @} */
+
+/**
+ * @defgroup rcc_constants RCC Constants
+ * @brief RCC Constants
+ * @{
+ */
+
+/**
+ * @def RCC_HSI_FREQUENCY
+ * @brief Frequency of the internal high speed oscillator in Hz
+ */
+#define RCC_HSI_FREQUENCY ((t_u32)8000000UL)
+
+/**
+ * @def RCC_PLL_MUL_OFFSET
+ * @brief Difference between the PLL multiplication factor and the PLLMUL field value
+ */
+#define RCC_PLL_MUL_OFFSET (2)
+
+/**
+ * @def RCC_PLL_MUL_MAX
+ * @brief Maximum PLL multiplication factor (the last two PLLMUL values both select x16)
+ */
+#define RCC_PLL_MUL_MAX (16)
+
+/**
+ * @def RCC_AHB_PRESCALER_DIVIDED
+ * @brief HPRE bit that selects a divided AHB clock, the lower bits then select the division factor
+ */
+#define RCC_AHB_PRESCALER_DIVIDED (0b1000)
+
+/**
+ * @def RCC_APB_PRESCALER_DIVIDED
+ * @brief PPREx bit that selects a divided APB clock, the lower bits then select the division factor
+ */
+#define RCC_APB_PRESCALER_DIVIDED (0b100)
+
+/**
+ * @def RCC_PRESCALER_FACTOR_MASK(DIVIDED)
+ * @brief Mask of the division factor bits of the HPRE/PPREx fields
+ * @param[in] DIVIDED The bit of the field that selects a divided clock
+ */
+#define RCC_PRESCALER_FACTOR_MASK(DIVIDED) ((DIVIDED) - 1)
+
 /** @} */
 /** @} */
 /** @} */
@@ -15,6 +15,37 @@
 #include "RCC_interface.h"
 #include "RCC_config.h"
 
+/**
+ * @brief The AHB division factors (as shifts) selected by the lower bits of HPRE
+ */
+STATIC CONST t_u8 au8AHBPrescalerShifts[8] = {1, 2, 3, 4, 6, 7, 8, 9};
+
+/**
+ * @brief This function applies an AHB/APB prescaler field to a clock frequency
+ * @details All the bus prescalers are powers of two, so the division is done with a shift
+ * @param[in] u32Frequency The input clock frequency
+ * @param[in] u8Prescaler The HPRE/PPREx field value
+ * @param[in] u8Divided The bit of the field that selects a divided clock
+ * @return t_u32 The output clock frequency
+ */
+STATIC t_u32 RCC_u32ApplyPrescaler(t_u32 u32Frequency, t_u8 u8Prescaler, t_u8 u8Divided)
+{
+	if ((u8Prescaler & u8Divided) == 0)
+	{
+		/* Not divided */
+	}
+	else if (u8Divided == RCC_AHB_PRESCALER_DIVIDED)
+	{
+		u32Frequency >>= au8AHBPrescalerShifts[u8Prescaler & RCC_PRESCALER_FACTOR_MASK(RCC_AHB_PRESCALER_DIVIDED)];
+	}
+	else
+	{
+		u32Frequency >>= ((u8Prescaler & RCC_PRESCALER_FACTOR_MASK(RCC_APB_PRESCALER_DIVIDED)) + 1);
+	}
+
+	return u32Frequency;
+}
+
 /**
  * @brief This function initializes the HSE clock
  * @details This function initializes the HSE clock and waits until it is ready
@@ -378,3 +409,79 @@ void RCC_vDisablePeripheralAHB(t_RCC_AHBPeripherals enuPeripheral)
 {
 	RCC_vSetAHBPeripheralClockStatus(enuPeripheral, FALSE);
 }
+
+void RCC_vResetPeripheralAPB2(t_RCC_APB2Peripherals enuPeripheral)
+{
+	/* Access the bit-field register as a whole word to pulse the bit selected at run time */
+	P2VAR(VOLATILE t_u32) pu32APB2RSTR = (P2VAR(VOLATILE t_u32))&RCC.APB2RSTR;
+
+	SET_BIT(*pu32APB2RSTR, enuPeripheral);
+	*pu32APB2RSTR &= ~((t_u32)1U << enuPeripheral);
+}
+
+void RCC_vResetPeripheralAPB1(t_RCC_APB1Peripherals enuPeripheral)
+{
+	/* Access the bit-field register as a whole word to pulse the bit selected at run time */
+	P2VAR(VOLATILE t_u32) pu32APB1RSTR = (P2VAR(VOLATILE t_u32))&RCC.APB1RSTR;
+
+	SET_BIT(*pu32APB1RSTR, enuPeripheral);
+	*pu32APB1RSTR &= ~((t_u32)1U << enuPeripheral);
+}
+
+t_u32 RCC_u32GetSystemClockFrequency(void)
+{
+	t_u32 u32Frequency = RCC_HSI_FREQUENCY;
+	t_u32 u32Multiplier = 0;
+
+	if (RCC.CFGR.SWS == RCC_SystemClock_HSE)
+	{
+		u32Frequency = RCC_HSE_FREQUENCY;
+	}
+	else if (RCC.CFGR.SWS == RCC_SystemClock_PLL)
+	{
+		/* Get the PLL input clock */
+		if (RCC.CFGR.PLLSRC == RCC_PLLSource_HSE)
+		{
+			u32Frequency = RCC_HSE_FREQUENCY >> RCC.CFGR.PLLXTPRE;
+		}
+		else
+		{
+			u32Frequency = RCC_HSI_FREQUENCY >> 1;
+		}
+
+		/* Apply the PLL multiplication factor */
+		u32Multiplier = RCC.CFGR.PLLMUL + RCC_PLL_MUL_OFFSET;
+
+		if (u32Multiplier > RCC_PLL_MUL_MAX)
+		{
+			u32Multiplier = RCC_PLL_MUL_MAX;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		u32Frequency *= u32Multiplier;
+	}
+	else
+	{
+		/* HSI */
+	}
+
+	return u32Frequency;
+}
+
+t_u32 RCC_u32GetAHBClockFrequency(void)
+{
+	return RCC_u32ApplyPrescaler(RCC_u32GetSystemClockFrequency(), RCC.CFGR.HPRE, RCC_AHB_PRESCALER_DIVIDED);
+}
+
+t_u32 RCC_u32GetAPB1ClockFrequency(void)
+{
+	return RCC_u32ApplyPrescaler(RCC_u32GetAHBClockFrequency(), RCC.CFGR.PPRE1, RCC_APB_PRESCALER_DIVIDED);
+}
+
+t_u32 RCC_u32GetAPB2ClockFrequency(void)
+{
+	return RCC_u32ApplyPrescaler(RCC_u32GetAHBClockFrequency(), RCC.CFGR.PPRE2, RCC_APB_PRESCALER_DIVIDED);
+}
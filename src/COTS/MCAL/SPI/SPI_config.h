@@ -0,0 +1,42 @@
+/**
+ * @file SPI_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the SPI module.
+ * @details This file contains the configuration parameters for the SPI module.
+ * @date 2026-10-19
+ */
+
+#ifndef _SPI_CONFIG_H_
+#define _SPI_CONFIG_H_
+
+#include "SPI_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup spi_module
+ * @{
+ */
+
+/**
+ * @defgroup spi_config SPI Configuration
+ * @brief This group contains the configuration parameters of the SPI module
+ * @{
+ */
+
+/**
+ * @def SPI_IRQ_PRIORITY
+ * @brief This macro defines the NVIC priority of the SPI and SPI DMA interrupts
+ * @details This macro defines the NVIC priority of the SPI and SPI DMA interrupts (0 to 15)
+ */
+#define SPI_IRQ_PRIORITY (3)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _SPI_CONFIG_H_ */
@@ -0,0 +1,278 @@
+/**
+ * @file SPI_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the SPI module.
+ * @details This file contains the prototypes of the functions of the SPI module.
+ * @date 2026-10-19
+ */
+
+#ifndef _SPI_INTERFACE_H_
+#define _SPI_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../GPIO/GPIO_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup spi_module
+ * @{
+ */
+
+/**
+ * @typedef t_SPI_Peripherals
+ * @brief SPI Peripherals
+ * @details This type is used to select a SPI peripheral
+ */
+typedef enum
+{
+	/**
+	 * @brief SPI1 (APB2), SCK: PA5, MISO: PA6, MOSI: PA7
+	 */
+	SPI_Peripherals_SPI1 = 0,
+	/**
+	 * @brief SPI2 (APB1), SCK: PB13, MISO: PB14, MOSI: PB15
+	 */
+	SPI_Peripherals_SPI2
+} t_SPI_Peripherals;
+
+/**
+ * @typedef t_SPI_TransferMode
+ * @brief SPI Transfer Mode
+ * @details This type is used to select how the transactions of a SPI peripheral move their data
+ */
+typedef enum
+{
+	/**
+	 * @brief The CPU moves every byte and waits for the transaction to finish before returning
+	 */
+	SPI_TransferMode_Polled = 0,
+	/**
+	 * @brief Every received byte raises an interrupt that sends the next one
+	 */
+	SPI_TransferMode_Interrupt,
+	/**
+	 * @brief Two DMA channels move the data, one interrupt per transaction
+	 */
+	SPI_TransferMode_DMA
+} t_SPI_TransferMode;
+
+/**
+ * @typedef t_SPI_ClockMode
+ * @brief SPI Clock Mode
+ * @details This type is used to select the clock polarity (CPOL) and phase (CPHA)
+ */
+typedef enum
+{
+	/**
+	 * @brief CPOL = 0, CPHA = 0
+	 */
+	SPI_ClockMode_0 = 0,
+	/**
+	 * @brief CPOL = 0, CPHA = 1
+	 */
+	SPI_ClockMode_1,
+	/**
+	 * @brief CPOL = 1, CPHA = 0
+	 */
+	SPI_ClockMode_2,
+	/**
+	 * @brief CPOL = 1, CPHA = 1
+	 */
+	SPI_ClockMode_3
+} t_SPI_ClockMode;
+
+/**
+ * @typedef t_SPI_Prescaler
+ * @brief SPI Clock Prescaler
+ * @details This type is used to select the division of the bus clock that gives the SPI clock
+ */
+typedef enum
+{
+	/**
+	 * @brief Bus clock divided by 2 (18 MHz on SPI1 with a 36 MHz APB2)
+	 */
+	SPI_Prescaler_DividedBy2 = 0,
+	/**
+	 * @brief Bus clock divided by 4
+	 */
+	SPI_Prescaler_DividedBy4,
+	/**
+	 * @brief Bus clock divided by 8
+	 */
+	SPI_Prescaler_DividedBy8,
+	/**
+	 * @brief Bus clock divided by 16
+	 */
+	SPI_Prescaler_DividedBy16,
+	/**
+	 * @brief Bus clock divided by 32
+	 */
+	SPI_Prescaler_DividedBy32,
+	/**
+	 * @brief Bus clock divided by 64
+	 */
+	SPI_Prescaler_DividedBy64,
+	/**
+	 * @brief Bus clock divided by 128
+	 */
+	SPI_Prescaler_DividedBy128,
+	/**
+	 * @brief Bus clock divided by 256
+	 */
+	SPI_Prescaler_DividedBy256
+} t_SPI_Prescaler;
+
+/**
+ * @typedef t_SPI_BitOrder
+ * @brief SPI Bit Order
+ * @details This type is used to select which bit of each byte is sent first
+ */
+typedef enum
+{
+	/**
+	 * @brief Most significant bit first
+	 */
+	SPI_BitOrder_MSBFirst = 0,
+	/**
+	 * @brief Least significant bit first
+	 */
+	SPI_BitOrder_LSBFirst
+} t_SPI_BitOrder;
+
+/**
+ * @struct t_SPI_Settings
+ * @brief SPI Clock Settings
+ * @details This type holds the clock settings of a slave, they are applied before each of its transactions
+ */
+typedef struct
+{
+	/**
+	 * @brief Clock prescaler
+	 */
+	t_SPI_Prescaler tPrescaler;
+	/**
+	 * @brief Clock polarity and phase
+	 */
+	t_SPI_ClockMode tClockMode;
+	/**
+	 * @brief Bit order
+	 */
+	t_SPI_BitOrder tBitOrder;
+} t_SPI_Settings;
+
+/**
+ * @typedef t_SPI_Status
+ * @brief SPI Transaction Status
+ * @details This type is used to report the result of a transaction
+ */
+typedef enum
+{
+	/**
+	 * @brief The transaction is queued or in progress
+	 */
+	SPI_Status_Pending = 0,
+	/**
+	 * @brief The transaction is done
+	 */
+	SPI_Status_Done,
+	/**
+	 * @brief A DMA bus error aborted the transaction, the received bytes are not valid
+	 */
+	SPI_Status_TransferError
+} t_SPI_Status;
+
+/**
+ * @struct s_SPI_Transaction
+ * @brief SPI Transaction
+ * @details This type describes one chip-select framed transfer, it is owned by the caller and linked in the
+ * queue of the peripheral until its callback is called
+ */
+typedef struct s_SPI_Transaction
+{
+	/**
+	 * @brief The bytes to send (NULL to send 0xFF dummy bytes)
+	 */
+	P2CONST(t_u8) pu8TxData;
+	/**
+	 * @brief The buffer of the received bytes (NULL to discard them)
+	 */
+	P2VAR(t_u8) pu8RxData;
+	/**
+	 * @brief The function called when the transaction is done (can be NULL)
+	 */
+	P2FUNC(void, pfCallback)(P2VAR(struct s_SPI_Transaction) ptTransaction);
+	/**
+	 * @brief The next transaction in the queue
+	 * @warning This field is used by the driver
+	 */
+	P2VAR(struct s_SPI_Transaction) ptNext;
+	/**
+	 * @brief The port of the chip-select pin (active low, configured as an output by the caller)
+	 */
+	t_GPIO_Ports tCSPort;
+	/**
+	 * @brief The chip-select pin
+	 */
+	t_GPIO_Pins tCSPin;
+	/**
+	 * @brief The clock settings of the slave
+	 */
+	t_SPI_Settings tSettings;
+	/**
+	 * @brief The result of the transaction, set by the driver before the callback is called
+	 */
+	VOLATILE t_SPI_Status tStatus;
+	/**
+	 * @brief The number of bytes to exchange (1 to 65535)
+	 */
+	t_u16 u16Length;
+	/**
+	 * @brief Unused, it completes the structure to a multiple of 4 bytes without any implicit padding
+	 */
+	t_u8 au8Reserved[2];
+} t_SPI_Transaction;
+
+/**
+ * @brief This function initializes a SPI peripheral as a master
+ * @details This function configures the SCK/MOSI/MISO pins and the peripheral, and selects how its transactions move their data
+ * @param[in] tSPI The SPI peripheral
+ * @param[in] tTransferMode The transfer mode of the transactions
+ * @return TRUE if the peripheral uses the requested transfer mode, FALSE if it falls back to the interrupt mode
+ * because one of its DMA channels is owned by another driver (SPI1 shares its channels with USART3,
+ * SPI2 shares them with USART1 and I2C2)
+ * @note The clocks of the SPI, its GPIO port and DMA1 (in DMA mode) must be enabled
+ * @see t_SPI_Peripherals t_SPI_TransferMode
+ */
+t_bool SPI_bInit(t_SPI_Peripherals tSPI, t_SPI_TransferMode tTransferMode);
+
+/**
+ * @brief This function queues a transaction
+ * @details The transactions of a peripheral run in order, the next one is started from the completion interrupt
+ * of the previous one before its callback runs, so the bus never waits for the application.
+ * In polled mode the transaction runs before the function returns. A transaction of 0 bytes is done at once without
+ * selecting the slave, its callback is called before the function returns
+ * @param[in] tSPI The SPI peripheral
+ * @param[in] ptTransaction The transaction (owned by the driver until its callback is called)
+ * @see t_SPI_Peripherals t_SPI_Transaction
+ */
+void SPI_vSubmit(t_SPI_Peripherals tSPI, P2VAR(t_SPI_Transaction) ptTransaction);
+
+/**
+ * @brief This function checks whether a SPI peripheral has transactions in progress
+ * @details This function checks whether a SPI peripheral has transactions in progress
+ * @param[in] tSPI The SPI peripheral
+ * @return TRUE if the queue is not empty, FALSE otherwise
+ * @see t_SPI_Peripherals
+ */
+t_bool SPI_bIsBusy(t_SPI_Peripherals tSPI);
+
+/** @} */
+/** @} */
+
+#endif /* _SPI_INTERFACE_H_ */
@@ -0,0 +1,244 @@
+/**
+ * @file SPI_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the SPI module.
+ * @details This file contains the private macros and registers for the SPI module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/SPI
+ * @brief SPI Module
+ * @details This module contains all the APIs related to the SPI peripherals
+ */
+
+#ifndef _SPI_PRIVATE_H_
+#define _SPI_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup spi_module SPI Module
+ * @brief SPI Module
+ * @details This module contains all the APIs related to the SPI peripherals
+ * @{
+ */
+
+/**
+ * @defgroup spi_registers SPI Registers
+ * @brief SPI Registers
+ * @{
+ */
+
+/**
+ * @struct t_SPI_RegisterMap
+ * @brief SPI Register Map
+ * @details This type is used to access the registers of one SPI peripheral
+ */
+typedef struct
+{
+	/**
+	 * @brief Control Register 1
+	 */
+	t_u32 CR1;
+	/**
+	 * @brief Control Register 2
+	 */
+	t_u32 CR2;
+	/**
+	 * @brief Status Register
+	 */
+	t_u32 SR;
+	/**
+	 * @brief Data Register
+	 */
+	t_u32 DR;
+	/**
+	 * @brief CRC Polynomial Register
+	 */
+	t_u32 CRCPR;
+	/**
+	 * @brief RX CRC Register
+	 */
+	t_u32 RXCRCR;
+	/**
+	 * @brief TX CRC Register
+	 */
+	t_u32 TXCRCR;
+	/**
+	 * @brief I2S Configuration Register
+	 */
+	t_u32 I2SCFGR;
+	/**
+	 * @brief I2S Prescaler Register
+	 */
+	t_u32 I2SPR;
+} t_SPI_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup spi_addresses SPI Addresses
+ * @brief SPI Addresses
+ * @details This module contains the addresses of the SPI registers
+ * @{
+ */
+
+/**
+ * @def SPI1_BASE_ADDRESS
+ * @brief SPI1 Base Address in the memory
+ */
+#define SPI1_BASE_ADDRESS REGISTER_ADDRESS(0x40013000, 0)
+
+/**
+ * @def SPI2_BASE_ADDRESS
+ * @brief SPI2 Base Address in the memory
+ */
+#define SPI2_BASE_ADDRESS REGISTER_ADDRESS(0x40003800, 0)
+
+/**
+ * @def SPI1
+ * @brief SPI1 Register Map
+ */
+#define SPI1 REGISTER(t_SPI_RegisterMap, SPI1_BASE_ADDRESS)
+
+/**
+ * @def SPI2
+ * @brief SPI2 Register Map
+ */
+#define SPI2 REGISTER(t_SPI_RegisterMap, SPI2_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup spi_constants SPI Constants
+ * @brief SPI Constants
+ * @{
+ */
+
+/**
+ * @def SPI_PERIPHERALS_COUNT
+ * @brief Number of the SPI peripherals
+ */
+#define SPI_PERIPHERALS_COUNT (2)
+
+/**
+ * @def SPI_CR1_CPHA
+ * @brief Clock phase bit
+ */
+#define SPI_CR1_CPHA (0)
+
+/**
+ * @def SPI_CR1_MSTR
+ * @brief Master selection bit
+ */
+#define SPI_CR1_MSTR (2)
+
+/**
+ * @def SPI_CR1_BR
+ * @brief Position of the baud rate control field
+ */
+#define SPI_CR1_BR (3)
+
+/**
+ * @def SPI_CR1_SPE
+ * @brief SPI enable bit
+ */
+#define SPI_CR1_SPE (6)
+
+/**
+ * @def SPI_CR1_LSBFIRST
+ * @brief Frame format bit (`1`: LSB transmitted first)
+ */
+#define SPI_CR1_LSBFIRST (7)
+
+/**
+ * @def SPI_CR1_SSI
+ * @brief Internal slave select bit
+ */
+#define SPI_CR1_SSI (8)
+
+/**
+ * @def SPI_CR1_SSM
+ * @brief Software slave management bit
+ */
+#define SPI_CR1_SSM (9)
+
+/**
+ * @def SPI_CR1_SETTINGS_MASK
+ * @brief Mask of the CR1 bits changed per transaction (CPHA, CPOL, BR and LSBFIRST)
+ */
+#define SPI_CR1_SETTINGS_MASK ((t_u32)0x000000BBU)
+
+/**
+ * @def SPI_CR2_RXDMAEN
+ * @brief RX buffer DMA enable bit
+ */
+#define SPI_CR2_RXDMAEN (0)
+
+/**
+ * @def SPI_CR2_TXDMAEN
+ * @brief TX buffer DMA enable bit
+ */
+#define SPI_CR2_TXDMAEN (1)
+
+/**
+ * @def SPI_CR2_RXNEIE
+ * @brief RX buffer not empty interrupt enable bit
+ */
+#define SPI_CR2_RXNEIE (6)
+
+/**
+ * @def SPI_SR_RXNE
+ * @brief Receive buffer not empty flag
+ */
+#define SPI_SR_RXNE (0)
+
+/**
+ * @def SPI_SR_TXE
+ * @brief Transmit buffer empty flag
+ */
+#define SPI_SR_TXE (1)
+
+/**
+ * @def SPI_SR_BSY
+ * @brief Busy flag
+ */
+#define SPI_SR_BSY (7)
+
+/**
+ * @def SPI_DUMMY_BYTE
+ * @brief The byte sent when a transaction has no transmit buffer
+ */
+#define SPI_DUMMY_BYTE ((t_u8)0xFF)
+
+/** @} */
+
+/**
+ * @defgroup spi_handlers SPI Interrupt Handlers
+ * @brief The interrupt handlers of the SPI module, they are referenced by the vector table
+ * @{
+ */
+
+/**
+ * @brief SPI1 interrupt handler
+ */
+void SPI1_IRQHandler(void);
+
+/**
+ * @brief SPI2 interrupt handler
+ */
+void SPI2_IRQHandler(void);
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _SPI_PRIVATE_H_ */
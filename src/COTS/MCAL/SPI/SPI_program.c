@@ -0,0 +1,507 @@
+/**
+ * @file SPI_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the SPI module.
+ * @details This file contains the implementation for the SPI module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../GPIO/GPIO_interface.h"
+#include "../NVIC/NVIC_interface.h"
+#include "../DMA/DMA_interface.h"
+#include "SPI_private.h"
+#include "SPI_interface.h"
+#include "SPI_config.h"
+
+/**
+ * @brief The register maps of the SPI peripherals
+ */
+STATIC P2VAR(VOLATILE t_SPI_RegisterMap) CONST aptSPIs[SPI_PERIPHERALS_COUNT] = {&SPI1, &SPI2};
+
+/**
+ * @brief The NVIC interrupts of the SPI peripherals
+ */
+STATIC CONST t_NVIC_IRQs atSPIIRQs[SPI_PERIPHERALS_COUNT] = {NVIC_IRQs_SPI1, NVIC_IRQs_SPI2};
+
+/**
+ * @brief The GPIO ports of the SPI pins
+ */
+STATIC CONST t_GPIO_Ports atSPIPorts[SPI_PERIPHERALS_COUNT] = {GPIO_Ports_A, GPIO_Ports_B};
+
+/**
+ * @brief The SCK pins of the SPI peripherals
+ */
+STATIC CONST t_GPIO_Pins atSPISCKPins[SPI_PERIPHERALS_COUNT] = {GPIO_Pins_5, GPIO_Pins_13};
+
+/**
+ * @brief The MISO pins of the SPI peripherals
+ */
+STATIC CONST t_GPIO_Pins atSPIMISOPins[SPI_PERIPHERALS_COUNT] = {GPIO_Pins_6, GPIO_Pins_14};
+
+/**
+ * @brief The MOSI pins of the SPI peripherals
+ */
+STATIC CONST t_GPIO_Pins atSPIMOSIPins[SPI_PERIPHERALS_COUNT] = {GPIO_Pins_7, GPIO_Pins_15};
+
+/**
+ * @brief The DMA channels that serve the SPI receivers
+ */
+STATIC CONST t_DMA_Channels atSPIDMARxChannels[SPI_PERIPHERALS_COUNT] = {DMA_CHANNEL_SPI1_RX, DMA_CHANNEL_SPI2_RX};
+
+/**
+ * @brief The DMA channels that serve the SPI transmitters
+ */
+STATIC CONST t_DMA_Channels atSPIDMATxChannels[SPI_PERIPHERALS_COUNT] = {DMA_CHANNEL_SPI1_TX, DMA_CHANNEL_SPI2_TX};
+
+/**
+ * @brief The byte sent by the DMA when a transaction has no transmit buffer
+ */
+STATIC CONST t_u8 u8SPIDummyByte = SPI_DUMMY_BYTE;
+
+/**
+ * @brief The byte written by the DMA when a transaction has no receive buffer
+ */
+STATIC t_u8 u8SPISinkByte = 0;
+
+/**
+ * @brief The transfer modes of the SPI peripherals
+ */
+STATIC t_SPI_TransferMode atSPITransferModes[SPI_PERIPHERALS_COUNT] = {SPI_TransferMode_Polled};
+
+/**
+ * @brief The first transaction of each queue (the one in progress)
+ */
+STATIC P2VAR(t_SPI_Transaction) VOLATILE aptSPIQueueHeads[SPI_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief The last transaction of each queue
+ */
+STATIC P2VAR(t_SPI_Transaction) VOLATILE aptSPIQueueTails[SPI_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief The number of bytes sent in interrupt mode
+ */
+STATIC t_u16 au16SPITxIndices[SPI_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The number of bytes received in interrupt mode
+ */
+STATIC t_u16 au16SPIRxIndices[SPI_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief This function applies the clock settings of a transaction
+ * @details The peripheral is only disabled when the settings differ from the ones already applied,
+ * so back-to-back transactions to the same slave cost a single register read
+ * @param[in] tSPI The SPI peripheral
+ * @param[in] ptSettings The clock settings
+ */
+STATIC void SPI_vApplySettings(t_SPI_Peripherals tSPI, P2CONST(t_SPI_Settings) ptSettings)
+{
+	P2VAR(VOLATILE t_SPI_RegisterMap) ptSPI = aptSPIs[tSPI];
+	/* CPOL and CPHA are the two lowest bits of CR1, in the same order as the clock mode value */
+	t_u32 u32CR1 = (ptSPI->CR1 & ~SPI_CR1_SETTINGS_MASK) | (t_u32)ptSettings->tClockMode | ((t_u32)ptSettings->tPrescaler << SPI_CR1_BR) | ((t_u32)ptSettings->tBitOrder << SPI_CR1_LSBFIRST);
+
+	if (u32CR1 != ptSPI->CR1)
+	{
+		/* The clock settings can only be changed while the peripheral is disabled */
+		ptSPI->CR1 &= ~((t_u32)1U << SPI_CR1_SPE);
+		ptSPI->CR1 = u32CR1 & ~((t_u32)1 << SPI_CR1_SPE);
+		SET_BIT(ptSPI->CR1, SPI_CR1_SPE);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function starts the data movement of a transaction using DMA
+ * @details The receive channel is enabled before the transmit channel so that no received byte is missed
+ * @param[in] tSPI The SPI peripheral
+ * @param[in] ptTransaction The transaction
+ */
+STATIC void SPI_vStartDMATransfer(t_SPI_Peripherals tSPI, P2CONST(t_SPI_Transaction) ptTransaction);
+
+/**
+ * @brief This function starts a transaction
+ * @details This function applies the slave settings, selects the slave then starts moving the data
+ * @param[in] tSPI The SPI peripheral
+ * @param[in] ptTransaction The transaction
+ */
+STATIC void SPI_vStartTransaction(t_SPI_Peripherals tSPI, P2CONST(t_SPI_Transaction) ptTransaction)
+{
+	P2VAR(VOLATILE t_SPI_RegisterMap) ptSPI = aptSPIs[tSPI];
+
+	SPI_vApplySettings(tSPI, &ptTransaction->tSettings);
+	GPIO_vSetPinValue(ptTransaction->tCSPort, ptTransaction->tCSPin, GPIO_Value_Low);
+
+	if (atSPITransferModes[tSPI] == SPI_TransferMode_DMA)
+	{
+		SPI_vStartDMATransfer(tSPI, ptTransaction);
+	}
+	else
+	{
+		/* Send the first byte, each received byte then sends the next one */
+		au16SPIRxIndices[tSPI] = 0U;
+		au16SPITxIndices[tSPI] = 1U;
+		SET_BIT(ptSPI->CR2, SPI_CR2_RXNEIE);
+		ptSPI->DR = (ptTransaction->pu8TxData != NULL) ? ptTransaction->pu8TxData[0] : SPI_DUMMY_BYTE;
+	}
+}
+
+/**
+ * @brief This function completes the transaction in progress and starts the next one
+ * @details The next transaction is started before the callback of the finished one so the bus does not wait for the application
+ * @param[in] tSPI The SPI peripheral
+ * @param[in] tStatus The result of the finished transaction
+ */
+STATIC void SPI_vCompleteTransaction(t_SPI_Peripherals tSPI, t_SPI_Status tStatus)
+{
+	P2VAR(t_SPI_Transaction) ptDone = aptSPIQueueHeads[tSPI];
+	P2VAR(t_SPI_Transaction) ptNext = NULL;
+	/* A higher priority interrupt can submit a transaction in between */
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	ptNext = ptDone->ptNext;
+	aptSPIQueueHeads[tSPI] = ptNext;
+
+	if (ptNext == NULL)
+	{
+		aptSPIQueueTails[tSPI] = NULL;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+
+	/* Release the slave */
+	GPIO_vSetPinValue(ptDone->tCSPort, ptDone->tCSPin, GPIO_Value_High);
+	ptDone->tStatus = tStatus;
+
+	if (ptNext != NULL)
+	{
+		SPI_vStartTransaction(tSPI, ptNext);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (ptDone->pfCallback != NULL)
+	{
+		ptDone->pfCallback(ptDone);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function serves the DMA events of the SPI channels
+ * @details The receive channel finishes last, its transfer complete (or error) event ends the transaction
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void SPI_vDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent)
+{
+	t_SPI_Peripherals tSPI = (tChannel == atSPIDMARxChannels[SPI_Peripherals_SPI1]) ? SPI_Peripherals_SPI1 : SPI_Peripherals_SPI2;
+
+	DMA_vStopChannel(atSPIDMARxChannels[tSPI]);
+	DMA_vStopChannel(atSPIDMATxChannels[tSPI]);
+	aptSPIs[tSPI]->CR2 = 0U;
+
+	/* A bus error disables the channel before the last byte, the received data is not complete */
+	SPI_vCompleteTransaction(tSPI, (tEvent == DMA_Events_TransferComplete) ? SPI_Status_Done : SPI_Status_TransferError);
+}
+
+STATIC void SPI_vStartDMATransfer(t_SPI_Peripherals tSPI, P2CONST(t_SPI_Transaction) ptTransaction)
+{
+	P2VAR(VOLATILE t_SPI_RegisterMap) ptSPI = aptSPIs[tSPI];
+	t_DMA_ChannelConfig tDMAConfig;
+
+	tDMAConfig.u32PeripheralAddress = (t_u32)&ptSPI->DR;
+	tDMAConfig.u16Count = ptTransaction->u16Length;
+	tDMAConfig.tPeripheralSize = DMA_Size_8Bits;
+	tDMAConfig.tMemorySize = DMA_Size_8Bits;
+	tDMAConfig.bPeripheralIncrement = FALSE;
+	tDMAConfig.bCircular = FALSE;
+
+	/* Receive into the caller buffer or into a single sink byte */
+	tDMAConfig.u32MemoryAddress = (ptTransaction->pu8RxData != NULL) ? (t_u32)ptTransaction->pu8RxData : (t_u32)&u8SPISinkByte;
+	tDMAConfig.bMemoryIncrement = (ptTransaction->pu8RxData != NULL) ? TRUE : FALSE;
+	tDMAConfig.tDirection = DMA_Direction_PeripheralToMemory;
+	tDMAConfig.tPriority = DMA_Priority_VeryHigh;
+	tDMAConfig.u8Events = DMA_Events_TransferComplete | DMA_Events_TransferError;
+	tDMAConfig.pfCallback = SPI_vDMAEventHandler;
+	DMA_vConfigureChannel(atSPIDMARxChannels[tSPI], &tDMAConfig);
+
+	/* Send from the caller buffer or repeat the dummy byte */
+	tDMAConfig.u32MemoryAddress = (ptTransaction->pu8TxData != NULL) ? (t_u32)ptTransaction->pu8TxData : (t_u32)&u8SPIDummyByte;
+	tDMAConfig.bMemoryIncrement = (ptTransaction->pu8TxData != NULL) ? TRUE : FALSE;
+	tDMAConfig.tDirection = DMA_Direction_MemoryToPeripheral;
+	tDMAConfig.tPriority = DMA_Priority_High;
+	tDMAConfig.u8Events = DMA_Events_None;
+	tDMAConfig.pfCallback = NULL;
+	DMA_vConfigureChannel(atSPIDMATxChannels[tSPI], &tDMAConfig);
+
+	SET_BIT(ptSPI->CR2, SPI_CR2_RXDMAEN);
+	DMA_vStartChannel(atSPIDMARxChannels[tSPI]);
+	DMA_vStartChannel(atSPIDMATxChannels[tSPI]);
+	SET_BIT(ptSPI->CR2, SPI_CR2_TXDMAEN);
+}
+
+/**
+ * @brief This function runs a transaction with the CPU moving every byte
+ * @details This function runs a transaction with the CPU moving every byte
+ * @param[in] tSPI The SPI peripheral
+ * @param[in] ptTransaction The transaction
+ */
+STATIC void SPI_vRunPolledTransaction(t_SPI_Peripherals tSPI, P2VAR(t_SPI_Transaction) ptTransaction)
+{
+	P2VAR(VOLATILE t_SPI_RegisterMap) ptSPI = aptSPIs[tSPI];
+	t_u16 u16Index = 0;
+	t_u8 u8Data = 0;
+
+	SPI_vApplySettings(tSPI, &ptTransaction->tSettings);
+	GPIO_vSetPinValue(ptTransaction->tCSPort, ptTransaction->tCSPin, GPIO_Value_Low);
+
+	for (u16Index = 0; u16Index < ptTransaction->u16Length; u16Index++)
+	{
+		while (GET_BIT(ptSPI->SR, SPI_SR_TXE) == 0)
+			;
+
+		ptSPI->DR = (ptTransaction->pu8TxData != NULL) ? ptTransaction->pu8TxData[u16Index] : SPI_DUMMY_BYTE;
+
+		while (GET_BIT(ptSPI->SR, SPI_SR_RXNE) == 0)
+			;
+
+		u8Data = (t_u8)ptSPI->DR;
+
+		if (ptTransaction->pu8RxData != NULL)
+		{
+			ptTransaction->pu8RxData[u16Index] = u8Data;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	/* Wait for the last clock edge before releasing the slave */
+	while (GET_BIT(ptSPI->SR, SPI_SR_BSY) != 0)
+		;
+
+	GPIO_vSetPinValue(ptTransaction->tCSPort, ptTransaction->tCSPin, GPIO_Value_High);
+	ptTransaction->tStatus = SPI_Status_Done;
+
+	if (ptTransaction->pfCallback != NULL)
+	{
+		ptTransaction->pfCallback(ptTransaction);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function serves the interrupt of a SPI peripheral
+ * @details Reading the received byte and sending the next one in the same interrupt keeps exactly one byte in flight,
+ * so the receiver can never overrun
+ * @param[in] tSPI The SPI peripheral
+ */
+STATIC void SPI_vHandleIRQ(t_SPI_Peripherals tSPI)
+{
+	P2VAR(VOLATILE t_SPI_RegisterMap) ptSPI = aptSPIs[tSPI];
+	P2VAR(t_SPI_Transaction) ptTransaction = aptSPIQueueHeads[tSPI];
+	t_u8 u8Data = 0;
+
+	if ((GET_BIT(ptSPI->SR, SPI_SR_RXNE) != 0) && (ptTransaction != NULL))
+	{
+		u8Data = (t_u8)ptSPI->DR;
+
+		if (ptTransaction->pu8RxData != NULL)
+		{
+			ptTransaction->pu8RxData[au16SPIRxIndices[tSPI]] = u8Data;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		au16SPIRxIndices[tSPI]++;
+
+		if (au16SPITxIndices[tSPI] < ptTransaction->u16Length)
+		{
+			ptSPI->DR = (ptTransaction->pu8TxData != NULL) ? ptTransaction->pu8TxData[au16SPITxIndices[tSPI]] : SPI_DUMMY_BYTE;
+			au16SPITxIndices[tSPI]++;
+		}
+		else
+		{
+			/* The last byte is received, the bus is idle */
+			ptSPI->CR2 &= ~((t_u32)1U << SPI_CR2_RXNEIE);
+			SPI_vCompleteTransaction(tSPI, SPI_Status_Done);
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool SPI_bInit(t_SPI_Peripherals tSPI, t_SPI_TransferMode tTransferMode)
+{
+	P2VAR(VOLATILE t_SPI_RegisterMap) ptSPI = aptSPIs[tSPI];
+	t_bool bStatus = TRUE;
+
+	atSPITransferModes[tSPI] = tTransferMode;
+	aptSPIQueueHeads[tSPI] = NULL;
+	aptSPIQueueTails[tSPI] = NULL;
+
+	/* SCK and MOSI are alternate function outputs, MISO is an input */
+	GPIO_vSetPinDirection(atSPIPorts[tSPI], atSPISCKPins[tSPI], GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinOutputType(atSPIPorts[tSPI], atSPISCKPins[tSPI], GPIO_Output_Type_Alternate_Push_Pull);
+	GPIO_vSetPinDirection(atSPIPorts[tSPI], atSPIMOSIPins[tSPI], GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinOutputType(atSPIPorts[tSPI], atSPIMOSIPins[tSPI], GPIO_Output_Type_Alternate_Push_Pull);
+	GPIO_vSetPinDirection(atSPIPorts[tSPI], atSPIMISOPins[tSPI], GPIO_Direction_Input);
+	GPIO_vSetPinInputType(atSPIPorts[tSPI], atSPIMISOPins[tSPI], GPIO_Input_Type_Floating);
+
+	/* Master with software slave management, the chip-selects are plain GPIO outputs */
+	ptSPI->CR1 = 0U;
+	ptSPI->CR2 = 0U;
+	ptSPI->CR1 = ((t_u32)1 << SPI_CR1_MSTR) | ((t_u32)1 << SPI_CR1_SSM) | ((t_u32)1 << SPI_CR1_SSI) | ((t_u32)1 << SPI_CR1_SPE);
+
+	if (tTransferMode == SPI_TransferMode_DMA)
+	{
+		/* The transactions need both channels, without them they fall back to one interrupt per byte */
+		if (DMA_bAllocateChannel(atSPIDMARxChannels[tSPI], (P2CONST(void))ptSPI) == TRUE)
+		{
+			if (DMA_bAllocateChannel(atSPIDMATxChannels[tSPI], (P2CONST(void))ptSPI) == TRUE)
+			{
+				DMA_vSetChannelPriority(atSPIDMARxChannels[tSPI], SPI_IRQ_PRIORITY);
+			}
+			else
+			{
+				DMA_vReleaseChannel(atSPIDMARxChannels[tSPI]);
+				bStatus = FALSE;
+			}
+		}
+		else
+		{
+			bStatus = FALSE;
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == FALSE)
+	{
+		atSPITransferModes[tSPI] = SPI_TransferMode_Interrupt;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (atSPITransferModes[tSPI] == SPI_TransferMode_Interrupt)
+	{
+		NVIC_vSetPriority(atSPIIRQs[tSPI], SPI_IRQ_PRIORITY);
+		NVIC_vEnableIRQ(atSPIIRQs[tSPI]);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void SPI_vSubmit(t_SPI_Peripherals tSPI, P2VAR(t_SPI_Transaction) ptTransaction)
+{
+	t_bool bStart = FALSE;
+	t_u32 u32PRIMASK = 0;
+
+	ptTransaction->tStatus = SPI_Status_Pending;
+
+	if (ptTransaction->u16Length == 0U)
+	{
+		/* Nothing to exchange, a zero DMA count would never complete and block the queue */
+		ptTransaction->tStatus = SPI_Status_Done;
+
+		if (ptTransaction->pfCallback != NULL)
+		{
+			ptTransaction->pfCallback(ptTransaction);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else if (atSPITransferModes[tSPI] == SPI_TransferMode_Polled)
+	{
+		SPI_vRunPolledTransaction(tSPI, ptTransaction);
+	}
+	else
+	{
+		ptTransaction->ptNext = NULL;
+
+		/* The completion interrupt removes transactions from the head of the same queue */
+		u32PRIMASK = CPU_u32EnterCritical();
+
+		if (aptSPIQueueTails[tSPI] == NULL)
+		{
+			aptSPIQueueHeads[tSPI] = ptTransaction;
+			bStart = TRUE;
+		}
+		else
+		{
+			aptSPIQueueTails[tSPI]->ptNext = ptTransaction;
+		}
+
+		aptSPIQueueTails[tSPI] = ptTransaction;
+
+		CPU_vExitCritical(u32PRIMASK);
+
+		/* The queue was idle, no interrupt will start this transaction */
+		if (bStart == TRUE)
+		{
+			SPI_vStartTransaction(tSPI, ptTransaction);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+}
+
+t_bool SPI_bIsBusy(t_SPI_Peripherals tSPI)
+{
+	return (aptSPIQueueHeads[tSPI] != NULL) ? TRUE : FALSE;
+}
+
+/**
+ * @brief SPI1 interrupt handler
+ */
+void SPI1_IRQHandler(void)
+{
+	SPI_vHandleIRQ(SPI_Peripherals_SPI1);
+}
+
+/**
+ * @brief SPI2 interrupt handler
+ */
+void SPI2_IRQHandler(void)
+{
+	SPI_vHandleIRQ(SPI_Peripherals_SPI2);
+}
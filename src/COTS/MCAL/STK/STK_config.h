@@ -0,0 +1,43 @@
+/**
+ * @file STK_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the STK module.
+ * @details This file contains the configuration parameters for the STK module.
+ * @date 2026-10-19
+ */
+
+#ifndef _STK_CONFIG_H_
+#define _STK_CONFIG_H_
+
+#include "STK_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup stk_module
+ * @{
+ */
+
+/**
+ * @defgroup stk_config STK Configuration
+ * @brief This group contains the configuration parameters of the STK module
+ * @{
+ */
+
+/**
+ * @def STK_IRQ_PRIORITY
+ * @brief This macro defines the priority of the SysTick exception
+ * @details This macro defines the priority of the SysTick exception (0 to 15), the tick only counts time so it
+ * can run below the peripheral interrupts
+ */
+#define STK_IRQ_PRIORITY (14)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _STK_CONFIG_H_ */
@@ -0,0 +1,69 @@
+/**
+ * @file STK_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the STK module.
+ * @details This file contains the prototypes of the functions of the STK module.
+ * @date 2026-10-19
+ */
+
+#ifndef _STK_INTERFACE_H_
+#define _STK_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup stk_module
+ * @{
+ */
+
+/**
+ * @typedef t_STK_Callback
+ * @brief STK Callback
+ * @details This type is used to define the function called from the SysTick exception
+ */
+typedef P2FUNC(void, t_STK_Callback)(void);
+
+/**
+ * @brief This function starts the periodic SysTick exception
+ * @details The counter runs from the processor clock and reloads automatically, so the period has no drift
+ * @param[in] u32Frequency The number of the exceptions per second
+ * @param[in] pfCallback The function called on each exception (can be NULL)
+ * @return TRUE if the SysTick is started, FALSE if the frequency cannot be reached with the 24-bit counter
+ * @see RCC_u32GetAHBClockFrequency
+ */
+t_bool STK_bStartPeriodic(t_u32 u32Frequency, t_STK_Callback pfCallback);
+
+/**
+ * @brief This function stops the SysTick counter and its exception
+ */
+void STK_vStop(void);
+
+/**
+ * @brief This function gets the longest sleep that STK_u32SleepTicks() can do
+ * @return The number of the ticks that fit in the 24-bit counter
+ */
+t_u32 STK_u32GetMaxSleepTicks(void);
+
+/**
+ * @brief This function sleeps (WFI) for a number of ticks without any SysTick exception in between
+ * @details The counter is reloaded once with the whole sleep so that the core is not woken up by every tick (tickless idle).
+ * On wake up, the counter is aligned again on the tick period so that the ticks do not drift
+ * @param[in] u32Ticks The number of the ticks to sleep (2 to STK_u32GetMaxSleepTicks()) counted from the last tick
+ * @return The number of the ticks that elapsed and that will not raise the SysTick exception, the caller must account for them
+ * @warning This function must be called with the interrupts disabled (PRIMASK), an interrupt still wakes the core up
+ * and is served after the interrupts are enabled again
+ * @see STK_bStartPeriodic
+ */
+t_u32 STK_u32SleepTicks(t_u32 u32Ticks);
+
+/** @} */
+/** @} */
+
+#endif /* _STK_INTERFACE_H_ */
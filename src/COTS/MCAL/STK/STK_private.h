@@ -0,0 +1,129 @@
+/**
+ * @file STK_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the STK module.
+ * @details This file contains the private macros and registers for the STK module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/STK
+ * @brief STK Module
+ * @details This module contains all the APIs related to the SysTick timer of the Cortex-M3 core
+ */
+
+#ifndef _STK_PRIVATE_H_
+#define _STK_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup stk_module STK Module
+ * @brief STK Module
+ * @details This module contains all the APIs related to the SysTick timer of the Cortex-M3 core
+ * @{
+ */
+
+/**
+ * @defgroup stk_registers STK Registers
+ * @brief STK Registers
+ * @{
+ */
+
+/**
+ * @struct t_STK_RegisterMap
+ * @brief STK Register Map
+ * @details This type is used to access the SysTick registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Control and Status Register
+	 */
+	t_u32 CTRL;
+	/**
+	 * @brief Reload Value Register
+	 */
+	t_u32 LOAD;
+	/**
+	 * @brief Current Value Register
+	 */
+	t_u32 VAL;
+	/**
+	 * @brief Calibration Value Register
+	 * @warning This register is read-only
+	 */
+	t_u32 CALIB;
+} t_STK_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup stk_addresses STK Addresses
+ * @brief STK Addresses
+ * @details This module contains the addresses of the STK registers
+ * @{
+ */
+
+/**
+ * @def STK_BASE_ADDRESS
+ * @brief STK Base Address in the memory
+ */
+#define STK_BASE_ADDRESS REGISTER_ADDRESS(0xE000E010, 0)
+
+/**
+ * @def STK
+ * @brief STK Register Map
+ */
+#define STK REGISTER(t_STK_RegisterMap, STK_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup stk_constants STK Constants
+ * @brief STK Constants
+ * @{
+ */
+
+/**
+ * @def STK_CTRL_ENABLE
+ * @brief Counter enable bit
+ */
+#define STK_CTRL_ENABLE (0)
+
+/**
+ * @def STK_CTRL_TICKINT
+ * @brief Exception request enable bit, the exception is requested when the counter reaches zero
+ */
+#define STK_CTRL_TICKINT (1)
+
+/**
+ * @def STK_CTRL_CLKSOURCE
+ * @brief Clock source selection bit, set for the processor clock (AHB) and cleared for AHB/8
+ */
+#define STK_CTRL_CLKSOURCE (2)
+
+/**
+ * @def STK_CTRL_COUNTFLAG
+ * @brief Set when the counter reached zero since the last read of the register
+ */
+#define STK_CTRL_COUNTFLAG (16)
+
+/**
+ * @def STK_RELOAD_MAX
+ * @brief The largest value of the 24-bit reload register
+ */
+#define STK_RELOAD_MAX ((t_u32)0x00FFFFFFU)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _STK_PRIVATE_H_ */
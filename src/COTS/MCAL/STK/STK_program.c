@@ -0,0 +1,146 @@
+/**
+ * @file STK_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the STK module.
+ * @details This file contains the implementation for the STK module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "cortexm/ExceptionHandlers.h"
+#include "../RCC/RCC_interface.h"
+#include "../NVIC/NVIC_interface.h"
+#include "STK_private.h"
+#include "STK_interface.h"
+#include "STK_config.h"
+
+/**
+ * @brief The callback of the SysTick exception
+ */
+STATIC t_STK_Callback pfSTKCallback = NULL;
+
+/**
+ * @brief The number of the counter cycles of one tick
+ */
+STATIC t_u32 u32STKPeriod = 0;
+
+t_bool STK_bStartPeriodic(t_u32 u32Frequency, t_STK_Callback pfCallback)
+{
+	t_u32 u32Reload = 0;
+	t_bool bStatus = FALSE;
+
+	if (u32Frequency != 0U)
+	{
+		u32Reload = RCC_u32GetAHBClockFrequency() / u32Frequency;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* The counter counts from the reload value down to zero, so the period is the reload value plus one */
+	if ((u32Reload > 1U) && ((u32Reload - 1U) <= STK_RELOAD_MAX))
+	{
+		STK.CTRL = 0U;
+		pfSTKCallback = pfCallback;
+		u32STKPeriod = u32Reload;
+		STK.LOAD = u32Reload - 1U;
+		STK.VAL = 0U;
+		NVIC_vSetSystemHandlerPriority(NVIC_SystemHandlers_SysTick, STK_IRQ_PRIORITY);
+		STK.CTRL = ((t_u32)1 << STK_CTRL_ENABLE) | ((t_u32)1 << STK_CTRL_TICKINT) | ((t_u32)1 << STK_CTRL_CLKSOURCE);
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void STK_vStop(void)
+{
+	STK.CTRL = 0U;
+}
+
+t_u32 STK_u32GetMaxSleepTicks(void)
+{
+	return (u32STKPeriod != 0U) ? ((STK_RELOAD_MAX + 1U) / u32STKPeriod) : 0U;
+}
+
+t_u32 STK_u32SleepTicks(t_u32 u32Ticks)
+{
+	t_u32 u32Reload = 0;
+	t_u32 u32Elapsed = 0;
+	t_u32 u32Ticked = 0;
+	t_u32 u32Control = 0;
+
+	/* Stop the counter, the cycles left to the next tick start the sleep */
+	STK.CTRL &= ~((t_u32)1U << STK_CTRL_ENABLE);
+	u32Reload = STK.VAL + ((u32Ticks - 1U) * u32STKPeriod) - 1U;
+	STK.LOAD = u32Reload;
+	STK.VAL = 0U;
+	SET_BIT(STK.CTRL, STK_CTRL_ENABLE);
+
+	CPU_DSB();
+	CPU_WFI();
+	CPU_ISB();
+
+	/* Stop the counter again, reading the control register also clears the count flag */
+	u32Control = STK.CTRL;
+	STK.CTRL &= ~((t_u32)1U << STK_CTRL_ENABLE);
+
+	if (GET_BIT(u32Control, STK_CTRL_COUNTFLAG) != 0U)
+	{
+		/* The whole sleep elapsed, its last tick is pending and will be reported by the exception */
+		u32Ticked = u32Ticks - 1U;
+		u32Elapsed = u32Reload - STK.VAL;
+		u32Reload = (u32Elapsed < (u32STKPeriod - 1U)) ? ((u32STKPeriod - 1U) - u32Elapsed) : (u32STKPeriod - 1U);
+	}
+	else
+	{
+		/* Another interrupt ended the sleep, count the whole ticks from the last tick and finish the current one */
+		u32Elapsed = (u32Ticks * u32STKPeriod) - STK.VAL;
+		u32Ticked = u32Elapsed / u32STKPeriod;
+		u32Reload = ((u32Ticked + 1U) * u32STKPeriod) - u32Elapsed - 1U;
+
+		/* A zero reload stops the exceptions, let the next tick come one period later */
+		if (u32Reload == 0U)
+		{
+			u32Ticked++;
+			u32Reload = u32STKPeriod;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	/* Finish the current tick then go back to the tick period on the next reload */
+	STK.LOAD = u32Reload;
+	STK.VAL = 0U;
+	SET_BIT(STK.CTRL, STK_CTRL_ENABLE);
+	STK.LOAD = u32STKPeriod - 1U;
+
+	return u32Ticked;
+}
+
+/**
+ * @brief SysTick exception handler
+ */
+void SysTick_Handler(void)
+{
+	if (pfSTKCallback != NULL)
+	{
+		pfSTKCallback();
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
@@ -0,0 +1,51 @@
+/**
+ * @file TIM_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the TIM module.
+ * @details This file contains the configuration parameters for the TIM module.
+ * @date 2026-10-19
+ */
+
+#ifndef _TIM_CONFIG_H_
+#define _TIM_CONFIG_H_
+
+#include "TIM_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup tim_module
+ * @{
+ */
+
+/**
+ * @defgroup tim_config TIM Configuration
+ * @brief This group contains the configuration parameters of the TIM module
+ * @{
+ */
+
+/**
+ * @def TIM_IRQ_PRIORITY
+ * @brief This macro defines the NVIC priority of the TIM and TIM DMA interrupts
+ * @details This macro defines the NVIC priority of the TIM and TIM DMA interrupts (0 to 15), the overflows
+ * must be counted before the counter wraps around twice for the input capture timestamps to stay valid
+ */
+#define TIM_IRQ_PRIORITY (2)
+
+/**
+ * @def TIM_INPUT_CAPTURE_FILTER
+ * @brief This macro defines the digital filter of the input capture channels
+ * @details This macro defines the ICxF field value (0 to 15), 0 disables the filter and 3 requires 8 stable
+ * samples at the timer clock before an edge is accepted
+ */
+#define TIM_INPUT_CAPTURE_FILTER (3)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _TIM_CONFIG_H_ */
@@ -0,0 +1,384 @@
+/**
+ * @file TIM_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the TIM module.
+ * @details This file contains the prototypes of the functions of the TIM module.
+ * @date 2026-10-19
+ */
+
+#ifndef _TIM_INTERFACE_H_
+#define _TIM_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../DMA/DMA_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup tim_module
+ * @{
+ */
+
+/**
+ * @typedef t_TIM_Peripherals
+ * @brief TIM Peripherals
+ * @details This type is used to select a timer
+ */
+typedef enum
+{
+	/**
+	 * @brief TIM1 (advanced timer on APB2, channels on PA8 to PA11)
+	 */
+	TIM_Peripherals_TIM1 = 0,
+	/**
+	 * @brief TIM2 (channels on PA0 to PA3)
+	 */
+	TIM_Peripherals_TIM2,
+	/**
+	 * @brief TIM3 (channels on PA6, PA7, PB0 and PB1)
+	 */
+	TIM_Peripherals_TIM3,
+	/**
+	 * @brief TIM4 (channels on PB6 to PB9)
+	 */
+	TIM_Peripherals_TIM4
+} t_TIM_Peripherals;
+
+/**
+ * @typedef t_TIM_Channels
+ * @brief TIM Capture/Compare Channels
+ * @details This type is used to select a capture/compare channel of a timer
+ */
+typedef enum
+{
+	/**
+	 * @brief Channel 1
+	 */
+	TIM_Channels_1 = 0,
+	/**
+	 * @brief Channel 2
+	 */
+	TIM_Channels_2,
+	/**
+	 * @brief Channel 3
+	 */
+	TIM_Channels_3,
+	/**
+	 * @brief Channel 4
+	 */
+	TIM_Channels_4
+} t_TIM_Channels;
+
+/**
+ * @typedef t_TIM_Polarity
+ * @brief TIM Output Polarity
+ * @details This type is used to select the level of the active part of a PWM period or of a pulse
+ */
+typedef enum
+{
+	/**
+	 * @brief The active level is high
+	 */
+	TIM_Polarity_ActiveHigh = 0,
+	/**
+	 * @brief The active level is low
+	 */
+	TIM_Polarity_ActiveLow
+} t_TIM_Polarity;
+
+/**
+ * @typedef t_TIM_Edge
+ * @brief TIM Input Capture Edge
+ * @details This type is used to select the edge that captures the counter
+ */
+typedef enum
+{
+	/**
+	 * @brief Rising edge
+	 */
+	TIM_Edge_Rising = 0,
+	/**
+	 * @brief Falling edge
+	 */
+	TIM_Edge_Falling
+} t_TIM_Edge;
+
+/**
+ * @typedef t_TIM_UpdateCallback
+ * @brief TIM Update Callback
+ * @details This type is used to define the function called on every counter overflow (update event) of a timer
+ */
+typedef P2FUNC(void, t_TIM_UpdateCallback)(t_TIM_Peripherals tTIM);
+
+/**
+ * @typedef t_TIM_CaptureCallback
+ * @brief TIM Input Capture Callback
+ * @details This type is used to define the function that gets the captured timestamps, the timestamp is extended
+ * to 32 bits by counting the overflows, so the difference of two timestamps is valid across overflows
+ */
+typedef P2FUNC(void, t_TIM_CaptureCallback)(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_u32 u32Timestamp);
+
+/**
+ * @typedef t_TIM_BurstCallback
+ * @brief TIM DMA Burst Callback
+ * @details This type is used to define the function called once the DMA burst buffer has been fully written
+ */
+typedef P2FUNC(void, t_TIM_BurstCallback)(t_TIM_Peripherals tTIM);
+
+/**
+ * @def TIM_DUTY_CYCLE_FULL
+ * @brief The duty cycle value of a 100% active output (the duty cycle unit is 0.01%)
+ */
+#define TIM_DUTY_CYCLE_FULL (10000U)
+
+/**
+ * @brief This function initializes a timer
+ * @details This function resets the timer, enables the auto-reload preload and leaves the counter stopped
+ * @param[in] tTIM The timer
+ * @note The timer clock must be enabled using RCC_vEnablePeripheralABP2(RCC_APB2Peripherals_TIM1)
+ * or RCC_vEnablePeripheralABP1(RCC_APB1Peripherals_TIMx)
+ * @see t_TIM_Peripherals
+ */
+void TIM_vInit(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function gets the clock frequency of a timer
+ * @details The timer clock is the APB clock, doubled when the APB bus is divided
+ * @param[in] tTIM The timer
+ * @return The timer clock frequency in Hz
+ * @see t_TIM_Peripherals
+ */
+t_u32 TIM_u32GetClockFrequency(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function sets the update (PWM) frequency of a timer
+ * @details This function computes the smallest prescaler that fits the period in the 16-bit counter, which gives
+ * the finest duty cycle resolution, from the clock frequency at run time
+ * @param[in] tTIM The timer
+ * @param[in] u32Frequency The update frequency in Hz
+ * @return TRUE if the frequency is applied, FALSE if it is out of range
+ * @note While the counter runs, the new period starts after the current one (preloaded)
+ * @see t_TIM_Peripherals TIM_u32GetClockFrequency
+ */
+t_bool TIM_bSetFrequency(t_TIM_Peripherals tTIM, t_u32 u32Frequency);
+
+/**
+ * @brief This function sets the counting frequency and the period of a timer
+ * @details This function is used when the counter value has a meaning, e.g. input capture timestamps in microseconds
+ * @param[in] tTIM The timer
+ * @param[in] u32TickFrequency The counting frequency in Hz, the timer clock is divided by an integer
+ * @param[in] u32Period The number of ticks of each period (1 to 65536)
+ * @return TRUE if the time base is applied, FALSE if it is out of range
+ * @see t_TIM_Peripherals TIM_u32GetClockFrequency
+ */
+t_bool TIM_bSetTimeBase(t_TIM_Peripherals tTIM, t_u32 u32TickFrequency, t_u32 u32Period);
+
+/**
+ * @brief This function starts the counter of a timer
+ * @details This function leaves the one-pulse mode and starts counting
+ * @param[in] tTIM The timer
+ * @see t_TIM_Peripherals
+ */
+void TIM_vStart(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function stops the counter of a timer
+ * @details This function stops counting, the counter keeps its value
+ * @param[in] tTIM The timer
+ * @see t_TIM_Peripherals
+ */
+void TIM_vStop(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function checks whether the counter of a timer is running
+ * @param[in] tTIM The timer
+ * @return TRUE if the counter is running, FALSE otherwise (the one-pulse mode stops it at the end of the pulse)
+ * @see t_TIM_Peripherals
+ */
+t_bool TIM_bIsRunning(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function gets the counter value of a timer
+ * @param[in] tTIM The timer
+ * @return The current 16-bit counter value
+ * @see t_TIM_Peripherals
+ */
+t_u16 TIM_u16GetCounter(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function enables the update interrupt of a timer
+ * @details The callback is called from the timer interrupt on every counter overflow
+ * @param[in] tTIM The timer
+ * @param[in] pfCallback The function called on every update
+ * @see t_TIM_Peripherals t_TIM_UpdateCallback TIM_IRQ_PRIORITY
+ */
+void TIM_vEnableUpdateInterrupt(t_TIM_Peripherals tTIM, t_TIM_UpdateCallback pfCallback);
+
+/**
+ * @brief This function disables the update interrupt of a timer
+ * @details The overflows are still counted while an input capture channel is enabled
+ * @param[in] tTIM The timer
+ * @see t_TIM_Peripherals
+ */
+void TIM_vDisableUpdateInterrupt(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function configures a channel as a PWM output
+ * @details The channel pin is configured as an alternate function output, the compare value is preloaded
+ * so a new duty cycle starts with the next period and never produces a glitch. The duty cycle starts at 0%
+ * @param[in] tTIM The timer
+ * @param[in] tChannel The channel
+ * @param[in] tPolarity The level of the active part of the period
+ * @note The clocks of the GPIO ports of the channel pins must be enabled
+ * @see t_TIM_Peripherals t_TIM_Channels t_TIM_Polarity TIM_bSetFrequency
+ */
+void TIM_vConfigurePWM(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_TIM_Polarity tPolarity);
+
+/**
+ * @brief This function sets the duty cycle of a PWM channel
+ * @param[in] tTIM The timer
+ * @param[in] tChannel The channel
+ * @param[in] u16DutyCycle The duty cycle in 0.01% (0 to TIM_DUTY_CYCLE_FULL)
+ * @note The duty cycle is relative to the current period, it must be set again after changing the frequency
+ * @see t_TIM_Peripherals t_TIM_Channels TIM_DUTY_CYCLE_FULL
+ */
+void TIM_vSetDutyCycle(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_u16 u16DutyCycle);
+
+/**
+ * @brief This function sets the compare value of a channel
+ * @param[in] tTIM The timer
+ * @param[in] tChannel The channel
+ * @param[in] u16Compare The compare value in ticks
+ * @see t_TIM_Peripherals t_TIM_Channels
+ */
+void TIM_vSetCompare(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_u16 u16Compare);
+
+/**
+ * @brief This function configures a channel as an input capture
+ * @details Each selected edge on the channel pin captures the counter, the callback gets the captured value
+ * extended to 32 bits using the overflows counted by the update interrupt
+ * @param[in] tTIM The timer
+ * @param[in] tChannel The channel
+ * @param[in] tEdge The edge that captures the counter
+ * @param[in] pfCallback The function that gets the timestamps
+ * @note The clocks of the GPIO ports of the channel pins must be enabled
+ * @see t_TIM_Peripherals t_TIM_Channels t_TIM_Edge t_TIM_CaptureCallback TIM_INPUT_CAPTURE_FILTER
+ */
+void TIM_vConfigureInputCapture(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_TIM_Edge tEdge, t_TIM_CaptureCallback pfCallback);
+
+/**
+ * @brief This function disables a channel (output or input capture)
+ * @param[in] tTIM The timer
+ * @param[in] tChannel The channel
+ * @see t_TIM_Peripherals t_TIM_Channels
+ */
+void TIM_vDisableChannel(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel);
+
+/**
+ * @brief This function generates a single pulse on a channel
+ * @details The counter starts from zero, the output becomes active after the delay and inactive after the width,
+ * then the hardware stops the counter. No CPU work is involved while the pulse is generated
+ * @param[in] tTIM The timer
+ * @param[in] tChannel The channel
+ * @param[in] tPolarity The level of the pulse
+ * @param[in] u16Delay The delay before the pulse in ticks (at least 1)
+ * @param[in] u16Width The width of the pulse in ticks (at least 1)
+ * @return TRUE if the pulse is started, FALSE if the timer is running or the delay and width exceed the 16-bit counter
+ * @note The tick frequency is set using TIM_bSetTimeBase(), the period passed to it is replaced by the pulse
+ * @see t_TIM_Peripherals t_TIM_Channels t_TIM_Polarity TIM_bIsRunning
+ */
+t_bool TIM_bStartOnePulse(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_TIM_Polarity tPolarity, t_u16 u16Delay, t_u16 u16Width);
+
+/**
+ * @brief This function starts updating consecutive compare registers using DMA bursts
+ * @details On every update event the DMA writes the next u8ChannelsCount values of the buffer to the compare
+ * registers starting from tFirstChannel. The values are preloaded, so each group applies to the next period
+ * @param[in] tTIM The timer
+ * @param[in] tFirstChannel The first channel of the burst
+ * @param[in] u8ChannelsCount The number of the consecutive channels of the burst (1 to 4)
+ * @param[in] pu16Buffer The compare values, grouped per update
+ * @param[in] u16Count The number of the groups of the buffer (u16Count * u8ChannelsCount must not exceed 65535)
+ * @param[in] bCircular TRUE to restart the buffer once it is fully written, FALSE to stop
+ * @param[in] pfCallback The function called once the buffer is fully written (can be NULL)
+ * @return TRUE if the bursts are started, FALSE if the arguments are out of range or the update DMA channel of the timer
+ * is owned by another driver
+ * @note The DMA1 clock must be enabled, the timer keeps counting after the last burst
+ * @see t_TIM_Peripherals t_TIM_Channels t_TIM_BurstCallback TIM_vStopBurstDMA
+ */
+t_bool TIM_bStartBurstDMA(t_TIM_Peripherals tTIM, t_TIM_Channels tFirstChannel, t_u8 u8ChannelsCount, P2CONST(t_u16) pu16Buffer, t_u16 u16Count, t_bool bCircular, t_TIM_BurstCallback pfCallback);
+
+/**
+ * @brief This function stops the DMA bursts of a timer
+ * @details This function disables the update DMA request and releases the update DMA channel of the timer
+ * @param[in] tTIM The timer
+ * @see t_TIM_Peripherals
+ */
+void TIM_vStopBurstDMA(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function gets the DMA channel that serves the update requests of a timer
+ * @details This function is used by the drivers that move data to or from any address on every update event
+ * @param[in] tTIM The timer
+ * @return The DMA channel of the update requests
+ * @see t_TIM_Peripherals TIM_vEnableUpdateDMARequest
+ */
+t_DMA_Channels TIM_tGetUpdateDMAChannel(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function enables the DMA request of the update event of a timer
+ * @param[in] tTIM The timer
+ * @note The update DMA channel must be configured by the caller
+ * @see t_TIM_Peripherals TIM_tGetUpdateDMAChannel
+ */
+void TIM_vEnableUpdateDMARequest(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function disables the DMA request of the update event of a timer
+ * @param[in] tTIM The timer
+ * @see t_TIM_Peripherals
+ */
+void TIM_vDisableUpdateDMARequest(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function configures a timer as a quadrature encoder interface
+ * @details The encoder A and B signals are connected to the channel 1 and 2 pins, the counter counts up or down
+ * on every edge of both signals (x4 resolution) in hardware, and the overflows and underflows are counted by the
+ * update interrupt to extend the position to 32 bits. The position starts from zero with the counter in the middle
+ * of its range, so only a travel of 32768 counts reaches the wrap point, and the counter is started
+ * @param[in] tTIM The timer
+ * @note The timer must be initialized, its channels 1 and 2 are used by the encoder. The filter
+ * TIM_INPUT_CAPTURE_FILTER applies to both inputs
+ * @see t_TIM_Peripherals TIM_s32GetEncoderPosition TIM_s32SampleEncoderVelocity
+ */
+void TIM_vConfigureEncoder(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function gets the position of an encoder
+ * @details The position is the 16-bit hardware counter extended by the counted overflows, a pending overflow that
+ * is not counted yet (e.g. when called from a higher priority interrupt) is taken into account
+ * @param[in] tTIM The timer configured as an encoder interface
+ * @return The signed position in counts (4 counts per encoder line)
+ * @see t_TIM_Peripherals TIM_vConfigureEncoder
+ */
+t_s32 TIM_s32GetEncoderPosition(t_TIM_Peripherals tTIM);
+
+/**
+ * @brief This function estimates the velocity of an encoder
+ * @details This function takes a snapshot of the position and returns the distance since the previous snapshot
+ * scaled to one second, so it must be called periodically at the given frequency (e.g. from an update callback)
+ * @param[in] tTIM The timer configured as an encoder interface
+ * @param[in] u32SampleFrequency The frequency of the calls in Hz
+ * @return The signed velocity in counts per second
+ * @see t_TIM_Peripherals TIM_vConfigureEncoder TIM_vEnableUpdateInterrupt
+ */
+t_s32 TIM_s32SampleEncoderVelocity(t_TIM_Peripherals tTIM, t_u32 u32SampleFrequency);
+
+/** @} */
+/** @} */
+
+#endif /* _TIM_INTERFACE_H_ */
@@ -0,0 +1,469 @@
+/**
+ * @file TIM_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the TIM module.
+ * @details This file contains the private macros and registers for the TIM module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/TIM
+ * @brief TIM Module
+ * @details This module contains all the APIs related to the TIM1 (advanced) and TIM2 to TIM4 (general-purpose) timers
+ */
+
+#ifndef _TIM_PRIVATE_H_
+#define _TIM_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup tim_module TIM Module
+ * @brief TIM Module
+ * @details This module contains all the APIs related to the TIM1 (advanced) and TIM2 to TIM4 (general-purpose) timers
+ * @{
+ */
+
+/**
+ * @defgroup tim_registers TIM Registers
+ * @brief TIM Registers
+ * @{
+ */
+
+/**
+ * @struct t_TIM_RegisterMap
+ * @brief TIM Register Map
+ * @details This type is used to access the registers of one timer, RCR and BDTR are reserved on TIM2 to TIM4
+ */
+typedef struct
+{
+	/**
+	 * @brief Control Register 1
+	 */
+	t_u32 CR1;
+	/**
+	 * @brief Control Register 2
+	 */
+	t_u32 CR2;
+	/**
+	 * @brief Slave Mode Control Register
+	 */
+	t_u32 SMCR;
+	/**
+	 * @brief DMA/Interrupt Enable Register
+	 */
+	t_u32 DIER;
+	/**
+	 * @brief Status Register
+	 */
+	t_u32 SR;
+	/**
+	 * @brief Event Generation Register
+	 * @warning This register is write-only
+	 */
+	t_u32 EGR;
+	/**
+	 * @brief Capture/Compare Mode Register 1 (channels 1 and 2)
+	 */
+	t_u32 CCMR1;
+	/**
+	 * @brief Capture/Compare Mode Register 2 (channels 3 and 4)
+	 */
+	t_u32 CCMR2;
+	/**
+	 * @brief Capture/Compare Enable Register
+	 */
+	t_u32 CCER;
+	/**
+	 * @brief Counter
+	 */
+	t_u32 CNT;
+	/**
+	 * @brief Prescaler
+	 */
+	t_u32 PSC;
+	/**
+	 * @brief Auto-Reload Register
+	 */
+	t_u32 ARR;
+	/**
+	 * @brief Repetition Counter Register (TIM1 only)
+	 */
+	t_u32 RCR;
+	/**
+	 * @brief Capture/Compare Registers 1 to 4
+	 */
+	t_u32 CCR[4];
+	/**
+	 * @brief Break and Dead-Time Register (TIM1 only)
+	 */
+	t_u32 BDTR;
+	/**
+	 * @brief DMA Control Register
+	 */
+	t_u32 DCR;
+	/**
+	 * @brief DMA Address for Full Transfer
+	 */
+	t_u32 DMAR;
+} t_TIM_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup tim_addresses TIM Addresses
+ * @brief TIM Addresses
+ * @details This module contains the addresses of the TIM registers
+ * @{
+ */
+
+/**
+ * @def TIM1_BASE_ADDRESS
+ * @brief TIM1 Base Address in the memory
+ */
+#define TIM1_BASE_ADDRESS REGISTER_ADDRESS(0x40012C00, 0)
+
+/**
+ * @def TIM2_BASE_ADDRESS
+ * @brief TIM2 Base Address in the memory
+ */
+#define TIM2_BASE_ADDRESS REGISTER_ADDRESS(0x40000000, 0)
+
+/**
+ * @def TIM3_BASE_ADDRESS
+ * @brief TIM3 Base Address in the memory
+ */
+#define TIM3_BASE_ADDRESS REGISTER_ADDRESS(0x40000400, 0)
+
+/**
+ * @def TIM4_BASE_ADDRESS
+ * @brief TIM4 Base Address in the memory
+ */
+#define TIM4_BASE_ADDRESS REGISTER_ADDRESS(0x40000800, 0)
+
+/**
+ * @def TIM1
+ * @brief TIM1 Register Map
+ */
+#define TIM1 REGISTER(t_TIM_RegisterMap, TIM1_BASE_ADDRESS)
+
+/**
+ * @def TIM2
+ * @brief TIM2 Register Map
+ */
+#define TIM2 REGISTER(t_TIM_RegisterMap, TIM2_BASE_ADDRESS)
+
+/**
+ * @def TIM3
+ * @brief TIM3 Register Map
+ */
+#define TIM3 REGISTER(t_TIM_RegisterMap, TIM3_BASE_ADDRESS)
+
+/**
+ * @def TIM4
+ * @brief TIM4 Register Map
+ */
+#define TIM4 REGISTER(t_TIM_RegisterMap, TIM4_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup tim_constants TIM Constants
+ * @brief TIM Constants
+ * @{
+ */
+
+/**
+ * @def TIM_PERIPHERALS_COUNT
+ * @brief Number of the TIM peripherals
+ */
+#define TIM_PERIPHERALS_COUNT (4)
+
+/**
+ * @def TIM_CHANNELS_COUNT
+ * @brief Number of the capture/compare channels of each timer
+ */
+#define TIM_CHANNELS_COUNT (4)
+
+/**
+ * @def TIM_COUNTER_RANGE
+ * @brief Number of the values of the 16-bit counter and prescaler
+ */
+#define TIM_COUNTER_RANGE ((t_u32)65536UL)
+
+/**
+ * @def TIM_ENCODER_ORIGIN
+ * @brief The counter value of the encoder position zero, in the middle of the range so a shaft resting at the
+ * start position never dithers across the wrap point
+ */
+#define TIM_ENCODER_ORIGIN (TIM_COUNTER_RANGE / 2U)
+
+/**
+ * @def TIM_CR1_CEN
+ * @brief Counter enable bit
+ */
+#define TIM_CR1_CEN (0)
+
+/**
+ * @def TIM_CR1_URS
+ * @brief Update request source bit (`1`: only the counter overflow raises the update interrupt/DMA request)
+ */
+#define TIM_CR1_URS (2)
+
+/**
+ * @def TIM_CR1_OPM
+ * @brief One-pulse mode bit
+ */
+#define TIM_CR1_OPM (3)
+
+/**
+ * @def TIM_CR1_DIR
+ * @brief Direction bit (`1`: downcounting)
+ */
+#define TIM_CR1_DIR (4)
+
+/**
+ * @def TIM_CR1_ARPE
+ * @brief Auto-reload preload enable bit
+ */
+#define TIM_CR1_ARPE (7)
+
+/**
+ * @def TIM_SMCR_SMS
+ * @brief Position of the slave mode selection field
+ */
+#define TIM_SMCR_SMS (0)
+
+/**
+ * @def TIM_SMCR_SMS_MASK
+ * @brief Mask of the slave mode selection field
+ */
+#define TIM_SMCR_SMS_MASK ((t_u32)0x7U << TIM_SMCR_SMS)
+
+/**
+ * @def TIM_SMS_ENCODER_X4
+ * @brief Slave mode value of the encoder mode 3 (the counter counts on both edges of both inputs)
+ */
+#define TIM_SMS_ENCODER_X4 (0x3U)
+
+/**
+ * @def TIM_DIER_UIE
+ * @brief Update interrupt enable bit
+ */
+#define TIM_DIER_UIE (0)
+
+/**
+ * @def TIM_DIER_CC1IE
+ * @brief Capture/compare 1 interrupt enable bit (the other channels follow)
+ */
+#define TIM_DIER_CC1IE (1)
+
+/**
+ * @def TIM_DIER_CC_MASK
+ * @brief Mask of the capture/compare interrupt enable bits
+ */
+#define TIM_DIER_CC_MASK ((t_u32)0x0000001EU)
+
+/**
+ * @def TIM_DIER_UDE
+ * @brief Update DMA request enable bit
+ */
+#define TIM_DIER_UDE (8)
+
+/**
+ * @def TIM_SR_UIF
+ * @brief Update interrupt flag
+ */
+#define TIM_SR_UIF (0)
+
+/**
+ * @def TIM_SR_CC1IF
+ * @brief Capture/compare 1 interrupt flag (the other channels follow)
+ */
+#define TIM_SR_CC1IF (1)
+
+/**
+ * @def TIM_SR_UPDATE_MASK
+ * @brief Mask of the update interrupt flag
+ */
+#define TIM_SR_UPDATE_MASK ((t_u32)0x00000001U)
+
+/**
+ * @def TIM_SR_CC_MASK
+ * @brief Mask of the capture/compare interrupt flags
+ */
+#define TIM_SR_CC_MASK ((t_u32)0x0000001EU)
+
+/**
+ * @def TIM_EGR_UG
+ * @brief Update generation bit
+ */
+#define TIM_EGR_UG (0)
+
+/**
+ * @def TIM_CCMR_FIELD_WIDTH
+ * @brief Number of the bits of each channel in the CCMR registers
+ */
+#define TIM_CCMR_FIELD_WIDTH (8)
+
+/**
+ * @def TIM_CCMR_CHANNELS_PER_REGISTER
+ * @brief Number of the channels of each CCMR register
+ */
+#define TIM_CCMR_CHANNELS_PER_REGISTER (2)
+
+/**
+ * @def TIM_CCMR_CCS
+ * @brief Position of the capture/compare selection field (inside the channel field)
+ */
+#define TIM_CCMR_CCS (0)
+
+/**
+ * @def TIM_CCMR_OCPE
+ * @brief Position of the output compare preload enable bit (inside the channel field)
+ */
+#define TIM_CCMR_OCPE (3)
+
+/**
+ * @def TIM_CCMR_OCM
+ * @brief Position of the output compare mode field (inside the channel field)
+ */
+#define TIM_CCMR_OCM (4)
+
+/**
+ * @def TIM_CCMR_ICF
+ * @brief Position of the input capture filter field (inside the channel field)
+ */
+#define TIM_CCMR_ICF (4)
+
+/**
+ * @def TIM_CCS_OUTPUT
+ * @brief Capture/compare selection value of an output channel
+ */
+#define TIM_CCS_OUTPUT (0x0U)
+
+/**
+ * @def TIM_CCS_INPUT_DIRECT
+ * @brief Capture/compare selection value of an input channel mapped on its own input (TIx)
+ */
+#define TIM_CCS_INPUT_DIRECT (0x1U)
+
+/**
+ * @def TIM_OCM_PWM1
+ * @brief Output compare mode value of PWM mode 1 (active while the counter is below the compare value)
+ */
+#define TIM_OCM_PWM1 (0x6U)
+
+/**
+ * @def TIM_OCM_PWM2
+ * @brief Output compare mode value of PWM mode 2 (active once the counter reaches the compare value)
+ */
+#define TIM_OCM_PWM2 (0x7U)
+
+/**
+ * @def TIM_CCER_FIELD_WIDTH
+ * @brief Number of the bits of each channel in the CCER register
+ */
+#define TIM_CCER_FIELD_WIDTH (4)
+
+/**
+ * @def TIM_CCER_CCE
+ * @brief Position of the capture/compare enable bit (inside the channel field)
+ */
+#define TIM_CCER_CCE (0)
+
+/**
+ * @def TIM_CCER_CCP
+ * @brief Position of the capture/compare polarity bit (inside the channel field)
+ */
+#define TIM_CCER_CCP (1)
+
+/**
+ * @def TIM_BDTR_MOE
+ * @brief Main output enable bit (TIM1 only)
+ */
+#define TIM_BDTR_MOE (15)
+
+/**
+ * @def TIM_DCR_DBA
+ * @brief Position of the DMA base address field
+ */
+#define TIM_DCR_DBA (0)
+
+/**
+ * @def TIM_DCR_DBL
+ * @brief Position of the DMA burst length field
+ */
+#define TIM_DCR_DBL (8)
+
+/**
+ * @def TIM_DCR_DBA_CCR1
+ * @brief DMA base address value of the CCR1 register (its offset in words)
+ */
+#define TIM_DCR_DBA_CCR1 (13)
+
+/**
+ * @def TIM_DMA_MAX_COUNT
+ * @brief The maximum number of values moved by one DMA transfer (the width of the DMA counter)
+ */
+#define TIM_DMA_MAX_COUNT (65535U)
+
+/**
+ * @def TIM_CCMR_FIELD_SHIFT(CHANNEL)
+ * @brief Get the position of the field of a channel inside its CCMR register
+ * @param[in] CHANNEL The channel index (0 to 3)
+ */
+#define TIM_CCMR_FIELD_SHIFT(CHANNEL) (((CHANNEL) % TIM_CCMR_CHANNELS_PER_REGISTER) * TIM_CCMR_FIELD_WIDTH)
+
+/**
+ * @def TIM_CCER_FIELD_SHIFT(CHANNEL)
+ * @brief Get the position of the field of a channel inside the CCER register
+ * @param[in] CHANNEL The channel index (0 to 3)
+ */
+#define TIM_CCER_FIELD_SHIFT(CHANNEL) ((CHANNEL) * TIM_CCER_FIELD_WIDTH)
+
+/** @} */
+
+/**
+ * @defgroup tim_handlers TIM Interrupt Handlers
+ * @brief The interrupt handlers of the TIM module, they are referenced by the vector table
+ * @{
+ */
+
+/**
+ * @brief TIM1 update interrupt handler
+ */
+void TIM1_UP_IRQHandler(void);
+
+/**
+ * @brief TIM1 capture/compare interrupt handler
+ */
+void TIM1_CC_IRQHandler(void);
+
+/**
+ * @brief TIM2 interrupt handler
+ */
+void TIM2_IRQHandler(void);
+
+/**
+ * @brief TIM3 interrupt handler
+ */
+void TIM3_IRQHandler(void);
+
+/**
+ * @brief TIM4 interrupt handler
+ */
+void TIM4_IRQHandler(void);
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _TIM_PRIVATE_H_ */
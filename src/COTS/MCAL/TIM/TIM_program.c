@@ -0,0 +1,763 @@
+/**
+ * @file TIM_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the TIM module.
+ * @details This file contains the implementation for the TIM module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../RCC/RCC_interface.h"
+#include "../GPIO/GPIO_interface.h"
+#include "../NVIC/NVIC_interface.h"
+#include "../DMA/DMA_interface.h"
+#include "TIM_private.h"
+#include "TIM_interface.h"
+#include "TIM_config.h"
+
+/**
+ * @brief The register maps of the timers
+ */
+STATIC P2VAR(VOLATILE t_TIM_RegisterMap) CONST aptTIMs[TIM_PERIPHERALS_COUNT] = {&TIM1, &TIM2, &TIM3, &TIM4};
+
+/**
+ * @brief The NVIC interrupts of the timers (the update interrupt of TIM1, its capture/compare interrupt is separate)
+ */
+STATIC CONST t_NVIC_IRQs atTIMIRQs[TIM_PERIPHERALS_COUNT] = {NVIC_IRQs_TIM1_UP, NVIC_IRQs_TIM2, NVIC_IRQs_TIM3, NVIC_IRQs_TIM4};
+
+/**
+ * @brief The DMA channels that serve the update requests of the timers
+ */
+STATIC CONST t_DMA_Channels atTIMDMAChannels[TIM_PERIPHERALS_COUNT] = {DMA_CHANNEL_TIM1_UP, DMA_CHANNEL_TIM2_UP, DMA_CHANNEL_TIM3_UP, DMA_CHANNEL_TIM4_UP};
+
+/**
+ * @brief The GPIO ports of the channel pins
+ */
+STATIC CONST t_GPIO_Ports atTIMChannelPorts[TIM_PERIPHERALS_COUNT][TIM_CHANNELS_COUNT] = {
+	{GPIO_Ports_A, GPIO_Ports_A, GPIO_Ports_A, GPIO_Ports_A},
+	{GPIO_Ports_A, GPIO_Ports_A, GPIO_Ports_A, GPIO_Ports_A},
+	{GPIO_Ports_A, GPIO_Ports_A, GPIO_Ports_B, GPIO_Ports_B},
+	{GPIO_Ports_B, GPIO_Ports_B, GPIO_Ports_B, GPIO_Ports_B}};
+
+/**
+ * @brief The channel pins
+ */
+STATIC CONST t_GPIO_Pins atTIMChannelPins[TIM_PERIPHERALS_COUNT][TIM_CHANNELS_COUNT] = {
+	{GPIO_Pins_8, GPIO_Pins_9, GPIO_Pins_10, GPIO_Pins_11},
+	{GPIO_Pins_0, GPIO_Pins_1, GPIO_Pins_2, GPIO_Pins_3},
+	{GPIO_Pins_6, GPIO_Pins_7, GPIO_Pins_0, GPIO_Pins_1},
+	{GPIO_Pins_6, GPIO_Pins_7, GPIO_Pins_8, GPIO_Pins_9}};
+
+/**
+ * @brief The update callbacks of the timers
+ */
+STATIC t_TIM_UpdateCallback apfTIMUpdateCallbacks[TIM_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief The input capture callbacks of the channels
+ */
+STATIC t_TIM_CaptureCallback apfTIMCaptureCallbacks[TIM_PERIPHERALS_COUNT][TIM_CHANNELS_COUNT] = {{NULL}};
+
+/**
+ * @brief The DMA burst callbacks of the timers
+ */
+STATIC t_TIM_BurstCallback apfTIMBurstCallbacks[TIM_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief The DMA burst modes of the timers (circular or one-shot)
+ */
+STATIC t_bool abTIMBurstCircular[TIM_PERIPHERALS_COUNT] = {FALSE};
+
+/**
+ * @brief The number of the counter overflows of each timer, it extends the captured values to 32 bits
+ */
+STATIC VOLATILE t_u32 au32TIMOverflows[TIM_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The encoder interface modes of the timers, their updates can be overflows or underflows
+ */
+STATIC t_bool abTIMEncoders[TIM_PERIPHERALS_COUNT] = {FALSE};
+
+/**
+ * @brief The encoder positions of the previous velocity snapshots
+ */
+STATIC t_s32 as32TIMEncoderSnapshots[TIM_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief This function configures the pin of a channel
+ * @param[in] tTIM The timer
+ * @param[in] tChannel The channel
+ * @param[in] bOutput TRUE for an alternate function output, FALSE for a floating input
+ */
+STATIC void TIM_vSetChannelPin(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_bool bOutput)
+{
+	t_GPIO_Ports tPort = atTIMChannelPorts[tTIM][tChannel];
+	t_GPIO_Pins tPin = atTIMChannelPins[tTIM][tChannel];
+
+	if (bOutput == TRUE)
+	{
+		GPIO_vSetPinDirection(tPort, tPin, GPIO_Direction_Output_50MHz);
+		GPIO_vSetPinOutputType(tPort, tPin, GPIO_Output_Type_Alternate_Push_Pull);
+	}
+	else
+	{
+		GPIO_vSetPinDirection(tPort, tPin, GPIO_Direction_Input);
+		GPIO_vSetPinInputType(tPort, tPin, GPIO_Input_Type_Floating);
+	}
+}
+
+/**
+ * @brief This function sets the mode field of a channel in its CCMR register
+ * @details The channel is disabled first, its direction can only change while it is disabled
+ * @param[in] ptTIM The timer registers
+ * @param[in] tChannel The channel
+ * @param[in] u32Mode The 8-bit mode field value
+ */
+STATIC void TIM_vSetChannelMode(P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM, t_TIM_Channels tChannel, t_u32 u32Mode)
+{
+	P2VAR(VOLATILE t_u32) pu32CCMR = (tChannel < TIM_CCMR_CHANNELS_PER_REGISTER) ? &ptTIM->CCMR1 : &ptTIM->CCMR2;
+	t_u8 u8Shift = (t_u8)TIM_CCMR_FIELD_SHIFT(tChannel);
+
+	ptTIM->CCER &= ~((t_u32)0xFU << TIM_CCER_FIELD_SHIFT(tChannel));
+	*pu32CCMR = (*pu32CCMR & ~((t_u32)0xFFU << u8Shift)) | (u32Mode << u8Shift);
+}
+
+/**
+ * @brief This function enables a channel with a certain polarity
+ * @param[in] ptTIM The timer registers
+ * @param[in] tChannel The channel
+ * @param[in] u32Polarity The CCxP bit value (output polarity or capture edge)
+ */
+STATIC void TIM_vEnableChannel(P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM, t_TIM_Channels tChannel, t_u32 u32Polarity)
+{
+	ptTIM->CCER |= (((t_u32)1 << TIM_CCER_CCE) | (u32Polarity << TIM_CCER_CCP)) << TIM_CCER_FIELD_SHIFT(tChannel);
+}
+
+/**
+ * @brief This function enables the NVIC interrupts of a timer
+ * @param[in] tTIM The timer
+ */
+STATIC void TIM_vEnableIRQs(t_TIM_Peripherals tTIM)
+{
+	NVIC_vEnableIRQ(atTIMIRQs[tTIM]);
+
+	if (tTIM == TIM_Peripherals_TIM1)
+	{
+		NVIC_vEnableIRQ(NVIC_IRQs_TIM1_CC);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function disables the update interrupt if neither the callback nor the captures need it
+ * @param[in] tTIM The timer
+ */
+STATIC void TIM_vReleaseUpdateInterrupt(t_TIM_Peripherals tTIM)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+
+	if ((apfTIMUpdateCallbacks[tTIM] == NULL) && ((ptTIM->DIER & TIM_DIER_CC_MASK) == 0U))
+	{
+		ptTIM->DIER &= ~((t_u32)1U << TIM_DIER_UIE);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function writes the prescaler and the auto-reload values
+ * @details A stopped timer loads them right away, a running timer loads them at its next update event
+ * @param[in] tTIM The timer
+ * @param[in] u32Prescaler The prescaler value (the clock is divided by u32Prescaler + 1)
+ * @param[in] u32AutoReload The auto-reload value (the period is u32AutoReload + 1 ticks)
+ */
+STATIC void TIM_vApplyTimeBase(t_TIM_Peripherals tTIM, t_u32 u32Prescaler, t_u32 u32AutoReload)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+
+	ptTIM->PSC = u32Prescaler;
+	ptTIM->ARR = u32AutoReload;
+
+	if (GET_BIT(ptTIM->CR1, TIM_CR1_CEN) == 0)
+	{
+		/* The update request source only counts overflows, so this does not raise an update interrupt */
+		SET_BIT(ptTIM->EGR, TIM_EGR_UG);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function serves the interrupt flags of a timer
+ * @details The captures are served before the update, a pending overflow that is not counted yet belongs
+ * before a capture if the captured value is in the first half of the period
+ * @param[in] tTIM The timer
+ * @param[in] u32FlagsMask The flags served by the interrupt vector
+ */
+STATIC void TIM_vHandleIRQ(t_TIM_Peripherals tTIM, t_u32 u32FlagsMask)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+	t_u32 u32Status = ptTIM->SR;
+	t_u32 u32Flags = u32Status & ptTIM->DIER & u32FlagsMask;
+	t_u32 u32CaptureFlags = (u32Flags & TIM_SR_CC_MASK) >> TIM_SR_CC1IF;
+	t_u32 u32Period = ptTIM->ARR + 1U;
+	t_u32 u32Overflows = 0;
+	t_u32 u32Capture = 0;
+	t_u8 u8Channel = 0;
+
+	/* Clear the served flags (write 0 to clear, writing 1 has no effect) */
+	ptTIM->SR = ~u32Flags;
+
+	while (u32CaptureFlags != 0U)
+	{
+		/* Get the lowest captured channel and remove it from the captured channels */
+		u8Channel = CPU_CTZ(u32CaptureFlags);
+		u32CaptureFlags &= (u32CaptureFlags - 1U);
+
+		u32Capture = ptTIM->CCR[u8Channel];
+		u32Overflows = au32TIMOverflows[tTIM];
+
+		if ((GET_BIT(u32Status, TIM_SR_UIF) != 0) && (u32Capture < (u32Period / 2U)))
+		{
+			u32Overflows++;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		if (apfTIMCaptureCallbacks[tTIM][u8Channel] != NULL)
+		{
+			apfTIMCaptureCallbacks[tTIM][u8Channel](tTIM, (t_TIM_Channels)u8Channel, (u32Overflows * u32Period) + u32Capture);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	if ((u32Flags & TIM_SR_UPDATE_MASK) != 0U)
+	{
+		/* An encoder that wrapped down to the top of the range underflowed */
+		if ((abTIMEncoders[tTIM] == TRUE) && (ptTIM->CNT >= (u32Period / 2U)))
+		{
+			au32TIMOverflows[tTIM]--;
+		}
+		else
+		{
+			au32TIMOverflows[tTIM]++;
+		}
+
+		if (apfTIMUpdateCallbacks[tTIM] != NULL)
+		{
+			apfTIMUpdateCallbacks[tTIM](tTIM);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function serves the DMA events of the update channels
+ * @details A one-shot burst stops the update DMA request once the buffer is fully written
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void TIM_vDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent)
+{
+	t_u8 u8TIM = 0;
+
+	/* Get the timer served by the channel */
+	while ((u8TIM < TIM_PERIPHERALS_COUNT) && (atTIMDMAChannels[u8TIM] != tChannel))
+	{
+		u8TIM++;
+	}
+
+	if ((u8TIM < TIM_PERIPHERALS_COUNT) && (tEvent == DMA_Events_TransferComplete))
+	{
+		if (abTIMBurstCircular[u8TIM] == FALSE)
+		{
+			aptTIMs[u8TIM]->DIER &= ~((t_u32)1U << TIM_DIER_UDE);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		if (apfTIMBurstCallbacks[u8TIM] != NULL)
+		{
+			apfTIMBurstCallbacks[u8TIM]((t_TIM_Peripherals)u8TIM);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+void TIM_vInit(t_TIM_Peripherals tTIM)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+	t_u8 u8Channel = 0;
+
+	/* Return every register to its reset value */
+	if (tTIM == TIM_Peripherals_TIM1)
+	{
+		RCC_vResetPeripheralAPB2(RCC_APB2Peripherals_TIM1);
+	}
+	else
+	{
+		RCC_vResetPeripheralAPB1((t_RCC_APB1Peripherals)(RCC_APB1Peripherals_TIM2 + (tTIM - TIM_Peripherals_TIM2)));
+	}
+
+	apfTIMUpdateCallbacks[tTIM] = NULL;
+	apfTIMBurstCallbacks[tTIM] = NULL;
+	au32TIMOverflows[tTIM] = 0U;
+	abTIMEncoders[tTIM] = FALSE;
+
+	for (u8Channel = 0; u8Channel < TIM_CHANNELS_COUNT; u8Channel++)
+	{
+		apfTIMCaptureCallbacks[tTIM][u8Channel] = NULL;
+	}
+
+	/* Preloaded period, only the overflows raise update interrupts and DMA requests */
+	ptTIM->CR1 = ((t_u32)1 << TIM_CR1_ARPE) | ((t_u32)1 << TIM_CR1_URS);
+
+	if (tTIM == TIM_Peripherals_TIM1)
+	{
+		/* The advanced timer outputs are gated by the main output enable */
+		SET_BIT(ptTIM->BDTR, TIM_BDTR_MOE);
+		NVIC_vSetPriority(NVIC_IRQs_TIM1_CC, TIM_IRQ_PRIORITY);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	NVIC_vSetPriority(atTIMIRQs[tTIM], TIM_IRQ_PRIORITY);
+}
+
+t_u32 TIM_u32GetClockFrequency(t_TIM_Peripherals tTIM)
+{
+	t_u32 u32Frequency = (tTIM == TIM_Peripherals_TIM1) ? RCC_u32GetAPB2ClockFrequency() : RCC_u32GetAPB1ClockFrequency();
+
+	/* The timers get twice the APB clock when the APB bus is divided */
+	if (u32Frequency != RCC_u32GetAHBClockFrequency())
+	{
+		u32Frequency *= 2U;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return u32Frequency;
+}
+
+t_bool TIM_bSetFrequency(t_TIM_Peripherals tTIM, t_u32 u32Frequency)
+{
+	t_bool bStatus = FALSE;
+	t_u32 u32Ticks = 0;
+	t_u32 u32Prescaler = 0;
+
+	if (u32Frequency != 0U)
+	{
+		u32Ticks = TIM_u32GetClockFrequency(tTIM) / u32Frequency;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* The period must be at least 2 ticks */
+	if (u32Ticks >= 2U)
+	{
+		/* The smallest divider that fits the period in the 16-bit counter */
+		u32Prescaler = (u32Ticks - 1U) / TIM_COUNTER_RANGE;
+
+		if (u32Prescaler < TIM_COUNTER_RANGE)
+		{
+			TIM_vApplyTimeBase(tTIM, u32Prescaler, (u32Ticks / (u32Prescaler + 1U)) - 1U);
+			bStatus = TRUE;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+t_bool TIM_bSetTimeBase(t_TIM_Peripherals tTIM, t_u32 u32TickFrequency, t_u32 u32Period)
+{
+	t_bool bStatus = FALSE;
+	t_u32 u32Clock = TIM_u32GetClockFrequency(tTIM);
+	t_u32 u32Prescaler = 0;
+
+	if ((u32TickFrequency != 0U) && (u32TickFrequency <= u32Clock) && (u32Period != 0U) && (u32Period <= TIM_COUNTER_RANGE))
+	{
+		u32Prescaler = (u32Clock / u32TickFrequency) - 1U;
+
+		if (u32Prescaler < TIM_COUNTER_RANGE)
+		{
+			TIM_vApplyTimeBase(tTIM, u32Prescaler, u32Period - 1U);
+			bStatus = TRUE;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void TIM_vStart(t_TIM_Peripherals tTIM)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+
+	ptTIM->CR1 = (ptTIM->CR1 & ~((t_u32)1 << TIM_CR1_OPM)) | ((t_u32)1 << TIM_CR1_CEN);
+}
+
+void TIM_vStop(t_TIM_Peripherals tTIM)
+{
+	aptTIMs[tTIM]->CR1 &= ~((t_u32)1U << TIM_CR1_CEN);
+}
+
+t_bool TIM_bIsRunning(t_TIM_Peripherals tTIM)
+{
+	return (GET_BIT(aptTIMs[tTIM]->CR1, TIM_CR1_CEN) != 0) ? TRUE : FALSE;
+}
+
+t_u16 TIM_u16GetCounter(t_TIM_Peripherals tTIM)
+{
+	return (t_u16)aptTIMs[tTIM]->CNT;
+}
+
+void TIM_vEnableUpdateInterrupt(t_TIM_Peripherals tTIM, t_TIM_UpdateCallback pfCallback)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+
+	apfTIMUpdateCallbacks[tTIM] = pfCallback;
+	SET_BIT(ptTIM->DIER, TIM_DIER_UIE);
+	TIM_vEnableIRQs(tTIM);
+}
+
+void TIM_vDisableUpdateInterrupt(t_TIM_Peripherals tTIM)
+{
+	apfTIMUpdateCallbacks[tTIM] = NULL;
+	TIM_vReleaseUpdateInterrupt(tTIM);
+}
+
+void TIM_vConfigurePWM(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_TIM_Polarity tPolarity)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+
+	TIM_vSetChannelPin(tTIM, tChannel, TRUE);
+	TIM_vSetChannelMode(ptTIM, tChannel, ((t_u32)TIM_OCM_PWM1 << TIM_CCMR_OCM) | ((t_u32)1 << TIM_CCMR_OCPE) | ((t_u32)TIM_CCS_OUTPUT << TIM_CCMR_CCS));
+	ptTIM->CCR[tChannel] = 0U;
+	TIM_vEnableChannel(ptTIM, tChannel, (t_u32)tPolarity);
+}
+
+void TIM_vSetDutyCycle(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_u16 u16DutyCycle)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+	t_u32 u32Compare = 0;
+
+	if (u16DutyCycle > TIM_DUTY_CYCLE_FULL)
+	{
+		u16DutyCycle = TIM_DUTY_CYCLE_FULL;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	u32Compare = ((ptTIM->ARR + 1U) * u16DutyCycle) / TIM_DUTY_CYCLE_FULL;
+
+	/* A full period of 65536 ticks can not be always active, get as close as possible */
+	if (u32Compare >= TIM_COUNTER_RANGE)
+	{
+		u32Compare = TIM_COUNTER_RANGE - 1U;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	ptTIM->CCR[tChannel] = u32Compare;
+}
+
+void TIM_vSetCompare(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_u16 u16Compare)
+{
+	aptTIMs[tTIM]->CCR[tChannel] = u16Compare;
+}
+
+void TIM_vConfigureInputCapture(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_TIM_Edge tEdge, t_TIM_CaptureCallback pfCallback)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+
+	TIM_vSetChannelPin(tTIM, tChannel, FALSE);
+	TIM_vSetChannelMode(ptTIM, tChannel, ((t_u32)TIM_INPUT_CAPTURE_FILTER << TIM_CCMR_ICF) | ((t_u32)TIM_CCS_INPUT_DIRECT << TIM_CCMR_CCS));
+	apfTIMCaptureCallbacks[tTIM][tChannel] = pfCallback;
+	TIM_vEnableChannel(ptTIM, tChannel, (t_u32)tEdge);
+
+	/* Clear any stale capture flag, then count the overflows along with the captures */
+	ptTIM->SR = ~((t_u32)1 << (TIM_SR_CC1IF + tChannel));
+	ptTIM->DIER |= ((t_u32)1 << (TIM_DIER_CC1IE + tChannel)) | ((t_u32)1 << TIM_DIER_UIE);
+	TIM_vEnableIRQs(tTIM);
+}
+
+void TIM_vDisableChannel(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+
+	ptTIM->CCER &= ~((t_u32)0xFU << TIM_CCER_FIELD_SHIFT(tChannel));
+	ptTIM->DIER &= ~((t_u32)1U << (TIM_DIER_CC1IE + tChannel));
+	apfTIMCaptureCallbacks[tTIM][tChannel] = NULL;
+	TIM_vReleaseUpdateInterrupt(tTIM);
+}
+
+t_bool TIM_bStartOnePulse(t_TIM_Peripherals tTIM, t_TIM_Channels tChannel, t_TIM_Polarity tPolarity, t_u16 u16Delay, t_u16 u16Width)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+	t_bool bStatus = FALSE;
+
+	if ((TIM_bIsRunning(tTIM) == FALSE) && (u16Delay != 0U) && (u16Width != 0U) && (((t_u32)u16Delay + u16Width) <= TIM_COUNTER_RANGE))
+	{
+		TIM_vSetChannelPin(tTIM, tChannel, TRUE);
+
+		/* PWM mode 2: inactive until the counter reaches the delay, active until the update stops the counter */
+		TIM_vSetChannelMode(ptTIM, tChannel, ((t_u32)TIM_OCM_PWM2 << TIM_CCMR_OCM) | ((t_u32)TIM_CCS_OUTPUT << TIM_CCMR_CCS));
+		ptTIM->CCR[tChannel] = u16Delay;
+		ptTIM->ARR = ((t_u32)u16Delay + u16Width) - 1U;
+		TIM_vEnableChannel(ptTIM, tChannel, (t_u32)tPolarity);
+
+		/* Load the period and clear the counter, then start the single period */
+		SET_BIT(ptTIM->EGR, TIM_EGR_UG);
+		ptTIM->CR1 |= ((t_u32)1 << TIM_CR1_OPM) | ((t_u32)1 << TIM_CR1_CEN);
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+t_bool TIM_bStartBurstDMA(t_TIM_Peripherals tTIM, t_TIM_Channels tFirstChannel, t_u8 u8ChannelsCount, P2CONST(t_u16) pu16Buffer, t_u16 u16Count, t_bool bCircular, t_TIM_BurstCallback pfCallback)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+	t_DMA_ChannelConfig tDMAConfig;
+	t_bool bStatus = FALSE;
+
+	/* The whole buffer is one DMA transfer, its values must fit in the 16-bit DMA counter */
+	if ((u8ChannelsCount != 0U) && ((tFirstChannel + u8ChannelsCount) <= TIM_CHANNELS_COUNT) && (u16Count != 0U) && (((t_u32)u16Count * u8ChannelsCount) <= TIM_DMA_MAX_COUNT))
+	{
+		bStatus = DMA_bAllocateChannel(atTIMDMAChannels[tTIM], (P2CONST(void))ptTIM);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == TRUE)
+	{
+		apfTIMBurstCallbacks[tTIM] = pfCallback;
+		abTIMBurstCircular[tTIM] = bCircular;
+
+		/* Each update request writes u8ChannelsCount consecutive registers starting from the first compare register */
+		ptTIM->DCR = ((t_u32)(TIM_DCR_DBA_CCR1 + tFirstChannel) << TIM_DCR_DBA) | ((t_u32)(u8ChannelsCount - 1U) << TIM_DCR_DBL);
+
+		tDMAConfig.u32PeripheralAddress = (t_u32)&ptTIM->DMAR;
+		tDMAConfig.u32MemoryAddress = (t_u32)pu16Buffer;
+		tDMAConfig.u16Count = (t_u16)(u16Count * u8ChannelsCount);
+		tDMAConfig.tDirection = DMA_Direction_MemoryToPeripheral;
+		tDMAConfig.tPeripheralSize = DMA_Size_16Bits;
+		tDMAConfig.tMemorySize = DMA_Size_16Bits;
+		tDMAConfig.bPeripheralIncrement = FALSE;
+		tDMAConfig.bMemoryIncrement = TRUE;
+		tDMAConfig.bCircular = bCircular;
+		tDMAConfig.tPriority = DMA_Priority_High;
+		tDMAConfig.u8Events = DMA_Events_TransferComplete;
+		tDMAConfig.pfCallback = TIM_vDMAEventHandler;
+		DMA_vConfigureChannel(atTIMDMAChannels[tTIM], &tDMAConfig);
+		DMA_vSetChannelPriority(atTIMDMAChannels[tTIM], TIM_IRQ_PRIORITY);
+		DMA_vStartChannel(atTIMDMAChannels[tTIM]);
+
+		SET_BIT(ptTIM->DIER, TIM_DIER_UDE);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void TIM_vStopBurstDMA(t_TIM_Peripherals tTIM)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+
+	ptTIM->DIER &= ~((t_u32)1U << TIM_DIER_UDE);
+
+	if (DMA_pvGetChannelOwner(atTIMDMAChannels[tTIM]) == (P2CONST(void))ptTIM)
+	{
+		DMA_vReleaseChannel(atTIMDMAChannels[tTIM]);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_DMA_Channels TIM_tGetUpdateDMAChannel(t_TIM_Peripherals tTIM)
+{
+	return atTIMDMAChannels[tTIM];
+}
+
+void TIM_vEnableUpdateDMARequest(t_TIM_Peripherals tTIM)
+{
+	SET_BIT(aptTIMs[tTIM]->DIER, TIM_DIER_UDE);
+}
+
+void TIM_vDisableUpdateDMARequest(t_TIM_Peripherals tTIM)
+{
+	aptTIMs[tTIM]->DIER &= ~((t_u32)1U << TIM_DIER_UDE);
+}
+
+void TIM_vConfigureEncoder(t_TIM_Peripherals tTIM)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+	t_u32 u32InputMode = ((t_u32)TIM_INPUT_CAPTURE_FILTER << TIM_CCMR_ICF) | ((t_u32)TIM_CCS_INPUT_DIRECT << TIM_CCMR_CCS);
+
+	TIM_vStop(tTIM);
+	TIM_vSetChannelPin(tTIM, TIM_Channels_1, FALSE);
+	TIM_vSetChannelPin(tTIM, TIM_Channels_2, FALSE);
+
+	/* Both inputs on their own pins, not inverted */
+	TIM_vSetChannelMode(ptTIM, TIM_Channels_1, u32InputMode);
+	TIM_vSetChannelMode(ptTIM, TIM_Channels_2, u32InputMode);
+	TIM_vEnableChannel(ptTIM, TIM_Channels_1, (t_u32)TIM_Edge_Rising);
+	TIM_vEnableChannel(ptTIM, TIM_Channels_2, (t_u32)TIM_Edge_Rising);
+	ptTIM->SMCR = (ptTIM->SMCR & ~TIM_SMCR_SMS_MASK) | ((t_u32)TIM_SMS_ENCODER_X4 << TIM_SMCR_SMS);
+
+	/* The whole 16-bit range is used, so the extended position is (overflows << 16) + counter - origin */
+	TIM_vApplyTimeBase(tTIM, 0U, TIM_COUNTER_RANGE - 1U);
+	ptTIM->CNT = TIM_ENCODER_ORIGIN;
+	au32TIMOverflows[tTIM] = 0U;
+	as32TIMEncoderSnapshots[tTIM] = 0;
+	abTIMEncoders[tTIM] = TRUE;
+
+	ptTIM->SR = ~TIM_SR_UPDATE_MASK;
+	SET_BIT(ptTIM->DIER, TIM_DIER_UIE);
+	TIM_vEnableIRQs(tTIM);
+	TIM_vStart(tTIM);
+}
+
+t_s32 TIM_s32GetEncoderPosition(t_TIM_Peripherals tTIM)
+{
+	P2VAR(VOLATILE t_TIM_RegisterMap) ptTIM = aptTIMs[tTIM];
+	/* Read the counter, its overflows and the pending flag as one consistent snapshot */
+	t_u32 u32State = CPU_u32EnterCritical();
+	t_u32 u32Overflows = au32TIMOverflows[tTIM];
+	t_u32 u32Count = ptTIM->CNT;
+
+	if (GET_BIT(ptTIM->SR, TIM_SR_UIF) != 0)
+	{
+		/* Read the counter again, it has surely wrapped by now */
+		u32Count = ptTIM->CNT;
+		u32Overflows += (u32Count < (TIM_COUNTER_RANGE / 2U)) ? 1U : (t_u32)-1;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32State);
+
+	return (t_s32)((u32Overflows << 16) + u32Count - TIM_ENCODER_ORIGIN);
+}
+
+t_s32 TIM_s32SampleEncoderVelocity(t_TIM_Peripherals tTIM, t_u32 u32SampleFrequency)
+{
+	t_s32 s32Position = TIM_s32GetEncoderPosition(tTIM);
+	/* The unsigned difference stays valid when the 32-bit position wraps around */
+	t_s32 s32Distance = (t_s32)((t_u32)s32Position - (t_u32)as32TIMEncoderSnapshots[tTIM]);
+
+	as32TIMEncoderSnapshots[tTIM] = s32Position;
+
+	return s32Distance * (t_s32)u32SampleFrequency;
+}
+
+/**
+ * @brief TIM1 update interrupt handler
+ */
+void TIM1_UP_IRQHandler(void)
+{
+	TIM_vHandleIRQ(TIM_Peripherals_TIM1, TIM_SR_UPDATE_MASK);
+}
+
+/**
+ * @brief TIM1 capture/compare interrupt handler
+ */
+void TIM1_CC_IRQHandler(void)
+{
+	TIM_vHandleIRQ(TIM_Peripherals_TIM1, TIM_SR_CC_MASK);
+}
+
+/**
+ * @brief TIM2 interrupt handler
+ */
+void TIM2_IRQHandler(void)
+{
+	TIM_vHandleIRQ(TIM_Peripherals_TIM2, TIM_SR_UPDATE_MASK | TIM_SR_CC_MASK);
+}
+
+/**
+ * @brief TIM3 interrupt handler
+ */
+void TIM3_IRQHandler(void)
+{
+	TIM_vHandleIRQ(TIM_Peripherals_TIM3, TIM_SR_UPDATE_MASK | TIM_SR_CC_MASK);
+}
+
+/**
+ * @brief TIM4 interrupt handler
+ */
+void TIM4_IRQHandler(void)
+{
+	TIM_vHandleIRQ(TIM_Peripherals_TIM4, TIM_SR_UPDATE_MASK | TIM_SR_CC_MASK);
+}
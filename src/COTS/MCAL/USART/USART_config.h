@@ -0,0 +1,57 @@
+/**
+ * @file USART_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the USART module.
+ * @details This file contains the configuration parameters for the USART module.
+ * @date 2026-10-19
+ */
+
+#ifndef _USART_CONFIG_H_
+#define _USART_CONFIG_H_
+
+#include "USART_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup usart_module
+ * @{
+ */
+
+/**
+ * @defgroup usart_config USART Configuration
+ * @brief This group contains the configuration parameters of the USART module
+ * @{
+ */
+
+/**
+ * @def USART_RX_BUFFER_SIZE
+ * @brief This macro defines the size of the receive buffer of each USART
+ * @details This macro defines the size of the receive buffer of each USART, it must be a power of two.
+ * At 921600 baud a byte arrives every ~11 us, so 256 bytes cover ~2.8 ms of main loop latency
+ */
+#define USART_RX_BUFFER_SIZE (256)
+
+/**
+ * @def USART_TX_BUFFER_SIZE
+ * @brief This macro defines the size of the transmit buffer of each USART
+ * @details This macro defines the size of the transmit buffer of each USART, it must be a power of two
+ */
+#define USART_TX_BUFFER_SIZE (256)
+
+/**
+ * @def USART_IRQ_PRIORITY
+ * @brief This macro defines the NVIC priority of the USART interrupts
+ * @details This macro defines the NVIC priority of the USART interrupts (0 to 15), a high priority keeps the receive latency below one frame time
+ */
+#define USART_IRQ_PRIORITY (2)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _USART_CONFIG_H_ */
@@ -0,0 +1,295 @@
+/**
+ * @file USART_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the USART module.
+ * @details This file contains the prototypes of the functions of the USART module.
+ * @date 2026-10-19
+ */
+
+#ifndef _USART_INTERFACE_H_
+#define _USART_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup usart_module
+ * @{
+ */
+
+/**
+ * @typedef t_USART_Peripherals
+ * @brief USART Peripherals
+ * @details This type is used to select a USART peripheral
+ */
+typedef enum
+{
+	/**
+	 * @brief USART1 (APB2), TX: PA9, RX: PA10
+	 */
+	USART_Peripherals_USART1 = 0,
+	/**
+	 * @brief USART2 (APB1), TX: PA2, RX: PA3
+	 */
+	USART_Peripherals_USART2,
+	/**
+	 * @brief USART3 (APB1), TX: PB10, RX: PB11
+	 */
+	USART_Peripherals_USART3
+} t_USART_Peripherals;
+
+/**
+ * @typedef t_USART_Parity
+ * @brief USART Parity
+ * @details This type is used to select the parity of the frames, the parity bit is added to the 8 data bits
+ */
+typedef enum
+{
+	/**
+	 * @brief No parity
+	 */
+	USART_Parity_None = 0,
+	/**
+	 * @brief Even parity
+	 */
+	USART_Parity_Even,
+	/**
+	 * @brief Odd parity
+	 */
+	USART_Parity_Odd
+} t_USART_Parity;
+
+/**
+ * @typedef t_USART_StopBits
+ * @brief USART Stop Bits
+ * @details This type is used to select the number of stop bits of the frames
+ */
+typedef enum
+{
+	/**
+	 * @brief 1 stop bit
+	 */
+	USART_StopBits_1 = 0,
+	/**
+	 * @brief 0.5 stop bit
+	 */
+	USART_StopBits_0_5,
+	/**
+	 * @brief 2 stop bits
+	 */
+	USART_StopBits_2,
+	/**
+	 * @brief 1.5 stop bits
+	 */
+	USART_StopBits_1_5
+} t_USART_StopBits;
+
+/**
+ * @struct t_USART_Config
+ * @brief USART Configuration
+ * @details This type is used to configure a USART peripheral
+ */
+typedef struct
+{
+	/**
+	 * @brief Baud rate in bits per second
+	 */
+	t_u32 u32BaudRate;
+	/**
+	 * @brief Frame parity
+	 */
+	t_USART_Parity tParity;
+	/**
+	 * @brief Frame stop bits
+	 */
+	t_USART_StopBits tStopBits;
+} t_USART_Config;
+
+/**
+ * @struct t_USART_ErrorCounters
+ * @brief USART Error Counters
+ * @details This type holds the error counters of a USART peripheral, they are only incremented from the interrupt context
+ */
+typedef struct
+{
+	/**
+	 * @brief Number of bytes lost because the data register was not read in time
+	 */
+	t_u32 u32Overrun;
+	/**
+	 * @brief Number of frames received without a valid stop bit
+	 */
+	t_u32 u32Framing;
+	/**
+	 * @brief Number of frames received with noise
+	 */
+	t_u32 u32Noise;
+	/**
+	 * @brief Number of frames received with a wrong parity
+	 */
+	t_u32 u32Parity;
+	/**
+	 * @brief Number of bytes dropped because the receive buffer was full
+	 */
+	t_u32 u32BufferFull;
+	/**
+	 * @brief Number of DMA transfers (receive or transmit) aborted by a bus error
+	 */
+	t_u32 u32DMATransfer;
+} t_USART_ErrorCounters;
+
+/**
+ * @typedef t_USART_RxSpanCallback
+ * @brief USART DMA Receive Span Callback
+ * @details This type is used to define the function that gets each span of bytes received by DMA.
+ * The span points directly into the DMA buffer, it must be consumed before the DMA wraps around to it again
+ */
+typedef P2FUNC(void, t_USART_RxSpanCallback)(t_USART_Peripherals tUSART, P2CONST(t_u8) pu8Data, t_u16 u16Length);
+
+/**
+ * @typedef t_USART_TxCompleteCallback
+ * @brief USART DMA Transmit Complete Callback
+ * @details This type is used to define the function called when the DMA is done reading the caller buffer
+ */
+typedef P2FUNC(void, t_USART_TxCompleteCallback)(t_USART_Peripherals tUSART);
+
+/**
+ * @brief This function initializes a USART peripheral
+ * @details This function configures the pins, the frame format and the baud rate, empties the software buffers,
+ * then enables the receiver, the transmitter and the receive interrupt
+ * @param[in] tUSART The USART peripheral
+ * @param[in] ptConfig The USART configuration
+ * @note The baud rate divider is computed from the current bus frequency (RCC_vInit() must be called first),
+ * and the clocks of the USART and its GPIO port must be enabled
+ * @see t_USART_Peripherals t_USART_Config
+ */
+void USART_vInit(t_USART_Peripherals tUSART, P2CONST(t_USART_Config) ptConfig);
+
+/**
+ * @brief This function changes the baud rate of a USART peripheral
+ * @details This function computes the baud rate divider from the current bus frequency (rounded to the nearest value)
+ * @param[in] tUSART The USART peripheral
+ * @param[in] u32BaudRate The baud rate in bits per second
+ * @see t_USART_Peripherals
+ */
+void USART_vSetBaudRate(t_USART_Peripherals tUSART, t_u32 u32BaudRate);
+
+/**
+ * @brief This function queues data for transmission
+ * @details This function copies as many bytes as fit in the transmit buffer and returns immediately,
+ * the bytes are sent from the interrupt context
+ * @param[in] tUSART The USART peripheral
+ * @param[in] pu8Data The data to send
+ * @param[in] u16Length The number of bytes to send
+ * @return The number of bytes queued (can be less than u16Length if the buffer is full)
+ * @see t_USART_Peripherals
+ */
+t_u16 USART_u16Write(t_USART_Peripherals tUSART, P2CONST(t_u8) pu8Data, t_u16 u16Length);
+
+/**
+ * @brief This function reads received data
+ * @details This function copies as many received bytes as available (up to u16Length) and returns immediately
+ * @param[in] tUSART The USART peripheral
+ * @param[out] pu8Data The buffer to copy the data to
+ * @param[in] u16Length The size of the buffer
+ * @return The number of bytes read (0 if nothing is received)
+ * @see t_USART_Peripherals
+ */
+t_u16 USART_u16Read(t_USART_Peripherals tUSART, P2VAR(t_u8) pu8Data, t_u16 u16Length);
+
+/**
+ * @brief This function gets the number of received bytes waiting in the receive buffer
+ * @details This function gets the number of received bytes waiting in the receive buffer
+ * @param[in] tUSART The USART peripheral
+ * @return The number of bytes available to read
+ * @see t_USART_Peripherals
+ */
+t_u16 USART_u16GetRxCount(t_USART_Peripherals tUSART);
+
+/**
+ * @brief This function gets the free space in the transmit buffer
+ * @details This function gets the free space in the transmit buffer
+ * @param[in] tUSART The USART peripheral
+ * @return The number of bytes that can be written without blocking
+ * @see t_USART_Peripherals
+ */
+t_u16 USART_u16GetTxFree(t_USART_Peripherals tUSART);
+
+/**
+ * @brief This function checks whether all the queued data is sent
+ * @details This function checks that the transmit buffer is empty and the last frame left the shift register
+ * @param[in] tUSART The USART peripheral
+ * @return TRUE if the transmitter is idle, FALSE otherwise
+ * @see t_USART_Peripherals
+ */
+t_bool USART_bIsTxIdle(t_USART_Peripherals tUSART);
+
+/**
+ * @brief This function gets the receive error counters of a USART peripheral
+ * @details This function gets the receive error counters of a USART peripheral, the counters are updated live
+ * @param[in] tUSART The USART peripheral
+ * @return A read-only pointer to the error counters
+ * @see t_USART_Peripherals t_USART_ErrorCounters
+ */
+P2CONST(VOLATILE t_USART_ErrorCounters) USART_ptGetErrorCounters(t_USART_Peripherals tUSART);
+
+/**
+ * @brief This function switches the receiver of a USART peripheral to DMA
+ * @details The DMA fills the caller buffer in circular mode without any CPU work per byte.
+ * The callback gets every new span of bytes, without copying, when the line goes idle (end of a frame)
+ * and when the DMA reaches the half and the end of the buffer (so long frames are reported before being overwritten).
+ * The interrupt-driven receive buffer (USART_u16Read()) is not used in this mode
+ * @param[in] tUSART The USART peripheral (must be initialized with USART_vInit())
+ * @param[in] pu8Buffer The circular receive buffer (owned by the caller until USART_vStopDMAReceive())
+ * @param[in] u16Size The size of the buffer (1 to 65535), it must hold at least twice the bytes received during the longest callback
+ * @param[in] pfCallback The function that gets the received spans
+ * @return TRUE if the receive DMA channel is started, FALSE if the size is 0, the callback is NULL or the channel is owned by
+ * another driver
+ * @note The DMA1 clock must be enabled using RCC_vEnablePeripheralAHB(RCC_AHBPeripherals_DMA1)
+ * @see t_USART_Peripherals t_USART_RxSpanCallback
+ */
+t_bool USART_bStartDMAReceive(t_USART_Peripherals tUSART, P2VAR(t_u8) pu8Buffer, t_u16 u16Size, t_USART_RxSpanCallback pfCallback);
+
+/**
+ * @brief This function switches the receiver of a USART peripheral back to the interrupt-driven mode
+ * @details This function stops and releases the receive DMA channel, the bytes not reported yet are discarded
+ * @param[in] tUSART The USART peripheral
+ * @see t_USART_Peripherals
+ */
+void USART_vStopDMAReceive(t_USART_Peripherals tUSART);
+
+/**
+ * @brief This function sends a caller buffer using DMA
+ * @details The DMA reads the bytes directly from the caller buffer, the callback is called once the last byte is
+ * handed to the USART, the buffer can be reused from then on. The channel is only owned during the transfer
+ * @param[in] tUSART The USART peripheral (must be initialized with USART_vInit())
+ * @param[in] pu8Data The data to send (owned by the driver until the callback is called)
+ * @param[in] u16Length The number of bytes to send (1 to 65535)
+ * @param[in] pfCallback The function called when the transfer is done (can be NULL), it is also called
+ * when a bus error aborts the transfer, the error is counted in t_USART_ErrorCounters::u32DMATransfer
+ * @return TRUE if the transfer is started, FALSE if the length is 0, a DMA transfer is still in progress or the channel is
+ * owned by another driver
+ * @warning Do not mix with USART_u16Write() while a DMA transfer is in progress
+ * @see t_USART_Peripherals t_USART_TxCompleteCallback
+ */
+t_bool USART_bWriteDMA(t_USART_Peripherals tUSART, P2CONST(t_u8) pu8Data, t_u16 u16Length, t_USART_TxCompleteCallback pfCallback);
+
+/**
+ * @brief This function checks whether a DMA transmission is in progress
+ * @details This function checks whether a DMA transmission is in progress
+ * @param[in] tUSART The USART peripheral
+ * @return TRUE if the DMA still reads the caller buffer, FALSE otherwise
+ * @see t_USART_Peripherals
+ */
+t_bool USART_bIsDMATxBusy(t_USART_Peripherals tUSART);
+
+/** @} */
+/** @} */
+
+#endif /* _USART_INTERFACE_H_ */
@@ -0,0 +1,308 @@
+/**
+ * @file USART_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the USART module.
+ * @details This file contains the private macros and registers for the USART module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/USART
+ * @brief USART Module
+ * @details This module contains all the APIs related to the USART peripherals
+ */
+
+#ifndef _USART_PRIVATE_H_
+#define _USART_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup usart_module USART Module
+ * @brief USART Module
+ * @details This module contains all the APIs related to the USART peripherals
+ * @{
+ */
+
+/**
+ * @defgroup usart_registers USART Registers
+ * @brief USART Registers
+ * @{
+ */
+
+/**
+ * @struct t_USART_RegisterMap
+ * @brief USART Register Map
+ * @details This type is used to access the registers of one USART peripheral
+ */
+typedef struct
+{
+	/**
+	 * @brief Status Register
+	 */
+	t_u32 SR;
+	/**
+	 * @brief Data Register
+	 */
+	t_u32 DR;
+	/**
+	 * @brief Baud Rate Register
+	 */
+	t_u32 BRR;
+	/**
+	 * @brief Control Register 1
+	 */
+	t_u32 CR1;
+	/**
+	 * @brief Control Register 2
+	 */
+	t_u32 CR2;
+	/**
+	 * @brief Control Register 3
+	 */
+	t_u32 CR3;
+	/**
+	 * @brief Guard Time and Prescaler Register
+	 */
+	t_u32 GTPR;
+} t_USART_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup usart_addresses USART Addresses
+ * @brief USART Addresses
+ * @details This module contains the addresses of the USART registers
+ * @{
+ */
+
+/**
+ * @def USART1_BASE_ADDRESS
+ * @brief USART1 Base Address in the memory
+ */
+#define USART1_BASE_ADDRESS REGISTER_ADDRESS(0x40013800, 0)
+
+/**
+ * @def USART2_BASE_ADDRESS
+ * @brief USART2 Base Address in the memory
+ */
+#define USART2_BASE_ADDRESS REGISTER_ADDRESS(0x40004400, 0)
+
+/**
+ * @def USART3_BASE_ADDRESS
+ * @brief USART3 Base Address in the memory
+ */
+#define USART3_BASE_ADDRESS REGISTER_ADDRESS(0x40004800, 0)
+
+/**
+ * @def USART1
+ * @brief USART1 Register Map
+ */
+#define USART1 REGISTER(t_USART_RegisterMap, USART1_BASE_ADDRESS)
+
+/**
+ * @def USART2
+ * @brief USART2 Register Map
+ */
+#define USART2 REGISTER(t_USART_RegisterMap, USART2_BASE_ADDRESS)
+
+/**
+ * @def USART3
+ * @brief USART3 Register Map
+ */
+#define USART3 REGISTER(t_USART_RegisterMap, USART3_BASE_ADDRESS)
+
+/** @} */
+
+/**
+ * @defgroup usart_constants USART Constants
+ * @brief USART Constants
+ * @{
+ */
+
+/**
+ * @def USART_PERIPHERALS_COUNT
+ * @brief Number of the USART peripherals
+ */
+#define USART_PERIPHERALS_COUNT (3)
+
+/**
+ * @def USART_SR_PE
+ * @brief Parity error flag
+ */
+#define USART_SR_PE (0)
+
+/**
+ * @def USART_SR_FE
+ * @brief Framing error flag
+ */
+#define USART_SR_FE (1)
+
+/**
+ * @def USART_SR_NE
+ * @brief Noise error flag
+ */
+#define USART_SR_NE (2)
+
+/**
+ * @def USART_SR_ORE
+ * @brief Overrun error flag
+ */
+#define USART_SR_ORE (3)
+
+/**
+ * @def USART_SR_IDLE
+ * @brief Idle line detected flag
+ */
+#define USART_SR_IDLE (4)
+
+/**
+ * @def USART_SR_RXNE
+ * @brief Read data register not empty flag
+ */
+#define USART_SR_RXNE (5)
+
+/**
+ * @def USART_SR_TC
+ * @brief Transmission complete flag
+ */
+#define USART_SR_TC (6)
+
+/**
+ * @def USART_SR_TXE
+ * @brief Transmit data register empty flag
+ */
+#define USART_SR_TXE (7)
+
+/**
+ * @def USART_CR1_RE
+ * @brief Receiver enable bit
+ */
+#define USART_CR1_RE (2)
+
+/**
+ * @def USART_CR1_TE
+ * @brief Transmitter enable bit
+ */
+#define USART_CR1_TE (3)
+
+/**
+ * @def USART_CR1_IDLEIE
+ * @brief Idle line interrupt enable bit
+ */
+#define USART_CR1_IDLEIE (4)
+
+/**
+ * @def USART_CR1_RXNEIE
+ * @brief Read data register not empty (and overrun error) interrupt enable bit
+ */
+#define USART_CR1_RXNEIE (5)
+
+/**
+ * @def USART_CR1_TCIE
+ * @brief Transmission complete interrupt enable bit
+ */
+#define USART_CR1_TCIE (6)
+
+/**
+ * @def USART_CR1_TXEIE
+ * @brief Transmit data register empty interrupt enable bit
+ */
+#define USART_CR1_TXEIE (7)
+
+/**
+ * @def USART_CR1_PS
+ * @brief Parity selection bit (`1`: odd parity)
+ */
+#define USART_CR1_PS (9)
+
+/**
+ * @def USART_CR1_PCE
+ * @brief Parity control enable bit
+ */
+#define USART_CR1_PCE (10)
+
+/**
+ * @def USART_CR1_M
+ * @brief Word length bit (`1`: 9 data bits)
+ */
+#define USART_CR1_M (12)
+
+/**
+ * @def USART_CR1_UE
+ * @brief USART enable bit
+ */
+#define USART_CR1_UE (13)
+
+/**
+ * @def USART_CR2_STOP
+ * @brief Position of the stop bits field
+ */
+#define USART_CR2_STOP (12)
+
+/**
+ * @def USART_CR3_EIE
+ * @brief Error interrupt enable bit (framing, overrun and noise errors while DMA receives)
+ */
+#define USART_CR3_EIE (0)
+
+/**
+ * @def USART_CR3_DMAR
+ * @brief DMA enable receiver bit
+ */
+#define USART_CR3_DMAR (6)
+
+/**
+ * @def USART_CR3_DMAT
+ * @brief DMA enable transmitter bit
+ */
+#define USART_CR3_DMAT (7)
+
+/**
+ * @def USART_SR_ERRORS_MASK
+ * @brief Mask of the receive error flags (PE, FE, NE and ORE)
+ */
+#define USART_SR_ERRORS_MASK ((t_u32)0x0000000FU)
+
+/**
+ * @def USART_IS_POWER_OF_2
+ * @brief Check whether a buffer size is a power of two
+ * @param[in] SIZE The buffer size
+ */
+#define USART_IS_POWER_OF_2(SIZE) (((SIZE) != 0) && (((SIZE) & ((SIZE) - 1)) == 0))
+
+/** @} */
+
+/**
+ * @defgroup usart_handlers USART Interrupt Handlers
+ * @brief The interrupt handlers of the USART module, they are referenced by the vector table
+ * @{
+ */
+
+/**
+ * @brief USART1 interrupt handler
+ */
+void USART1_IRQHandler(void);
+
+/**
+ * @brief USART2 interrupt handler
+ */
+void USART2_IRQHandler(void);
+
+/**
+ * @brief USART3 interrupt handler
+ */
+void USART3_IRQHandler(void);
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _USART_PRIVATE_H_ */
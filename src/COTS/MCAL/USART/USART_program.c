@@ -0,0 +1,670 @@
+/**
+ * @file USART_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the USART module.
+ * @details This file contains the implementation for the USART module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+#include "../RCC/RCC_interface.h"
+#include "../GPIO/GPIO_interface.h"
+#include "../NVIC/NVIC_interface.h"
+#include "../DMA/DMA_interface.h"
+#include "USART_private.h"
+#include "USART_interface.h"
+#include "USART_config.h"
+
+STATIC_ASSERT(USART_IS_POWER_OF_2(USART_RX_BUFFER_SIZE), "USART_RX_BUFFER_SIZE must be a power of two");
+STATIC_ASSERT(USART_IS_POWER_OF_2(USART_TX_BUFFER_SIZE), "USART_TX_BUFFER_SIZE must be a power of two");
+
+/**
+ * @brief The register maps of the USART peripherals
+ */
+STATIC P2VAR(VOLATILE t_USART_RegisterMap) CONST aptUSARTs[USART_PERIPHERALS_COUNT] = {&USART1, &USART2, &USART3};
+
+/**
+ * @brief The NVIC interrupts of the USART peripherals
+ */
+STATIC CONST t_NVIC_IRQs atUSARTIRQs[USART_PERIPHERALS_COUNT] = {NVIC_IRQs_USART1, NVIC_IRQs_USART2, NVIC_IRQs_USART3};
+
+/**
+ * @brief The GPIO ports of the USART pins
+ */
+STATIC CONST t_GPIO_Ports atUSARTPorts[USART_PERIPHERALS_COUNT] = {GPIO_Ports_A, GPIO_Ports_A, GPIO_Ports_B};
+
+/**
+ * @brief The TX pins of the USART peripherals
+ */
+STATIC CONST t_GPIO_Pins atUSARTTxPins[USART_PERIPHERALS_COUNT] = {GPIO_Pins_9, GPIO_Pins_2, GPIO_Pins_10};
+
+/**
+ * @brief The RX pins of the USART peripherals
+ */
+STATIC CONST t_GPIO_Pins atUSARTRxPins[USART_PERIPHERALS_COUNT] = {GPIO_Pins_10, GPIO_Pins_3, GPIO_Pins_11};
+
+/**
+ * @brief The receive ring buffers, written by the interrupt and read by the application
+ */
+STATIC VOLATILE t_u8 au8USARTRxBuffers[USART_PERIPHERALS_COUNT][USART_RX_BUFFER_SIZE];
+
+/**
+ * @brief The receive write indices (free running, owned by the interrupt)
+ */
+STATIC VOLATILE t_u16 au16USARTRxHeads[USART_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The receive read indices (free running, owned by the application)
+ */
+STATIC VOLATILE t_u16 au16USARTRxTails[USART_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The transmit ring buffers, written by the application and read by the interrupt
+ */
+STATIC VOLATILE t_u8 au8USARTTxBuffers[USART_PERIPHERALS_COUNT][USART_TX_BUFFER_SIZE];
+
+/**
+ * @brief The transmit write indices (free running, owned by the application)
+ */
+STATIC VOLATILE t_u16 au16USARTTxHeads[USART_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The transmit read indices (free running, owned by the interrupt)
+ */
+STATIC VOLATILE t_u16 au16USARTTxTails[USART_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The receive error counters
+ */
+STATIC VOLATILE t_USART_ErrorCounters atUSARTErrors[USART_PERIPHERALS_COUNT];
+
+/**
+ * @brief The DMA channels that serve the USART receivers
+ */
+STATIC CONST t_DMA_Channels atUSARTDMARxChannels[USART_PERIPHERALS_COUNT] = {DMA_CHANNEL_USART1_RX, DMA_CHANNEL_USART2_RX, DMA_CHANNEL_USART3_RX};
+
+/**
+ * @brief The DMA channels that serve the USART transmitters
+ */
+STATIC CONST t_DMA_Channels atUSARTDMATxChannels[USART_PERIPHERALS_COUNT] = {DMA_CHANNEL_USART1_TX, DMA_CHANNEL_USART2_TX, DMA_CHANNEL_USART3_TX};
+
+/**
+ * @brief The DMA receive buffers (NULL if the receiver is interrupt-driven)
+ */
+STATIC P2VAR(t_u8) apu8USARTDMARxBuffers[USART_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief The sizes of the DMA receive buffers
+ */
+STATIC t_u16 au16USARTDMARxSizes[USART_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The positions of the first byte not reported yet in the DMA receive buffers
+ */
+STATIC t_u16 au16USARTDMARxPositions[USART_PERIPHERALS_COUNT] = {0};
+
+/**
+ * @brief The callbacks that get the DMA received spans
+ */
+STATIC t_USART_RxSpanCallback apfUSARTRxSpanCallbacks[USART_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief The callbacks of the DMA transmissions
+ */
+STATIC t_USART_TxCompleteCallback apfUSARTTxCompleteCallbacks[USART_PERIPHERALS_COUNT] = {NULL};
+
+/**
+ * @brief The DMA transmission states
+ */
+STATIC VOLATILE t_bool abUSARTDMATxBusy[USART_PERIPHERALS_COUNT] = {FALSE};
+
+/**
+ * @brief This function counts the receive errors reported in a status register value
+ * @details This function counts the receive errors reported in a status register value
+ * @param[in] tUSART The USART peripheral
+ * @param[in] u32Status The status register value
+ */
+STATIC void USART_vCountErrors(t_USART_Peripherals tUSART, t_u32 u32Status)
+{
+	if (GET_BIT(u32Status, USART_SR_ORE) != 0)
+	{
+		atUSARTErrors[tUSART].u32Overrun++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (GET_BIT(u32Status, USART_SR_FE) != 0)
+	{
+		atUSARTErrors[tUSART].u32Framing++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (GET_BIT(u32Status, USART_SR_NE) != 0)
+	{
+		atUSARTErrors[tUSART].u32Noise++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (GET_BIT(u32Status, USART_SR_PE) != 0)
+	{
+		atUSARTErrors[tUSART].u32Parity++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function reports the bytes written by the DMA since the last report
+ * @details The write position is derived from the channel counter, a span that crosses the end of the
+ * circular buffer is reported as two spans so the callback always gets contiguous memory
+ * @param[in] tUSART The USART peripheral
+ */
+STATIC void USART_vReportDMARxSpans(t_USART_Peripherals tUSART)
+{
+	t_u16 u16Size = au16USARTDMARxSizes[tUSART];
+	t_u16 u16Last = au16USARTDMARxPositions[tUSART];
+	t_u16 u16Position = u16Size - DMA_u16GetRemainingCount(atUSARTDMARxChannels[tUSART]);
+
+	/* The counter reloads to the buffer size when the DMA wraps around */
+	if (u16Position >= u16Size)
+	{
+		u16Position = 0;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (u16Position > u16Last)
+	{
+		apfUSARTRxSpanCallbacks[tUSART](tUSART, &apu8USARTDMARxBuffers[tUSART][u16Last], u16Position - u16Last);
+	}
+	else if (u16Position < u16Last)
+	{
+		/* Report the tail of the buffer then its head */
+		apfUSARTRxSpanCallbacks[tUSART](tUSART, &apu8USARTDMARxBuffers[tUSART][u16Last], u16Size - u16Last);
+
+		if (u16Position != 0U)
+		{
+			apfUSARTRxSpanCallbacks[tUSART](tUSART, apu8USARTDMARxBuffers[tUSART], u16Position);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	au16USARTDMARxPositions[tUSART] = u16Position;
+}
+
+/**
+ * @brief This function serves the DMA events of the USART channels
+ * @details This function serves the DMA events of the USART channels
+ * @param[in] tChannel The channel that raised the event
+ * @param[in] tEvent The event
+ */
+STATIC void USART_vDMAEventHandler(t_DMA_Channels tChannel, t_DMA_Events tEvent)
+{
+	t_u8 u8Index = 0;
+
+	for (u8Index = 0; u8Index < USART_PERIPHERALS_COUNT; u8Index++)
+	{
+		if ((atUSARTDMARxChannels[u8Index] == tChannel) && (apu8USARTDMARxBuffers[u8Index] != NULL))
+		{
+			if (tEvent == DMA_Events_TransferError)
+			{
+				/* The hardware disabled the channel and the bytes since the last report are not trusted,
+				 * drop them and restart the stream from the head of the buffer */
+				atUSARTErrors[u8Index].u32DMATransfer++;
+				au16USARTDMARxPositions[u8Index] = 0U;
+				DMA_vRestartChannel(tChannel, (t_u32)apu8USARTDMARxBuffers[u8Index], au16USARTDMARxSizes[u8Index]);
+			}
+			else
+			{
+				/* Half and full buffer events flush the spans of frames longer than half the buffer */
+				USART_vReportDMARxSpans((t_USART_Peripherals)u8Index);
+			}
+		}
+		else if ((atUSARTDMATxChannels[u8Index] == tChannel) && (abUSARTDMATxBusy[u8Index] == TRUE))
+		{
+			if (tEvent == DMA_Events_TransferError)
+			{
+				/* The transfer is aborted, the caller buffer is released anyway */
+				atUSARTErrors[u8Index].u32DMATransfer++;
+			}
+			else
+			{
+				/* Do nothing */
+			}
+
+			/* The transfer is over (complete or aborted by a bus error), the channel is free for the other drivers */
+			DMA_vReleaseChannel(tChannel);
+			aptUSARTs[u8Index]->CR3 &= ~((t_u32)1U << USART_CR3_DMAT);
+			abUSARTDMATxBusy[u8Index] = FALSE;
+
+			if (apfUSARTTxCompleteCallbacks[u8Index] != NULL)
+			{
+				apfUSARTTxCompleteCallbacks[u8Index]((t_USART_Peripherals)u8Index);
+			}
+			else
+			{
+				/* Do nothing */
+			}
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+}
+
+/**
+ * @brief This function serves the interrupt of a USART peripheral
+ * @details Each ring buffer has a single producer and a single consumer, each side only writes its own index
+ * and publishes it after the data, so no critical section is needed on either side
+ * @param[in] tUSART The USART peripheral
+ */
+STATIC void USART_vHandleIRQ(t_USART_Peripherals tUSART)
+{
+	P2VAR(VOLATILE t_USART_RegisterMap) ptUSART = aptUSARTs[tUSART];
+	/* Read the status once, reading DR afterwards clears RXNE and the error flags */
+	t_u32 u32Status = ptUSART->SR;
+	t_u16 u16Head = 0;
+	t_u16 u16Tail = 0;
+	t_u8 u8Data = 0;
+
+	if (apu8USARTDMARxBuffers[tUSART] != NULL)
+	{
+		/* The DMA reads the data register, only the idle line and the errors are served here */
+		if (((u32Status & USART_SR_ERRORS_MASK) != 0U) || (GET_BIT(u32Status, USART_SR_IDLE) != 0))
+		{
+			USART_vCountErrors(tUSART, u32Status);
+			/* Reading DR after SR clears IDLE and the error flags (RXNE is already cleared by the DMA) */
+			(void)ptUSART->DR;
+			USART_vReportDMARxSpans(tUSART);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	/* An overrun raises the interrupt without RXNE in some sequences, DR must be read in both cases */
+	else if ((GET_BIT(u32Status, USART_SR_RXNE) != 0) || (GET_BIT(u32Status, USART_SR_ORE) != 0))
+	{
+		if ((u32Status & USART_SR_ERRORS_MASK) != 0U)
+		{
+			USART_vCountErrors(tUSART, u32Status);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		u8Data = (t_u8)ptUSART->DR;
+		u16Head = au16USARTRxHeads[tUSART];
+
+		if ((t_u16)(u16Head - au16USARTRxTails[tUSART]) < USART_RX_BUFFER_SIZE)
+		{
+			au8USARTRxBuffers[tUSART][u16Head & (USART_RX_BUFFER_SIZE - 1)] = u8Data;
+			au16USARTRxHeads[tUSART] = u16Head + 1U;
+		}
+		else
+		{
+			atUSARTErrors[tUSART].u32BufferFull++;
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if ((GET_BIT(u32Status, USART_SR_TXE) != 0) && (GET_BIT(ptUSART->CR1, USART_CR1_TXEIE) != 0))
+	{
+		u16Tail = au16USARTTxTails[tUSART];
+
+		if (u16Tail != au16USARTTxHeads[tUSART])
+		{
+			ptUSART->DR = au8USARTTxBuffers[tUSART][u16Tail & (USART_TX_BUFFER_SIZE - 1)];
+			au16USARTTxTails[tUSART] = u16Tail + 1U;
+		}
+		else
+		{
+			/* Nothing left to send, stop the TXE interrupt */
+			BITBAND_PERIPHERAL(&ptUSART->CR1, USART_CR1_TXEIE) = 0U;
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+void USART_vInit(t_USART_Peripherals tUSART, P2CONST(t_USART_Config) ptConfig)
+{
+	P2VAR(VOLATILE t_USART_RegisterMap) ptUSART = aptUSARTs[tUSART];
+	/* Store the new value of the control register 1 */
+	t_u32 u32CR1 = 0U;
+
+	/* Disable the peripheral and its interrupt while it is being configured */
+	NVIC_vDisableIRQ(atUSARTIRQs[tUSART]);
+	ptUSART->CR1 = 0U;
+	apu8USARTDMARxBuffers[tUSART] = NULL;
+	abUSARTDMATxBusy[tUSART] = FALSE;
+
+	/* Empty the software buffers and reset the error counters */
+	au16USARTRxHeads[tUSART] = 0U;
+	au16USARTRxTails[tUSART] = 0U;
+	au16USARTTxHeads[tUSART] = 0U;
+	au16USARTTxTails[tUSART] = 0U;
+	atUSARTErrors[tUSART].u32Overrun = 0U;
+	atUSARTErrors[tUSART].u32Framing = 0U;
+	atUSARTErrors[tUSART].u32Noise = 0U;
+	atUSARTErrors[tUSART].u32Parity = 0U;
+	atUSARTErrors[tUSART].u32BufferFull = 0U;
+	atUSARTErrors[tUSART].u32DMATransfer = 0U;
+
+	/* TX is an alternate function output, RX is an input pulled to the idle level */
+	GPIO_vSetPinDirection(atUSARTPorts[tUSART], atUSARTTxPins[tUSART], GPIO_Direction_Output_50MHz);
+	GPIO_vSetPinOutputType(atUSARTPorts[tUSART], atUSARTTxPins[tUSART], GPIO_Output_Type_Alternate_Push_Pull);
+	GPIO_vSetPinDirection(atUSARTPorts[tUSART], atUSARTRxPins[tUSART], GPIO_Direction_Input);
+	GPIO_vSetPinInputType(atUSARTPorts[tUSART], atUSARTRxPins[tUSART], GPIO_Input_Type_Pull_Up);
+
+	/* Select the stop bits */
+	ptUSART->CR2 = ((t_u32)ptConfig->tStopBits << USART_CR2_STOP);
+	ptUSART->CR3 = 0U;
+
+	/* The parity bit is added to the 8 data bits (9-bit frames) */
+	if (ptConfig->tParity != USART_Parity_None)
+	{
+		SET_BIT(u32CR1, USART_CR1_M);
+		SET_BIT(u32CR1, USART_CR1_PCE);
+
+		if (ptConfig->tParity == USART_Parity_Odd)
+		{
+			SET_BIT(u32CR1, USART_CR1_PS);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	USART_vSetBaudRate(tUSART, ptConfig->u32BaudRate);
+
+	/* Enable the receiver, the transmitter and the receive interrupt, the TXE interrupt is enabled on demand */
+	SET_BIT(u32CR1, USART_CR1_RE);
+	SET_BIT(u32CR1, USART_CR1_TE);
+	SET_BIT(u32CR1, USART_CR1_RXNEIE);
+	SET_BIT(u32CR1, USART_CR1_UE);
+	ptUSART->CR1 = u32CR1;
+
+	NVIC_vSetPriority(atUSARTIRQs[tUSART], USART_IRQ_PRIORITY);
+	NVIC_vEnableIRQ(atUSARTIRQs[tUSART]);
+}
+
+void USART_vSetBaudRate(t_USART_Peripherals tUSART, t_u32 u32BaudRate)
+{
+	/* USART1 is clocked from APB2, USART2 and USART3 from APB1 */
+	t_u32 u32Clock = (tUSART == USART_Peripherals_USART1) ? RCC_u32GetAPB2ClockFrequency() : RCC_u32GetAPB1ClockFrequency();
+
+	/* BRR holds USARTDIV * 16 (12-bit mantissa, 4-bit fraction), which is the clock divided by the baud rate */
+	aptUSARTs[tUSART]->BRR = (u32Clock + (u32BaudRate / 2U)) / u32BaudRate;
+}
+
+t_u16 USART_u16Write(t_USART_Peripherals tUSART, P2CONST(t_u8) pu8Data, t_u16 u16Length)
+{
+	t_u16 u16Head = au16USARTTxHeads[tUSART];
+	t_u16 u16Free = USART_TX_BUFFER_SIZE - (t_u16)(u16Head - au16USARTTxTails[tUSART]);
+	t_u16 u16Index = 0;
+
+	if (u16Length > u16Free)
+	{
+		u16Length = u16Free;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	for (u16Index = 0; u16Index < u16Length; u16Index++)
+	{
+		au8USARTTxBuffers[tUSART][(t_u16)(u16Head + u16Index) & (USART_TX_BUFFER_SIZE - 1)] = pu8Data[u16Index];
+	}
+
+	/* Publish the bytes only after they are stored */
+	au16USARTTxHeads[tUSART] = u16Head + u16Length;
+
+	if (u16Length != 0U)
+	{
+		/* The interrupt clears the same bit, so it is set through its bit-band alias */
+		BITBAND_PERIPHERAL(&aptUSARTs[tUSART]->CR1, USART_CR1_TXEIE) = 1U;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return u16Length;
+}
+
+t_u16 USART_u16Read(t_USART_Peripherals tUSART, P2VAR(t_u8) pu8Data, t_u16 u16Length)
+{
+	t_u16 u16Tail = au16USARTRxTails[tUSART];
+	t_u16 u16Count = (t_u16)(au16USARTRxHeads[tUSART] - u16Tail);
+	t_u16 u16Index = 0;
+
+	if (u16Length > u16Count)
+	{
+		u16Length = u16Count;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	for (u16Index = 0; u16Index < u16Length; u16Index++)
+	{
+		pu8Data[u16Index] = au8USARTRxBuffers[tUSART][(t_u16)(u16Tail + u16Index) & (USART_RX_BUFFER_SIZE - 1)];
+	}
+
+	/* Release the space only after the bytes are copied */
+	au16USARTRxTails[tUSART] = u16Tail + u16Length;
+
+	return u16Length;
+}
+
+t_u16 USART_u16GetRxCount(t_USART_Peripherals tUSART)
+{
+	return (t_u16)(au16USARTRxHeads[tUSART] - au16USARTRxTails[tUSART]);
+}
+
+t_u16 USART_u16GetTxFree(t_USART_Peripherals tUSART)
+{
+	return USART_TX_BUFFER_SIZE - (t_u16)(au16USARTTxHeads[tUSART] - au16USARTTxTails[tUSART]);
+}
+
+t_bool USART_bIsTxIdle(t_USART_Peripherals tUSART)
+{
+	return (au16USARTTxHeads[tUSART] == au16USARTTxTails[tUSART]) && (GET_BIT(aptUSARTs[tUSART]->SR, USART_SR_TC) != 0);
+}
+
+P2CONST(VOLATILE t_USART_ErrorCounters) USART_ptGetErrorCounters(t_USART_Peripherals tUSART)
+{
+	return &atUSARTErrors[tUSART];
+}
+
+t_bool USART_bStartDMAReceive(t_USART_Peripherals tUSART, P2VAR(t_u8) pu8Buffer, t_u16 u16Size, t_USART_RxSpanCallback pfCallback)
+{
+	P2VAR(VOLATILE t_USART_RegisterMap) ptUSART = aptUSARTs[tUSART];
+	t_DMA_ChannelConfig tDMAConfig;
+	t_bool bStatus = FALSE;
+
+	/* An empty buffer would start a stream that never raises an event, the spans need a consumer */
+	if ((u16Size != 0U) && (pfCallback != NULL))
+	{
+		bStatus = DMA_bAllocateChannel(atUSARTDMARxChannels[tUSART], (P2CONST(void))ptUSART);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (bStatus == TRUE)
+	{
+		/* Stop the byte interrupt before the DMA takes over the data register */
+		NVIC_vDisableIRQ(atUSARTIRQs[tUSART]);
+		ptUSART->CR1 &= ~((t_u32)1U << USART_CR1_RXNEIE);
+
+		apu8USARTDMARxBuffers[tUSART] = pu8Buffer;
+		au16USARTDMARxSizes[tUSART] = u16Size;
+		au16USARTDMARxPositions[tUSART] = 0U;
+		apfUSARTRxSpanCallbacks[tUSART] = pfCallback;
+
+		tDMAConfig.u32PeripheralAddress = (t_u32)&ptUSART->DR;
+		tDMAConfig.u32MemoryAddress = (t_u32)pu8Buffer;
+		tDMAConfig.u16Count = u16Size;
+		tDMAConfig.tDirection = DMA_Direction_PeripheralToMemory;
+		tDMAConfig.tPeripheralSize = DMA_Size_8Bits;
+		tDMAConfig.tMemorySize = DMA_Size_8Bits;
+		tDMAConfig.bPeripheralIncrement = FALSE;
+		tDMAConfig.bMemoryIncrement = TRUE;
+		tDMAConfig.bCircular = TRUE;
+		tDMAConfig.tPriority = DMA_Priority_VeryHigh;
+		tDMAConfig.u8Events = DMA_Events_HalfTransfer | DMA_Events_TransferComplete | DMA_Events_TransferError;
+		tDMAConfig.pfCallback = USART_vDMAEventHandler;
+		DMA_vConfigureChannel(atUSARTDMARxChannels[tUSART], &tDMAConfig);
+		/* The DMA events and the idle line share the span state, they must not preempt each other */
+		DMA_vSetChannelPriority(atUSARTDMARxChannels[tUSART], USART_IRQ_PRIORITY);
+		DMA_vStartChannel(atUSARTDMARxChannels[tUSART]);
+
+		/* Clear a stale idle flag (SR then DR read), then hand the receiver to the DMA */
+		(void)ptUSART->SR;
+		(void)ptUSART->DR;
+		SET_BIT(ptUSART->CR3, USART_CR3_EIE);
+		SET_BIT(ptUSART->CR3, USART_CR3_DMAR);
+		SET_BIT(ptUSART->CR1, USART_CR1_IDLEIE);
+		NVIC_vEnableIRQ(atUSARTIRQs[tUSART]);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void USART_vStopDMAReceive(t_USART_Peripherals tUSART)
+{
+	P2VAR(VOLATILE t_USART_RegisterMap) ptUSART = aptUSARTs[tUSART];
+
+	if (apu8USARTDMARxBuffers[tUSART] != NULL)
+	{
+		NVIC_vDisableIRQ(atUSARTIRQs[tUSART]);
+		ptUSART->CR1 &= ~((t_u32)1U << USART_CR1_IDLEIE);
+		ptUSART->CR3 &= ~((t_u32)1U << USART_CR3_DMAR);
+		ptUSART->CR3 &= ~((t_u32)1U << USART_CR3_EIE);
+		DMA_vReleaseChannel(atUSARTDMARxChannels[tUSART]);
+		apu8USARTDMARxBuffers[tUSART] = NULL;
+
+		/* Back to the interrupt-driven receiver */
+		au16USARTRxTails[tUSART] = au16USARTRxHeads[tUSART];
+		SET_BIT(ptUSART->CR1, USART_CR1_RXNEIE);
+		NVIC_vEnableIRQ(atUSARTIRQs[tUSART]);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool USART_bWriteDMA(t_USART_Peripherals tUSART, P2CONST(t_u8) pu8Data, t_u16 u16Length, t_USART_TxCompleteCallback pfCallback)
+{
+	P2VAR(VOLATILE t_USART_RegisterMap) ptUSART = aptUSARTs[tUSART];
+	t_DMA_ChannelConfig tDMAConfig;
+	t_bool bStatus = FALSE;
+
+	/* A zero count never completes, the transfer would stay busy forever */
+	if ((u16Length != 0U) && (abUSARTDMATxBusy[tUSART] == FALSE) && (DMA_bAllocateChannel(atUSARTDMATxChannels[tUSART], (P2CONST(void))ptUSART) == TRUE))
+	{
+		abUSARTDMATxBusy[tUSART] = TRUE;
+		apfUSARTTxCompleteCallbacks[tUSART] = pfCallback;
+
+		tDMAConfig.u32PeripheralAddress = (t_u32)&ptUSART->DR;
+		tDMAConfig.u32MemoryAddress = (t_u32)pu8Data;
+		tDMAConfig.u16Count = u16Length;
+		tDMAConfig.tDirection = DMA_Direction_MemoryToPeripheral;
+		tDMAConfig.tPeripheralSize = DMA_Size_8Bits;
+		tDMAConfig.tMemorySize = DMA_Size_8Bits;
+		tDMAConfig.bPeripheralIncrement = FALSE;
+		tDMAConfig.bMemoryIncrement = TRUE;
+		tDMAConfig.bCircular = FALSE;
+		tDMAConfig.tPriority = DMA_Priority_High;
+		tDMAConfig.u8Events = DMA_Events_TransferComplete | DMA_Events_TransferError;
+		tDMAConfig.pfCallback = USART_vDMAEventHandler;
+		DMA_vConfigureChannel(atUSARTDMATxChannels[tUSART], &tDMAConfig);
+		DMA_vSetChannelPriority(atUSARTDMATxChannels[tUSART], USART_IRQ_PRIORITY);
+
+		/* Each TXE request moves one byte, the first request is raised as soon as DMAT is set */
+		SET_BIT(ptUSART->CR3, USART_CR3_DMAT);
+		DMA_vStartChannel(atUSARTDMATxChannels[tUSART]);
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+t_bool USART_bIsDMATxBusy(t_USART_Peripherals tUSART)
+{
+	return abUSARTDMATxBusy[tUSART];
+}
+
+/**
+ * @brief USART1 interrupt handler
+ */
+void USART1_IRQHandler(void)
+{
+	USART_vHandleIRQ(USART_Peripherals_USART1);
+}
+
+/**
+ * @brief USART2 interrupt handler
+ */
+void USART2_IRQHandler(void)
+{
+	USART_vHandleIRQ(USART_Peripherals_USART2);
+}
+
+/**
+ * @brief USART3 interrupt handler
+ */
+void USART3_IRQHandler(void)
+{
+	USART_vHandleIRQ(USART_Peripherals_USART3);
+}
@@ -0,0 +1,49 @@
+/**
+ * @file WWDG_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the WWDG module.
+ * @details This file contains the configuration parameters for the WWDG module.
+ * @date 2026-10-19
+ */
+
+#ifndef _WWDG_CONFIG_H_
+#define _WWDG_CONFIG_H_
+
+#include "WWDG_interface.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup wwdg_module
+ * @{
+ */
+
+/**
+ * @defgroup wwdg_config WWDG Configuration
+ * @brief This group contains the configuration parameters of the WWDG module
+ * @{
+ */
+
+/**
+ * @def WWDG_IRQ_PRIORITY
+ * @brief This macro defines the NVIC priority of the early wakeup interrupt
+ * @details This macro defines the NVIC priority of the early wakeup interrupt (0 to 15), it comes one counter tick
+ * before the reset so it must preempt everything that may be stuck
+ */
+#define WWDG_IRQ_PRIORITY (0)
+
+/**
+ * @def WWDG_STOP_IN_DEBUG
+ * @brief This macro defines whether the watchdog stops while the core is halted by the debugger (1) or not (0)
+ */
+#define WWDG_STOP_IN_DEBUG (1)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _WWDG_CONFIG_H_ */
@@ -0,0 +1,101 @@
+/**
+ * @file WWDG_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the WWDG module.
+ * @details This file contains the prototypes of the functions of the WWDG module.
+ * @date 2026-10-19
+ */
+
+#ifndef _WWDG_INTERFACE_H_
+#define _WWDG_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @addtogroup wwdg_module
+ * @{
+ */
+
+/**
+ * @typedef t_WWDG_Callback
+ * @brief WWDG Callback
+ * @details This type is used to define the function called from the early wakeup interrupt, one counter tick before
+ * the reset. It can save a diagnostic record, or call WWDG_vRefresh() to survive if the system can recover
+ */
+typedef P2FUNC(void, t_WWDG_Callback)(void);
+
+/**
+ * @struct t_WWDG_Stats
+ * @brief WWDG Refresh Statistics
+ * @details This type is used to read the timing of the refreshes, the margins have the resolution of one counter tick
+ * @see WWDG_bGetStats
+ */
+typedef struct
+{
+	/**
+	 * @brief The number of the refreshes since the start or the last WWDG_vResetStats()
+	 */
+	t_u32 u32Refreshes;
+	/**
+	 * @brief The number of the early wakeup interrupts
+	 */
+	t_u32 u32EarlyWakeups;
+	/**
+	 * @brief The shortest time between two refreshes in microseconds
+	 */
+	t_u32 u32MinPeriodUs;
+	/**
+	 * @brief The longest time between two refreshes in microseconds, the jitter is the difference with the shortest
+	 */
+	t_u32 u32MaxPeriodUs;
+	/**
+	 * @brief The smallest margin to the opening of the window in microseconds (an earlier refresh resets)
+	 */
+	t_u32 u32MinWindowMarginUs;
+	/**
+	 * @brief The smallest margin to the timeout in microseconds (a later refresh resets)
+	 */
+	t_u32 u32MinTimeoutMarginUs;
+} t_WWDG_Stats;
+
+/**
+ * @brief This function starts the window watchdog
+ * @details The smallest timer base that fits the timeout in the 64 ticks of the counter is used, which gives the finest
+ * resolution (113.8 us with a 36 MHz PCLK1). The WWDG clock is enabled by this function
+ * @param[in] u32TimeoutUs The longest time from a refresh to the next one in microseconds
+ * @param[in] u32WindowUs The shortest time from a refresh to the next one in microseconds (0 for no lower limit)
+ * @param[in] pfEarlyWakeup The function called from the early wakeup interrupt (NULL to disable the interrupt)
+ * @return TRUE if the watchdog is started, FALSE if the timeout or the window is out of range
+ * @warning The watchdog cannot be stopped once started, only a reset does it
+ */
+t_bool WWDG_bStart(t_u32 u32TimeoutUs, t_u32 u32WindowUs, t_WWDG_Callback pfEarlyWakeup);
+
+/**
+ * @brief This function reloads the watchdog counter and records the timing of the refresh
+ * @warning A refresh before the window opens resets the microcontroller
+ */
+void WWDG_vRefresh(void);
+
+/**
+ * @brief This function gets the timing of the refreshes
+ * @param[out] ptStats The statistics
+ * @return TRUE if the statistics are read, FALSE if the watchdog is not started
+ */
+t_bool WWDG_bGetStats(P2VAR(t_WWDG_Stats) ptStats);
+
+/**
+ * @brief This function restarts the statistics of the refreshes
+ */
+void WWDG_vResetStats(void);
+
+/** @} */
+/** @} */
+
+#endif /* _WWDG_INTERFACE_H_ */
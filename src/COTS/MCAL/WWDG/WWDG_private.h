@@ -0,0 +1,175 @@
+/**
+ * @file WWDG_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros and registers for the WWDG module.
+ * @details This file contains the private macros and registers for the WWDG module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir MCAL/WWDG
+ * @brief WWDG Module
+ * @details This module contains all the APIs related to the Window Watchdog
+ */
+
+#ifndef _WWDG_PRIVATE_H_
+#define _WWDG_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_HW_REGS.h"
+
+/**
+ * @addtogroup mcal
+ * @{
+ */
+
+/**
+ * @defgroup wwdg_module WWDG Module
+ * @brief WWDG Module
+ * @details This module contains all the APIs related to the Window Watchdog. Besides the watchdog itself, every refresh
+ * reads the down counter first, which tells how long after the previous refresh it came, so the driver also profiles the
+ * jitter of the task that refreshes it and how close it came to both edges of the window
+ * @{
+ */
+
+/**
+ * @defgroup wwdg_registers WWDG Registers
+ * @brief WWDG Registers
+ * @{
+ */
+
+/**
+ * @struct t_WWDG_RegisterMap
+ * @brief WWDG Register Map
+ * @details This type is used to access the WWDG registers
+ */
+typedef struct
+{
+	/**
+	 * @brief Control Register
+	 */
+	t_u32 CR;
+	/**
+	 * @brief Configuration Register
+	 */
+	t_u32 CFR;
+	/**
+	 * @brief Status Register
+	 */
+	t_u32 SR;
+} t_WWDG_RegisterMap;
+
+/** @} */
+
+/**
+ * @defgroup wwdg_addresses WWDG Addresses
+ * @brief WWDG Addresses
+ * @details This module contains the addresses of the WWDG registers
+ * @{
+ */
+
+/**
+ * @def WWDG_BASE_ADDRESS
+ * @brief WWDG Base Address in the memory
+ */
+#define WWDG_BASE_ADDRESS REGISTER_ADDRESS(0x40002C00, 0)
+
+/**
+ * @def WWDG
+ * @brief WWDG Register Map
+ */
+#define WWDG REGISTER(t_WWDG_RegisterMap, WWDG_BASE_ADDRESS)
+
+/**
+ * @def WWDG_DBGMCU_CR
+ * @brief Debug MCU Configuration Register, it holds the bit that stops the watchdog while the core is halted
+ */
+#define WWDG_DBGMCU_CR REGISTER_U32(REGISTER_ADDRESS(0xE0042004, 0))
+
+/** @} */
+
+/**
+ * @defgroup wwdg_constants WWDG Constants
+ * @brief WWDG Constants
+ * @{
+ */
+
+/**
+ * @def WWDG_CR_WDGA
+ * @brief Activation bit, it can only be cleared by a reset
+ */
+#define WWDG_CR_WDGA (7)
+
+/**
+ * @def WWDG_CR_T_MASK
+ * @brief Mask of the 7-bit down counter in the CR register
+ */
+#define WWDG_CR_T_MASK ((t_u32)0x7FU)
+
+/**
+ * @def WWDG_CFR_WDGTB
+ * @brief Position of the timer base (prescaler) field in the CFR register
+ */
+#define WWDG_CFR_WDGTB (7)
+
+/**
+ * @def WWDG_CFR_EWI
+ * @brief Early wakeup interrupt enable bit
+ */
+#define WWDG_CFR_EWI (9)
+
+/**
+ * @def WWDG_SR_EWIF
+ * @brief Early wakeup interrupt flag, cleared by writing 0
+ */
+#define WWDG_SR_EWIF (0)
+
+/**
+ * @def WWDG_COUNTER_MAX
+ * @brief The largest value of the down counter
+ */
+#define WWDG_COUNTER_MAX ((t_u32)0x7FU)
+
+/**
+ * @def WWDG_COUNTER_RESET
+ * @brief The value of the down counter at which the reset happens (bit 6 cleared)
+ */
+#define WWDG_COUNTER_RESET ((t_u32)0x3FU)
+
+/**
+ * @def WWDG_TIMEBASE_MAX
+ * @brief The largest value of the timer base field (divide by 8)
+ */
+#define WWDG_TIMEBASE_MAX (3U)
+
+/**
+ * @def WWDG_CLOCK_DIVIDER
+ * @brief The fixed divider of PCLK1 in front of the timer base
+ */
+#define WWDG_CLOCK_DIVIDER (4096U)
+
+/**
+ * @def WWDG_DBGMCU_CR_DBG_WWDG_STOP
+ * @brief The bit that stops the watchdog counter while the core is halted by the debugger
+ */
+#define WWDG_DBGMCU_CR_DBG_WWDG_STOP (9)
+
+/** @} */
+
+/**
+ * @defgroup wwdg_handlers WWDG Interrupt Handlers
+ * @brief The interrupt handlers of the WWDG module, they are referenced by the vector table
+ * @{
+ */
+
+/**
+ * @brief WWDG early wakeup interrupt handler
+ */
+void WWDG_IRQHandler(void);
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _WWDG_PRIVATE_H_ */
@@ -0,0 +1,262 @@
+/**
+ * @file WWDG_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the WWDG module.
+ * @details This file contains the implementation for the WWDG module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_BITMATH.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../RCC/RCC_interface.h"
+#include "../NVIC/NVIC_interface.h"
+#include "WWDG_private.h"
+#include "WWDG_interface.h"
+#include "WWDG_config.h"
+
+/**
+ * @brief The function called from the early wakeup interrupt
+ */
+STATIC t_WWDG_Callback pfWWDGEarlyWakeup = NULL;
+
+/**
+ * @brief The duration of one counter tick in nanoseconds (0 while the watchdog is not started)
+ */
+STATIC t_u32 u32WWDGTickNs = 0;
+
+/**
+ * @brief The value written to the counter on each refresh
+ */
+STATIC t_u32 u32WWDGReload = 0;
+
+/**
+ * @brief The window value, a refresh is allowed once the counter is not above it
+ */
+STATIC t_u32 u32WWDGWindow = 0;
+
+/**
+ * @brief The number of the refreshes
+ */
+STATIC t_u32 u32WWDGRefreshes = 0;
+
+/**
+ * @brief The number of the early wakeup interrupts
+ */
+STATIC VOLATILE t_u32 u32WWDGEarlyWakeups = 0;
+
+/**
+ * @brief The shortest time between two refreshes in counter ticks
+ */
+STATIC t_u32 u32WWDGMinElapsed = 0;
+
+/**
+ * @brief The longest time between two refreshes in counter ticks
+ */
+STATIC t_u32 u32WWDGMaxElapsed = 0;
+
+/**
+ * @brief The smallest margin to the opening of the window in counter ticks
+ */
+STATIC t_u32 u32WWDGMinWindowMargin = 0;
+
+/**
+ * @brief The smallest margin to the timeout in counter ticks
+ */
+STATIC t_u32 u32WWDGMinTimeoutMargin = 0;
+
+t_bool WWDG_bStart(t_u32 u32TimeoutUs, t_u32 u32WindowUs, t_WWDG_Callback pfEarlyWakeup)
+{
+	t_bool bStatus = FALSE;
+	t_u32 u32ClockMHz = RCC_u32GetAPB1ClockFrequency() / 1000000U;
+	t_u32 u32TimeBase = 0;
+	t_u32 u32TickNs = 0;
+	t_u32 u32Ticks = 0;
+	t_u32 u32WindowTicks = 0;
+
+	if ((u32ClockMHz != 0U) && (u32TimeoutUs != 0U) && (u32WindowUs < u32TimeoutUs))
+	{
+		u32TickNs = (WWDG_CLOCK_DIVIDER * 1000U) / u32ClockMHz;
+
+		/* The counter has 64 ticks from its largest value to the reset */
+		while ((u32TimeBase <= WWDG_TIMEBASE_MAX) && (u32TimeoutUs > (((WWDG_COUNTER_MAX - WWDG_COUNTER_RESET) * u32TickNs) / 1000U)))
+		{
+			u32TimeBase++;
+			u32TickNs = ((WWDG_CLOCK_DIVIDER << u32TimeBase) * 1000U) / u32ClockMHz;
+		}
+
+		if (u32TimeBase <= WWDG_TIMEBASE_MAX)
+		{
+			u32Ticks = (u32TimeoutUs * 1000U) / u32TickNs;
+			u32WindowTicks = ((u32WindowUs * 1000U) + u32TickNs - 1U) / u32TickNs;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* The window must open at least one tick before the timeout */
+	if ((u32Ticks != 0U) && (u32WindowTicks < u32Ticks))
+	{
+		pfWWDGEarlyWakeup = pfEarlyWakeup;
+		u32WWDGTickNs = u32TickNs;
+		u32WWDGReload = WWDG_COUNTER_RESET + u32Ticks;
+		u32WWDGWindow = u32WWDGReload - u32WindowTicks;
+		WWDG_vResetStats();
+
+		RCC_vEnablePeripheralABP1(RCC_APB1Peripherals_WWDG);
+
+#if WWDG_STOP_IN_DEBUG == 1
+		SET_BIT(WWDG_DBGMCU_CR, WWDG_DBGMCU_CR_DBG_WWDG_STOP);
+#endif
+
+		WWDG.CFR = (u32TimeBase << WWDG_CFR_WDGTB) | u32WWDGWindow | ((pfEarlyWakeup != NULL) ? ((t_u32)1 << WWDG_CFR_EWI) : 0U);
+		WWDG.SR = 0U;
+
+		if (pfEarlyWakeup != NULL)
+		{
+			NVIC_vSetPriority(NVIC_IRQs_WWDG, WWDG_IRQ_PRIORITY);
+			NVIC_vClearPendingIRQ(NVIC_IRQs_WWDG);
+			NVIC_vEnableIRQ(NVIC_IRQs_WWDG);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		WWDG.CR = ((t_u32)1 << WWDG_CR_WDGA) | u32WWDGReload;
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void WWDG_vRefresh(void)
+{
+	/* Read the counter right before the reload, the read tells when the refresh happened within the period */
+	t_u32 u32Counter = WWDG.CR & WWDG_CR_T_MASK;
+
+	WWDG.CR = ((t_u32)1 << WWDG_CR_WDGA) | u32WWDGReload;
+
+	u32WWDGRefreshes++;
+
+	if ((u32WWDGReload - u32Counter) < u32WWDGMinElapsed)
+	{
+		u32WWDGMinElapsed = u32WWDGReload - u32Counter;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if ((u32WWDGReload - u32Counter) > u32WWDGMaxElapsed)
+	{
+		u32WWDGMaxElapsed = u32WWDGReload - u32Counter;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* A counter above the window would have reset the microcontroller, so the margins cannot be negative */
+	if ((u32WWDGWindow - u32Counter) < u32WWDGMinWindowMargin)
+	{
+		u32WWDGMinWindowMargin = u32WWDGWindow - u32Counter;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if ((u32Counter - (WWDG_COUNTER_RESET + 1U)) < u32WWDGMinTimeoutMargin)
+	{
+		u32WWDGMinTimeoutMargin = u32Counter - (WWDG_COUNTER_RESET + 1U);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool WWDG_bGetStats(P2VAR(t_WWDG_Stats) ptStats)
+{
+	t_bool bStatus = FALSE;
+	t_u32 u32PRIMASK = 0;
+
+	if (u32WWDGTickNs != 0U)
+	{
+		u32PRIMASK = CPU_u32EnterCritical();
+
+		ptStats->u32Refreshes = u32WWDGRefreshes;
+		ptStats->u32EarlyWakeups = u32WWDGEarlyWakeups;
+
+		if (u32WWDGRefreshes != 0U)
+		{
+			ptStats->u32MinPeriodUs = (u32WWDGMinElapsed * u32WWDGTickNs) / 1000U;
+			ptStats->u32MaxPeriodUs = (u32WWDGMaxElapsed * u32WWDGTickNs) / 1000U;
+			ptStats->u32MinWindowMarginUs = (u32WWDGMinWindowMargin * u32WWDGTickNs) / 1000U;
+			ptStats->u32MinTimeoutMarginUs = (u32WWDGMinTimeoutMargin * u32WWDGTickNs) / 1000U;
+		}
+		else
+		{
+			ptStats->u32MinPeriodUs = 0U;
+			ptStats->u32MaxPeriodUs = 0U;
+			ptStats->u32MinWindowMarginUs = 0U;
+			ptStats->u32MinTimeoutMarginUs = 0U;
+		}
+
+		CPU_vExitCritical(u32PRIMASK);
+
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void WWDG_vResetStats(void)
+{
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	u32WWDGRefreshes = 0U;
+	u32WWDGEarlyWakeups = 0U;
+	u32WWDGMinElapsed = (t_u32)-1;
+	u32WWDGMaxElapsed = 0U;
+	u32WWDGMinWindowMargin = (t_u32)-1;
+	u32WWDGMinTimeoutMargin = (t_u32)-1;
+
+	CPU_vExitCritical(u32PRIMASK);
+}
+
+/**
+ * @brief WWDG early wakeup interrupt handler
+ */
+void WWDG_IRQHandler(void)
+{
+	WWDG.SR = 0U;
+	u32WWDGEarlyWakeups++;
+
+	if (pfWWDGEarlyWakeup != NULL)
+	{
+		pfWWDGEarlyWakeup();
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
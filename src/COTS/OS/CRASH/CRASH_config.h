@@ -0,0 +1,59 @@
+/**
+ * @file CRASH_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the CRASH module.
+ * @details This file contains the configuration parameters for the CRASH module.
+ * @date 2026-10-19
+ */
+
+#ifndef _CRASH_CONFIG_H_
+#define _CRASH_CONFIG_H_
+
+#include "CRASH_interface.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup crash_module
+ * @{
+ */
+
+/**
+ * @defgroup crash_config CRASH Configuration
+ * @brief This group contains the configuration parameters of the CRASH module
+ * @details The record takes 4 * (18 + CRASH_STACK_WORDS + 2 * CRASH_EVENTS_COUNT) bytes of `.noinit` RAM and the live
+ * event log 8 * CRASH_EVENTS_COUNT bytes more
+ * @{
+ */
+
+/**
+ * @def CRASH_EVENTS_COUNT
+ * @brief This macro defines the number of the last events kept in the crash record (a power of two)
+ */
+#define CRASH_EVENTS_COUNT (16)
+
+/**
+ * @def CRASH_STACK_WORDS
+ * @brief This macro defines the number of the stack words above the exception frame kept in the crash record
+ */
+#define CRASH_STACK_WORDS (16)
+
+/**
+ * @def CRASH_LOG_TRACE
+ * @brief This macro defines whether each trace write (trace_printf(), trace_puts(), ...) is logged as an event
+ * @details The options are:
+ * 	- TRUE: The trace writes are logged, the code of their events packs the first 4 characters of the text
+ * 	- FALSE: Only the events of CRASH_vLogEvent() are logged
+ * @note The trace writes exist only when the TRACE macro is defined
+ */
+#define CRASH_LOG_TRACE (TRUE)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _CRASH_CONFIG_H_ */
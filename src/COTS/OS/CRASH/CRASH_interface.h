@@ -0,0 +1,145 @@
+/**
+ * @file CRASH_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the CRASH module.
+ * @details This file contains the prototypes of the functions of the CRASH module.
+ * @date 2026-10-19
+ */
+
+#ifndef _CRASH_INTERFACE_H_
+#define _CRASH_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../MCAL/NVIC/NVIC_interface.h"
+#include "CRASH_config.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup crash_module
+ * @{
+ */
+
+/**
+ * @def CRASH_FRAME_WORDS
+ * @brief The number of the words stacked by the core on an exception entry (R0-R3, R12, LR, PC, xPSR)
+ */
+#define CRASH_FRAME_WORDS (8)
+
+/**
+ * @struct t_CRASH_Event
+ * @brief CRASH Event
+ * @details This type is used to keep an event of the log
+ * @see CRASH_vLogEvent
+ */
+typedef struct
+{
+	/**
+	 * @brief The cycle counter when the event was logged (0 if the DWT cycle counter is not running)
+	 */
+	t_u32 u32Cycles;
+	/**
+	 * @brief The code of the event, its meaning is up to the application (or the first characters of a trace write)
+	 */
+	t_u32 u32Code;
+} t_CRASH_Event;
+
+/**
+ * @struct t_CRASH_Record
+ * @brief CRASH Record
+ * @details This type is used to keep the state of the core at a fault, it survives the following reset in the `.noinit` RAM
+ */
+typedef struct
+{
+	/**
+	 * @brief The mark of a written record
+	 */
+	t_u32 u32Magic;
+	/**
+	 * @brief The number of the fault exception (3 HardFault, 4 MemManage, 5 BusFault, 6 UsageFault)
+	 */
+	t_u32 u32Exception;
+	/**
+	 * @brief The exception frame: R0, R1, R2, R3, R12, LR, PC (the faulting instruction in most cases) and xPSR
+	 */
+	t_u32 au32Frame[CRASH_FRAME_WORDS];
+	/**
+	 * @brief The EXC_RETURN value of the fault, bit 2 tells whether the faulting code used the process stack
+	 */
+	t_u32 u32ExcReturn;
+	/**
+	 * @brief The address of the exception frame (the stack pointer of the faulting code)
+	 */
+	t_u32 u32StackPointer;
+	/**
+	 * @brief The fault status and address registers
+	 */
+	t_NVIC_FaultStatus tFault;
+	/**
+	 * @brief The stack words above the exception frame (0 when out of the SRAM)
+	 */
+	t_u32 au32Stack[CRASH_STACK_WORDS];
+	/**
+	 * @brief The number of the valid events
+	 */
+	t_u32 u32EventsCount;
+	/**
+	 * @brief The last events, the oldest first
+	 */
+	t_CRASH_Event atEvents[CRASH_EVENTS_COUNT];
+	/**
+	 * @brief The checksum of all the previous words
+	 */
+	t_u32 u32Checksum;
+} t_CRASH_Record;
+
+/**
+ * @brief This function handles the record of the previous run and starts a new event log
+ * @details A valid record is printed through the trace and cleared, so the call must come after CRASH_bGetRecord() if the
+ * application forwards the record elsewhere
+ */
+void CRASH_vInit(void);
+
+/**
+ * @brief This function adds an event to the log copied in the next crash record
+ * @param[in] u32Code The code of the event
+ * @note This function can be called from an interrupt, it takes a few cycles
+ */
+void CRASH_vLogEvent(t_u32 u32Code);
+
+/**
+ * @brief This function adds a trace write to the log copied in the next crash record
+ * @details This function is called by trace_write() of the trace support, so the last trace messages end up in the
+ * record. The code of the event packs the first 4 characters of the text, the first one in the low byte
+ * @param[in] pcText The written text (not null terminated)
+ * @param[in] u32Length The number of the characters
+ * @note This function does nothing if CRASH_LOG_TRACE is FALSE
+ * @see CRASH_LOG_TRACE
+ */
+void CRASH_vLogTrace(P2CONST(char) pcText, t_u32 u32Length);
+
+/**
+ * @brief This function gets the crash record of the previous run
+ * @param[out] ptRecord The crash record
+ * @return TRUE if the previous run ended with a fault and its record is intact, FALSE otherwise
+ */
+t_bool CRASH_bGetRecord(P2VAR(t_CRASH_Record) ptRecord);
+
+/**
+ * @brief This function writes the crash record of a fault and resets the core
+ * @details This function is called by the fault handlers of the startup code, it only touches the SRAM and the core
+ * registers so it works whatever the state of the peripherals
+ * @param[in] pu32Frame The exception frame stacked by the core
+ * @param[in] u32ExcReturn The EXC_RETURN value of the fault (LR on the handler entry)
+ */
+void CRASH_vRecordFault(P2CONST(t_u32) pu32Frame, t_u32 u32ExcReturn);
+
+/** @} */
+/** @} */
+
+#endif /* _CRASH_INTERFACE_H_ */
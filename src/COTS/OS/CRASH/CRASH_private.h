@@ -0,0 +1,74 @@
+/**
+ * @file CRASH_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros for the CRASH module.
+ * @details This file contains the private macros for the CRASH module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir OS/CRASH
+ * @brief CRASH Module
+ * @details This module contains all the APIs related to the post-mortem crash records
+ */
+
+#ifndef _CRASH_PRIVATE_H_
+#define _CRASH_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @defgroup crash_module CRASH Module
+ * @brief CRASH Module
+ * @details This module contains all the APIs related to the post-mortem crash records
+ * @{
+ */
+
+/**
+ * @defgroup crash_constants CRASH Constants
+ * @brief CRASH Constants
+ * @{
+ */
+
+/**
+ * @def CRASH_RECORD_MAGIC
+ * @brief The first word of a written crash record, the `.noinit` RAM holds random words after a power-on
+ */
+#define CRASH_RECORD_MAGIC ((t_u32)0xC7A5D00DU)
+
+/**
+ * @def CRASH_SRAM_BASE
+ * @brief The lowest address of the SRAM, a stack pointer below it cannot be read
+ */
+#define CRASH_SRAM_BASE ((t_u32)0x20000000U)
+
+/**
+ * @def CRASH_EVENTS_MASK
+ * @brief The mask of the index of the event log
+ */
+#define CRASH_EVENTS_MASK ((t_u32)CRASH_EVENTS_COUNT - 1U)
+
+/** @} */
+
+/**
+ * @defgroup crash_linker_symbols CRASH Linker Symbols
+ * @brief The symbols defined by the linker script
+ * @{
+ */
+
+/**
+ * @brief The address right after the top of the SRAM
+ */
+extern t_u32 _estack;
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _CRASH_PRIVATE_H_ */
@@ -0,0 +1,220 @@
+/**
+ * @file CRASH_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the CRASH module.
+ * @details This file contains the implementation for the CRASH module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../../MCAL/NVIC/NVIC_interface.h"
+#include "../../MCAL/DWT/DWT_interface.h"
+#include "diag/Trace.h"
+#include "CRASH_private.h"
+#include "CRASH_interface.h"
+#include "CRASH_config.h"
+
+STATIC_ASSERT(((CRASH_EVENTS_COUNT & (CRASH_EVENTS_COUNT - 1)) == 0) && (CRASH_EVENTS_COUNT > 0),
+			  "The number of the events must be a power of two");
+
+/**
+ * @brief The crash record, written by the fault handler and read at the next boot
+ */
+NOINIT STATIC t_CRASH_Record tCRASHRecord;
+
+/**
+ * @brief The live event log, the last events are copied to the record on a fault
+ */
+NOINIT STATIC t_CRASH_Event atCRASHEvents[CRASH_EVENTS_COUNT];
+
+/**
+ * @brief The number of the logged events since the boot (free running, its low bits index the log)
+ */
+NOINIT STATIC VOLATILE t_u32 u32CRASHEventsIndex;
+
+/**
+ * @brief This function computes the checksum of the crash record
+ * @param[in] ptRecord The crash record
+ * @return The checksum of all the words before the checksum member
+ */
+STATIC t_u32 CRASH_u32GetChecksum(P2CONST(t_CRASH_Record) ptRecord)
+{
+	P2CONST(t_u32) pu32Word = (P2CONST(t_u32))ptRecord;
+	t_u32 u32Checksum = CRASH_RECORD_MAGIC;
+	t_u32 u32Index = 0;
+
+	for (u32Index = 0; u32Index < ((sizeof(t_CRASH_Record) / sizeof(t_u32)) - 1U); u32Index++)
+	{
+		/* Rotate before mixing in so that swapped words change the result */
+		u32Checksum = ((u32Checksum << 5) | (u32Checksum >> 27)) ^ pu32Word[u32Index];
+	}
+
+	return u32Checksum;
+}
+
+/**
+ * @brief This function checks whether a range of words lies in the SRAM below the top of the stack
+ * @param[in] u32Address The address of the first word
+ * @param[in] u32Words The number of the words
+ * @return TRUE if all the words can be read, FALSE otherwise
+ */
+STATIC t_bool CRASH_bIsInStack(t_u32 u32Address, t_u32 u32Words)
+{
+	return ((u32Address & 3U) == 0U) && (u32Address >= CRASH_SRAM_BASE) && (u32Address <= (t_u32)&_estack) &&
+		   ((((t_u32)&_estack - u32Address) / sizeof(t_u32)) >= u32Words);
+}
+
+/**
+ * @brief This function gets a character of an event code for the report
+ * @param[in] u32Code The code of the event
+ * @param[in] u8Byte The index of the byte (0 for the low byte)
+ * @return The character, or a dot if it is not printable
+ */
+STATIC t_c8 CRASH_c8GetPrintable(t_u32 u32Code, t_u8 u8Byte)
+{
+	t_c8 c8Character = (t_c8)(u32Code >> (u8Byte * 8U));
+
+	return ((c8Character >= (t_c8)' ') && (c8Character <= (t_c8)'~')) ? c8Character : (t_c8)'.';
+}
+
+void CRASH_vInit(void)
+{
+	t_CRASH_Record tRecord;
+	t_u32 u32Index = 0;
+
+	if (CRASH_bGetRecord(&tRecord) == TRUE)
+	{
+		trace_printf("crash: exception %lu, pc 0x%08lx, lr 0x%08lx, psr 0x%08lx, sp 0x%08lx, exc_return 0x%08lx\n",
+					 (unsigned long)tRecord.u32Exception, (unsigned long)tRecord.au32Frame[6],
+					 (unsigned long)tRecord.au32Frame[5], (unsigned long)tRecord.au32Frame[7],
+					 (unsigned long)tRecord.u32StackPointer, (unsigned long)tRecord.u32ExcReturn);
+		trace_printf("crash: r0 0x%08lx, r1 0x%08lx, r2 0x%08lx, r3 0x%08lx, r12 0x%08lx\n",
+					 (unsigned long)tRecord.au32Frame[0], (unsigned long)tRecord.au32Frame[1],
+					 (unsigned long)tRecord.au32Frame[2], (unsigned long)tRecord.au32Frame[3],
+					 (unsigned long)tRecord.au32Frame[4]);
+		trace_printf("crash: cfsr 0x%08lx, hfsr 0x%08lx, mmfar 0x%08lx, bfar 0x%08lx\n",
+					 (unsigned long)tRecord.tFault.u32CFSR, (unsigned long)tRecord.tFault.u32HFSR,
+					 (unsigned long)tRecord.tFault.u32MMFAR, (unsigned long)tRecord.tFault.u32BFAR);
+
+		for (u32Index = 0; u32Index < CRASH_STACK_WORDS; u32Index++)
+		{
+			trace_printf("crash: stack[%2lu] 0x%08lx\n", (unsigned long)u32Index, (unsigned long)tRecord.au32Stack[u32Index]);
+		}
+
+		/* The characters show the text of the trace writes, the bytes that are not printable are dots */
+		for (u32Index = 0; u32Index < tRecord.u32EventsCount; u32Index++)
+		{
+			trace_printf("crash: event %10lu 0x%08lx %c%c%c%c\n", (unsigned long)tRecord.atEvents[u32Index].u32Cycles,
+						 (unsigned long)tRecord.atEvents[u32Index].u32Code, CRASH_c8GetPrintable(tRecord.atEvents[u32Index].u32Code, 0U),
+						 CRASH_c8GetPrintable(tRecord.atEvents[u32Index].u32Code, 1U), CRASH_c8GetPrintable(tRecord.atEvents[u32Index].u32Code, 2U),
+						 CRASH_c8GetPrintable(tRecord.atEvents[u32Index].u32Code, 3U));
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* A record is reported once, the next boot after a clean reset must not see it again */
+	tCRASHRecord.u32Magic = 0U;
+	u32CRASHEventsIndex = 0U;
+}
+
+void CRASH_vLogEvent(t_u32 u32Code)
+{
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+	t_u32 u32Index = u32CRASHEventsIndex & CRASH_EVENTS_MASK;
+
+	atCRASHEvents[u32Index].u32Cycles = DWT_u32GetCycleCount();
+	atCRASHEvents[u32Index].u32Code = u32Code;
+	u32CRASHEventsIndex++;
+
+	CPU_vExitCritical(u32PRIMASK);
+}
+
+void CRASH_vLogTrace(P2CONST(char) pcText, t_u32 u32Length)
+{
+	t_u32 u32Code = 0;
+	t_u32 u32Index = 0;
+
+	if (CRASH_LOG_TRACE == TRUE)
+	{
+		/* The code packs the first characters of the text, the first one in the low byte */
+		for (u32Index = 0; (u32Index < sizeof(t_u32)) && (u32Index < u32Length); u32Index++)
+		{
+			u32Code |= (t_u32)(t_u8)pcText[u32Index] << (u32Index * 8U);
+		}
+
+		CRASH_vLogEvent(u32Code);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool CRASH_bGetRecord(P2VAR(t_CRASH_Record) ptRecord)
+{
+	t_bool bResult = FALSE;
+
+	if ((tCRASHRecord.u32Magic == CRASH_RECORD_MAGIC) && (tCRASHRecord.u32EventsCount <= CRASH_EVENTS_COUNT) &&
+		(tCRASHRecord.u32Checksum == CRASH_u32GetChecksum(&tCRASHRecord)))
+	{
+		*ptRecord = tCRASHRecord;
+		bResult = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bResult;
+}
+
+void CRASH_vRecordFault(P2CONST(t_u32) pu32Frame, t_u32 u32ExcReturn)
+{
+	t_u32 u32Index = 0;
+	t_u32 u32Events = u32CRASHEventsIndex;
+
+	CPU_DISABLE_IRQ();
+
+	tCRASHRecord.u32Magic = CRASH_RECORD_MAGIC;
+	tCRASHRecord.u32Exception = NVIC_u16GetActiveException();
+	tCRASHRecord.u32ExcReturn = u32ExcReturn;
+	tCRASHRecord.u32StackPointer = (t_u32)pu32Frame;
+	NVIC_vGetFaultStatus(&tCRASHRecord.tFault);
+
+	/* A corrupted stack pointer is likely the cause of the fault, so nothing is read outside the SRAM */
+	for (u32Index = 0; u32Index < CRASH_FRAME_WORDS; u32Index++)
+	{
+		tCRASHRecord.au32Frame[u32Index] = CRASH_bIsInStack((t_u32)&pu32Frame[u32Index], 1U) ? pu32Frame[u32Index] : 0U;
+	}
+
+	for (u32Index = 0; u32Index < CRASH_STACK_WORDS; u32Index++)
+	{
+		tCRASHRecord.au32Stack[u32Index] =
+			CRASH_bIsInStack((t_u32)&pu32Frame[CRASH_FRAME_WORDS + u32Index], 1U) ? pu32Frame[CRASH_FRAME_WORDS + u32Index] : 0U;
+	}
+
+	/* Copy the last events the oldest first, the log may not have wrapped yet */
+	tCRASHRecord.u32EventsCount = (u32Events < CRASH_EVENTS_COUNT) ? u32Events : CRASH_EVENTS_COUNT;
+
+	for (u32Index = 0; u32Index < tCRASHRecord.u32EventsCount; u32Index++)
+	{
+		tCRASHRecord.atEvents[u32Index] = atCRASHEvents[(u32Events - tCRASHRecord.u32EventsCount + u32Index) & CRASH_EVENTS_MASK];
+	}
+
+	for (; u32Index < CRASH_EVENTS_COUNT; u32Index++)
+	{
+		tCRASHRecord.atEvents[u32Index].u32Cycles = 0U;
+		tCRASHRecord.atEvents[u32Index].u32Code = 0U;
+	}
+
+	tCRASHRecord.u32Checksum = CRASH_u32GetChecksum(&tCRASHRecord);
+
+	NVIC_vSystemReset();
+}
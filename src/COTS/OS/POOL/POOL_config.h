@@ -0,0 +1,85 @@
+/**
+ * @file POOL_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the POOL module.
+ * @details This file contains the configuration parameters for the POOL module.
+ * @date 2026-10-19
+ */
+
+#ifndef _POOL_CONFIG_H_
+#define _POOL_CONFIG_H_
+
+#include "POOL_interface.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup pool_module
+ * @{
+ */
+
+/**
+ * @defgroup pool_config POOL Configuration
+ * @brief This group contains the configuration parameters of the POOL module
+ * @details The classes must be sorted by increasing block size, the sizes must be multiples of 8 and a class of 0 blocks is unused.
+ * The default classes take 2 KB of RAM
+ * @{
+ */
+
+/**
+ * @def POOL_CLASS0_SIZE
+ * @brief This macro defines the number of the bytes of a block of the class 0
+ */
+#define POOL_CLASS0_SIZE (16U)
+
+/**
+ * @def POOL_CLASS0_BLOCKS
+ * @brief This macro defines the number of the blocks of the class 0
+ */
+#define POOL_CLASS0_BLOCKS (32U)
+
+/**
+ * @def POOL_CLASS1_SIZE
+ * @brief This macro defines the number of the bytes of a block of the class 1
+ */
+#define POOL_CLASS1_SIZE (32U)
+
+/**
+ * @def POOL_CLASS1_BLOCKS
+ * @brief This macro defines the number of the blocks of the class 1
+ */
+#define POOL_CLASS1_BLOCKS (16U)
+
+/**
+ * @def POOL_CLASS2_SIZE
+ * @brief This macro defines the number of the bytes of a block of the class 2
+ */
+#define POOL_CLASS2_SIZE (64U)
+
+/**
+ * @def POOL_CLASS2_BLOCKS
+ * @brief This macro defines the number of the blocks of the class 2
+ */
+#define POOL_CLASS2_BLOCKS (8U)
+
+/**
+ * @def POOL_CLASS3_SIZE
+ * @brief This macro defines the number of the bytes of a block of the class 3
+ */
+#define POOL_CLASS3_SIZE (256U)
+
+/**
+ * @def POOL_CLASS3_BLOCKS
+ * @brief This macro defines the number of the blocks of the class 3
+ */
+#define POOL_CLASS3_BLOCKS (2U)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _POOL_CONFIG_H_ */
@@ -0,0 +1,97 @@
+/**
+ * @file POOL_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the POOL module.
+ * @details This file contains the prototypes of the functions of the POOL module.
+ * @date 2026-10-19
+ */
+
+#ifndef _POOL_INTERFACE_H_
+#define _POOL_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup pool_module
+ * @{
+ */
+
+/**
+ * @def POOL_CLASSES_COUNT
+ * @brief The number of the block size classes
+ */
+#define POOL_CLASSES_COUNT (4U)
+
+/**
+ * @struct t_POOL_Stats
+ * @brief POOL Class Statistics
+ * @details This type is used to report the use of a class, the high-water mark tells how many blocks the class really needs
+ */
+typedef struct
+{
+	/**
+	 * @brief The number of the bytes of a block
+	 */
+	t_u16 u16BlockSize;
+	/**
+	 * @brief The number of the blocks of the class
+	 */
+	t_u16 u16Blocks;
+	/**
+	 * @brief The number of the allocated blocks
+	 */
+	t_u16 u16Used;
+	/**
+	 * @brief The largest number of the blocks allocated at the same time since the initialization
+	 */
+	t_u16 u16MaxUsed;
+	/**
+	 * @brief The number of the requests of this class size that found no free block in this class
+	 */
+	t_u32 u32Failures;
+} t_POOL_Stats;
+
+/**
+ * @brief This function initializes the pools
+ * @details This function links all the blocks of each class in its free list, all the allocated blocks are lost
+ */
+void POOL_vInit(void);
+
+/**
+ * @brief This function allocates a block
+ * @details The block comes from the smallest class that fits the size, or from the next larger class if that one is empty.
+ * The time does not depend on the number of the blocks
+ * @param[in] u32Size The number of the needed bytes
+ * @return The block (aligned to 8 bytes), NULL if no class that fits the size has a free block
+ * @note This function can be called from an interrupt
+ */
+P2VAR(void) POOL_pvAllocate(t_u32 u32Size);
+
+/**
+ * @brief This function frees a block
+ * @param[in] pvBlock The block returned by POOL_pvAllocate()
+ * @return TRUE if the block is freed, FALSE if it does not start a block of the pools
+ * @note This function can be called from an interrupt
+ */
+t_bool POOL_bFree(P2VAR(void) pvBlock);
+
+/**
+ * @brief This function gets the statistics of a class
+ * @param[in] u8Class The class (0 to POOL_CLASSES_COUNT - 1)
+ * @param[out] ptStats The statistics of the class
+ * @return TRUE if the class exists, FALSE otherwise
+ * @see t_POOL_Stats
+ */
+t_bool POOL_bGetStats(t_u8 u8Class, P2VAR(t_POOL_Stats) ptStats);
+
+/** @} */
+/** @} */
+
+#endif /* _POOL_INTERFACE_H_ */
@@ -0,0 +1,78 @@
+/**
+ * @file POOL_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros for the POOL module.
+ * @details This file contains the private macros for the POOL module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir OS/POOL
+ * @brief POOL Module
+ * @details This module contains all the APIs related to the fixed-block memory pools
+ */
+
+#ifndef _POOL_PRIVATE_H_
+#define _POOL_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @defgroup pool_module POOL Module
+ * @brief POOL Module
+ * @details This module contains all the APIs related to the fixed-block memory pools
+ * @{
+ */
+
+/**
+ * @defgroup pool_types POOL Types
+ * @brief POOL Types
+ * @{
+ */
+
+/**
+ * @struct t_POOL_Block
+ * @brief POOL Free Block
+ * @details This type is used to link the free blocks of a class, the link is kept in the first word of the free block itself
+ */
+typedef struct t_POOL_Block_Tag
+{
+	/**
+	 * @brief The next free block of the class
+	 */
+	struct t_POOL_Block_Tag *ptNext;
+} t_POOL_Block;
+
+/** @} */
+
+/**
+ * @defgroup pool_constants POOL Constants
+ * @brief POOL Constants
+ * @{
+ */
+
+/**
+ * @def POOL_BLOCK_ALIGNMENT
+ * @brief The alignment of the blocks in bytes (the block sizes must be multiples of it)
+ */
+#define POOL_BLOCK_ALIGNMENT (8U)
+
+/**
+ * @def POOL_ARENA_BYTES
+ * @brief The number of the bytes of the storage of all the classes
+ */
+#define POOL_ARENA_BYTES ((POOL_CLASS0_SIZE * POOL_CLASS0_BLOCKS) + (POOL_CLASS1_SIZE * POOL_CLASS1_BLOCKS) + \
+						  (POOL_CLASS2_SIZE * POOL_CLASS2_BLOCKS) + (POOL_CLASS3_SIZE * POOL_CLASS3_BLOCKS))
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _POOL_PRIVATE_H_ */
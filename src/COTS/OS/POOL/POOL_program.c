@@ -0,0 +1,215 @@
+/**
+ * @file POOL_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the POOL module.
+ * @details This file contains the implementation for the POOL module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "POOL_private.h"
+#include "POOL_interface.h"
+#include "POOL_config.h"
+
+STATIC_ASSERT(((POOL_CLASS0_SIZE % POOL_BLOCK_ALIGNMENT) == 0U) && ((POOL_CLASS1_SIZE % POOL_BLOCK_ALIGNMENT) == 0U) &&
+				  ((POOL_CLASS2_SIZE % POOL_BLOCK_ALIGNMENT) == 0U) && ((POOL_CLASS3_SIZE % POOL_BLOCK_ALIGNMENT) == 0U),
+			  "The block sizes must be multiples of 8 bytes");
+STATIC_ASSERT((POOL_CLASS0_SIZE <= POOL_CLASS1_SIZE) && (POOL_CLASS1_SIZE <= POOL_CLASS2_SIZE) && (POOL_CLASS2_SIZE <= POOL_CLASS3_SIZE),
+			  "The classes must be sorted by increasing block size");
+
+/**
+ * @brief The storage of the blocks of all the classes, one class after the other
+ */
+STATIC t_u8 au8POOLArena[POOL_ARENA_BYTES] ALIGNED(POOL_BLOCK_ALIGNMENT);
+
+/**
+ * @brief The number of the bytes of a block of each class
+ */
+STATIC CONST t_u16 au16POOLBlockSizes[POOL_CLASSES_COUNT] = {POOL_CLASS0_SIZE, POOL_CLASS1_SIZE, POOL_CLASS2_SIZE, POOL_CLASS3_SIZE};
+
+/**
+ * @brief The number of the blocks of each class
+ */
+STATIC CONST t_u16 au16POOLBlocks[POOL_CLASSES_COUNT] = {POOL_CLASS0_BLOCKS, POOL_CLASS1_BLOCKS, POOL_CLASS2_BLOCKS, POOL_CLASS3_BLOCKS};
+
+/**
+ * @brief The first block of each class
+ */
+STATIC P2VAR(t_u8) apu8POOLStarts[POOL_CLASSES_COUNT] = {NULL};
+
+/**
+ * @brief The free lists of the classes
+ */
+STATIC P2VAR(t_POOL_Block) aptPOOLFree[POOL_CLASSES_COUNT] = {NULL};
+
+/**
+ * @brief The number of the allocated blocks of each class
+ */
+STATIC t_u16 au16POOLUsed[POOL_CLASSES_COUNT] = {0};
+
+/**
+ * @brief The high-water marks of the classes
+ */
+STATIC t_u16 au16POOLMaxUsed[POOL_CLASSES_COUNT] = {0};
+
+/**
+ * @brief The number of the failed requests of each class
+ */
+STATIC t_u32 au32POOLFailures[POOL_CLASSES_COUNT] = {0};
+
+void POOL_vInit(void)
+{
+	P2VAR(t_u8) pu8Block = au8POOLArena;
+	t_u8 u8Class = 0;
+	t_u16 u16Block = 0;
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	for (u8Class = 0; u8Class < POOL_CLASSES_COUNT; u8Class++)
+	{
+		apu8POOLStarts[u8Class] = pu8Block;
+		aptPOOLFree[u8Class] = NULL;
+		au16POOLUsed[u8Class] = 0U;
+		au16POOLMaxUsed[u8Class] = 0U;
+		au32POOLFailures[u8Class] = 0U;
+
+		/* Link the blocks from the last one so that the first allocations take the lowest addresses */
+		for (u16Block = au16POOLBlocks[u8Class]; u16Block > 0U; u16Block--)
+		{
+			((P2VAR(t_POOL_Block))&pu8Block[(u16Block - 1U) * au16POOLBlockSizes[u8Class]])->ptNext = aptPOOLFree[u8Class];
+			aptPOOLFree[u8Class] = (P2VAR(t_POOL_Block))&pu8Block[(u16Block - 1U) * au16POOLBlockSizes[u8Class]];
+		}
+
+		pu8Block += (t_u32)au16POOLBlocks[u8Class] * au16POOLBlockSizes[u8Class];
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+}
+
+P2VAR(void) POOL_pvAllocate(t_u32 u32Size)
+{
+	P2VAR(t_POOL_Block) ptBlock = NULL;
+	t_u8 u8Class = 0;
+	t_u32 u32PRIMASK = 0;
+
+	/* Find the smallest class that fits the size */
+	while ((u8Class < POOL_CLASSES_COUNT) && ((au16POOLBlocks[u8Class] == 0U) || (au16POOLBlockSizes[u8Class] < u32Size)))
+	{
+		u8Class++;
+	}
+
+	u32PRIMASK = CPU_u32EnterCritical();
+
+	if ((u8Class < POOL_CLASSES_COUNT) && (aptPOOLFree[u8Class] == NULL))
+	{
+		au32POOLFailures[u8Class]++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	/* Fall back to the larger classes, the scan is bounded by the number of the classes */
+	while ((u8Class < POOL_CLASSES_COUNT) && (aptPOOLFree[u8Class] == NULL))
+	{
+		u8Class++;
+	}
+
+	if (u8Class < POOL_CLASSES_COUNT)
+	{
+		ptBlock = aptPOOLFree[u8Class];
+		aptPOOLFree[u8Class] = ptBlock->ptNext;
+		au16POOLUsed[u8Class]++;
+
+		if (au16POOLUsed[u8Class] > au16POOLMaxUsed[u8Class])
+		{
+			au16POOLMaxUsed[u8Class] = au16POOLUsed[u8Class];
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+
+	return (P2VAR(void))ptBlock;
+}
+
+t_bool POOL_bFree(P2VAR(void) pvBlock)
+{
+	P2VAR(t_u8) pu8Block = (P2VAR(t_u8))pvBlock;
+	t_bool bResult = FALSE;
+	t_u8 u8Class = 0;
+	t_u32 u32Offset = 0;
+	t_u32 u32PRIMASK = 0;
+
+	/* Find the class by the address, the classes follow each other in the arena */
+	while ((u8Class < POOL_CLASSES_COUNT) && ((pu8Block < apu8POOLStarts[u8Class]) ||
+											  (pu8Block >= &apu8POOLStarts[u8Class][(t_u32)au16POOLBlocks[u8Class] * au16POOLBlockSizes[u8Class]])))
+	{
+		u8Class++;
+	}
+
+	if (u8Class < POOL_CLASSES_COUNT)
+	{
+		u32Offset = (t_u32)(pu8Block - apu8POOLStarts[u8Class]);
+
+		if ((u32Offset % au16POOLBlockSizes[u8Class]) == 0U)
+		{
+			u32PRIMASK = CPU_u32EnterCritical();
+
+			((P2VAR(t_POOL_Block))pu8Block)->ptNext = aptPOOLFree[u8Class];
+			aptPOOLFree[u8Class] = (P2VAR(t_POOL_Block))pu8Block;
+			au16POOLUsed[u8Class]--;
+
+			CPU_vExitCritical(u32PRIMASK);
+
+			bResult = TRUE;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bResult;
+}
+
+t_bool POOL_bGetStats(t_u8 u8Class, P2VAR(t_POOL_Stats) ptStats)
+{
+	t_bool bResult = FALSE;
+	t_u32 u32PRIMASK = 0;
+
+	if (u8Class < POOL_CLASSES_COUNT)
+	{
+		u32PRIMASK = CPU_u32EnterCritical();
+
+		ptStats->u16BlockSize = au16POOLBlockSizes[u8Class];
+		ptStats->u16Blocks = au16POOLBlocks[u8Class];
+		ptStats->u16Used = au16POOLUsed[u8Class];
+		ptStats->u16MaxUsed = au16POOLMaxUsed[u8Class];
+		ptStats->u32Failures = au32POOLFailures[u8Class];
+
+		CPU_vExitCritical(u32PRIMASK);
+
+		bResult = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bResult;
+}
@@ -0,0 +1,75 @@
+/**
+ * @file RTOS_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the RTOS module.
+ * @details This file contains the configuration parameters for the RTOS module.
+ * @date 2026-10-19
+ */
+
+#ifndef _RTOS_CONFIG_H_
+#define _RTOS_CONFIG_H_
+
+#include "../../LIB/LSTD_VALUES.h"
+#include "RTOS_interface.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup rtos_module
+ * @{
+ */
+
+/**
+ * @defgroup rtos_config RTOS Configuration
+ * @brief This group contains the configuration parameters of the RTOS module
+ * @{
+ */
+
+/**
+ * @def RTOS_PRIORITIES_COUNT
+ * @brief This macro defines the number of the task priorities (2 to 32)
+ * @details Each priority holds at most one task and has one static task control block (24 bytes),
+ * the lowest priority is taken by the idle task
+ */
+#define RTOS_PRIORITIES_COUNT (16)
+
+/**
+ * @def RTOS_TICK_FREQUENCY
+ * @brief This macro defines the number of the kernel ticks per second
+ * @details The delays and the timeouts are expressed in ticks
+ */
+#define RTOS_TICK_FREQUENCY (1000)
+
+/**
+ * @def RTOS_KERNEL_PRIORITY
+ * @brief This macro defines the highest interrupt priority masked by the kernel (0 to 15)
+ * @details The kernel critical sections mask the interrupts of this priority value and above only. The interrupts of a lower
+ * value (higher priority) are never delayed by the kernel, which makes them suitable for the hard real-time work,
+ * but they must not call any kernel function
+ */
+#define RTOS_KERNEL_PRIORITY (5)
+
+/**
+ * @def RTOS_IDLE_STACK_WORDS
+ * @brief This macro defines the size of the stack of the idle task in words
+ */
+#define RTOS_IDLE_STACK_WORDS (64)
+
+/**
+ * @def RTOS_TICKLESS_IDLE
+ * @brief This macro defines whether the tick is stopped while all the tasks wait
+ * @details Options:
+ * 	- FALSE: The idle task sleeps and is woken up by every tick
+ * 	- TRUE: The idle task sleeps until the next delayed task is due or an interrupt happens
+ */
+#define RTOS_TICKLESS_IDLE (TRUE)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _RTOS_CONFIG_H_ */
@@ -0,0 +1,226 @@
+/**
+ * @file RTOS_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the RTOS module.
+ * @details This file contains the prototypes of the functions of the RTOS module.
+ * @date 2026-10-19
+ */
+
+#ifndef _RTOS_INTERFACE_H_
+#define _RTOS_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup rtos_module
+ * @{
+ */
+
+/**
+ * @def RTOS_WAIT_FOREVER
+ * @brief The timeout of a wait that never times out
+ */
+#define RTOS_WAIT_FOREVER ((t_u32)0xFFFFFFFFU)
+
+/**
+ * @def RTOS_STACK_DEFINE
+ * @brief Define the stack of a task
+ * @param[in] NAME The name of the stack array
+ * @param[in] WORDS The number of the 32-bit words of the stack
+ */
+#define RTOS_STACK_DEFINE(NAME, WORDS) STATIC t_u32 NAME[WORDS] ALIGNED(8)
+
+/**
+ * @def RTOS_SEMAPHORE_INIT
+ * @brief Initialize a semaphore
+ * @param[in] INITIAL The initial count
+ * @param[in] MAX The largest count (1 for a binary semaphore)
+ */
+#define RTOS_SEMAPHORE_INIT(INITIAL, MAX) {(t_u16)(INITIAL), (t_u16)(MAX), 0U}
+
+/**
+ * @def RTOS_QUEUE_DEFINE
+ * @brief Define a queue and its storage
+ * @param[in] NAME The name of the queue
+ * @param[in] ITEM_TYPE The type of the items
+ * @param[in] LENGTH The number of the items that the queue can hold
+ */
+#define RTOS_QUEUE_DEFINE(NAME, ITEM_TYPE, LENGTH) \
+	STATIC ITEM_TYPE NAME##Storage[LENGTH];        \
+	STATIC t_RTOS_Queue NAME = {(P2VAR(t_u8))NAME##Storage, (t_u16)sizeof(ITEM_TYPE), (t_u16)(LENGTH), 0U, 0U, 0U, 0U}
+
+/**
+ * @typedef t_RTOS_TaskFunction
+ * @brief RTOS Task Function
+ * @details This type is used to define the body of a task, returning from it deletes the task
+ */
+typedef P2FUNC(void, t_RTOS_TaskFunction)(P2VAR(void) pvArgument);
+
+/**
+ * @struct t_RTOS_Semaphore
+ * @brief RTOS Counting Semaphore
+ * @details This type is used to signal events between the tasks and from the interrupts to the tasks
+ * @see RTOS_SEMAPHORE_INIT
+ */
+typedef struct
+{
+	/**
+	 * @brief The number of the available signals
+	 */
+	t_u16 u16Count;
+	/**
+	 * @brief The largest number of the available signals
+	 */
+	t_u16 u16Max;
+	/**
+	 * @brief The priorities of the waiting tasks
+	 */
+	t_u32 u32Waiters;
+} t_RTOS_Semaphore;
+
+/**
+ * @struct t_RTOS_Queue
+ * @brief RTOS Message Queue
+ * @details This type is used to pass fixed size items by copy between the tasks and from the interrupts to the tasks
+ * @see RTOS_QUEUE_DEFINE
+ */
+typedef struct
+{
+	/**
+	 * @brief The storage of the items
+	 */
+	P2VAR(t_u8) pu8Buffer;
+	/**
+	 * @brief The size of an item in bytes
+	 */
+	t_u16 u16ItemSize;
+	/**
+	 * @brief The number of the items that the queue can hold
+	 */
+	t_u16 u16Length;
+	/**
+	 * @brief The index of the oldest item
+	 */
+	t_u16 u16Head;
+	/**
+	 * @brief The number of the items in the queue
+	 */
+	t_u16 u16Count;
+	/**
+	 * @brief The priorities of the tasks waiting for an item
+	 */
+	t_u32 u32Receivers;
+	/**
+	 * @brief The priorities of the tasks waiting for room
+	 */
+	t_u32 u32Senders;
+} t_RTOS_Queue;
+
+/**
+ * @brief This function initializes the kernel
+ * @details This function frees all the task control blocks, it must be called before creating the tasks
+ */
+void RTOS_vInit(void);
+
+/**
+ * @brief This function creates a task
+ * @param[in] u8Priority The priority of the task, lower values mean higher priority, each priority holds one task
+ * and the lowest one (RTOS_PRIORITIES_COUNT - 1) is taken by the idle task
+ * @param[in] pfTask The body of the task
+ * @param[in] pvArgument The argument passed to the body of the task
+ * @param[in] pu32Stack The stack of the task
+ * @param[in] u16StackWords The number of the words of the stack (at least 32)
+ * @return TRUE if the task is created, FALSE if the priority is invalid or taken or the stack is too small
+ * @note A task created after the start runs as soon as its priority is the highest ready one
+ * @note The stack is painted, STACK_bRegister() adds it to the stack report
+ * @see RTOS_STACK_DEFINE
+ */
+t_bool RTOS_bCreateTask(t_u8 u8Priority, t_RTOS_TaskFunction pfTask, P2VAR(void) pvArgument, P2VAR(t_u32) pu32Stack, t_u16 u16StackWords);
+
+/**
+ * @brief This function starts the kernel
+ * @details This function creates the idle task (registered as "idle" in the stack report), starts the tick and switches to
+ * the ready task of the highest priority. The stack of the caller is given back to the interrupts
+ * @note This function returns only if the tick frequency cannot be reached by the SysTick
+ * @see RTOS_TICK_FREQUENCY
+ */
+void RTOS_vStart(void);
+
+/**
+ * @brief This function gets the number of the ticks since the start of the kernel
+ * @return The number of the ticks (wraps around after 2^32 ticks)
+ */
+t_u32 RTOS_u32GetTicks(void);
+
+/**
+ * @brief This function gets the priority of the running task
+ * @return The priority of the running task
+ */
+t_u8 RTOS_u8GetCurrentPriority(void);
+
+/**
+ * @brief This function blocks the running task for a number of ticks
+ * @param[in] u32Ticks The number of the ticks, 0 does nothing
+ * @warning This function must not be called from an interrupt
+ */
+void RTOS_vDelay(t_u32 u32Ticks);
+
+/**
+ * @brief This function blocks the running task until the next period
+ * @details The releases are counted from the previous one, so a periodic task does not drift whatever its run time
+ * @param[in,out] pu32LastWake The tick of the previous release, initialized with RTOS_u32GetTicks() before the first call
+ * @param[in] u32Period The period in ticks
+ * @warning This function must not be called from an interrupt
+ */
+void RTOS_vDelayUntil(P2VAR(t_u32) pu32LastWake, t_u32 u32Period);
+
+/**
+ * @brief This function signals a semaphore
+ * @details The waiting task of the highest priority gets the signal directly, otherwise the count is incremented up to its maximum
+ * @param[in] ptSemaphore The semaphore
+ * @note This function can be called from an interrupt of a priority value greater than or equal to RTOS_KERNEL_PRIORITY
+ */
+void RTOS_vGiveSemaphore(P2VAR(t_RTOS_Semaphore) ptSemaphore);
+
+/**
+ * @brief This function waits for a semaphore signal
+ * @param[in] ptSemaphore The semaphore
+ * @param[in] u32Timeout The largest number of the ticks to wait, 0 to return at once or RTOS_WAIT_FOREVER
+ * @return TRUE if a signal is taken, FALSE if the timeout elapsed
+ * @note This function can be called from an interrupt with a timeout of 0
+ */
+t_bool RTOS_bTakeSemaphore(P2VAR(t_RTOS_Semaphore) ptSemaphore, t_u32 u32Timeout);
+
+/**
+ * @brief This function sends an item to a queue
+ * @details The item is copied directly to the waiting receiver of the highest priority if any
+ * @param[in] ptQueue The queue
+ * @param[in] pvItem The item
+ * @param[in] u32Timeout The largest number of the ticks to wait for room, 0 to return at once or RTOS_WAIT_FOREVER
+ * @return TRUE if the item is sent, FALSE if the timeout elapsed
+ * @note This function can be called from an interrupt with a timeout of 0
+ */
+t_bool RTOS_bSendQueue(P2VAR(t_RTOS_Queue) ptQueue, P2CONST(void) pvItem, t_u32 u32Timeout);
+
+/**
+ * @brief This function receives the oldest item of a queue
+ * @details The item of the waiting sender of the highest priority takes the freed room if any
+ * @param[in] ptQueue The queue
+ * @param[out] pvItem The received item
+ * @param[in] u32Timeout The largest number of the ticks to wait for an item, 0 to return at once or RTOS_WAIT_FOREVER
+ * @return TRUE if an item is received, FALSE if the timeout elapsed
+ * @note This function can be called from an interrupt with a timeout of 0
+ */
+t_bool RTOS_bReceiveQueue(P2VAR(t_RTOS_Queue) ptQueue, P2VAR(void) pvItem, t_u32 u32Timeout);
+
+/** @} */
+/** @} */
+
+#endif /* _RTOS_INTERFACE_H_ */
@@ -0,0 +1,188 @@
+/**
+ * @file RTOS_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private types and macros for the RTOS module.
+ * @details This file contains the private types and macros for the RTOS module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir OS/RTOS
+ * @brief RTOS Module
+ * @details This module contains all the APIs related to the preemptive kernel
+ */
+
+#ifndef _RTOS_PRIVATE_H_
+#define _RTOS_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @defgroup rtos_module RTOS Module
+ * @brief RTOS Module
+ * @details This module contains all the APIs related to the preemptive kernel
+ * @{
+ */
+
+/**
+ * @defgroup rtos_types RTOS Types
+ * @brief RTOS Types
+ * @{
+ */
+
+/**
+ * @struct t_RTOS_TCB
+ * @brief RTOS Task Control Block
+ * @details This type is used to keep the state of a task, there is one static block per priority
+ */
+typedef struct
+{
+	/**
+	 * @brief The saved stack pointer of the task
+	 * @warning This member must stay the first one, the context switch accesses it at offset 0
+	 */
+	P2VAR(t_u32) pu32StackPointer;
+	/**
+	 * @brief The lowest address of the stack of the task
+	 */
+	P2VAR(t_u32) pu32StackBase;
+	/**
+	 * @brief The number of the words of the stack of the task
+	 */
+	t_u16 u16StackWords;
+	/**
+	 * @brief The state of the task
+	 */
+	t_u8 u8State;
+	/**
+	 * @brief TRUE if the last wait of the task ended by its timeout
+	 */
+	t_bool bTimedOut;
+	/**
+	 * @brief The tick at which the delayed task is released
+	 */
+	t_u32 u32WakeTick;
+	/**
+	 * @brief The waiters map of the object that the task waits for, NULL if it waits for no object
+	 */
+	P2VAR(t_u32) pu32WaitMap;
+	/**
+	 * @brief The item that the task sends or receives while it waits for a queue
+	 */
+	P2VAR(void) pvWaitData;
+} t_RTOS_TCB;
+
+/** @} */
+
+/**
+ * @defgroup rtos_constants RTOS Constants
+ * @brief RTOS Constants
+ * @{
+ */
+
+/**
+ * @def RTOS_PRIORITY_BIT
+ * @brief Get the bit of a priority in the ready and waiters maps
+ * @details The priority 0 is the most significant bit so that counting the leading zeros of a map gives its highest priority
+ * @param[in] PRIORITY The priority
+ */
+#define RTOS_PRIORITY_BIT(PRIORITY) ((t_u32)0x80000000U >> (PRIORITY))
+
+/**
+ * @def RTOS_IDLE_PRIORITY
+ * @brief The priority of the idle task (the lowest one)
+ */
+#define RTOS_IDLE_PRIORITY (RTOS_PRIORITIES_COUNT - 1)
+
+/**
+ * @def RTOS_KERNEL_BASEPRI
+ * @brief The BASEPRI value of the kernel critical sections (4 implemented priority bits)
+ */
+#define RTOS_KERNEL_BASEPRI ((t_u32)RTOS_KERNEL_PRIORITY << 4)
+
+/**
+ * @def RTOS_TASK_FREE
+ * @brief The state of a task control block that holds no task
+ */
+#define RTOS_TASK_FREE (0)
+
+/**
+ * @def RTOS_TASK_CREATED
+ * @brief The state of a task control block that holds a task
+ */
+#define RTOS_TASK_CREATED (1)
+
+/**
+ * @def RTOS_STACK_FRAME_WORDS
+ * @brief The number of the words saved on the stack of a switched out task (8 by the exception entry and r4 to r11)
+ */
+#define RTOS_STACK_FRAME_WORDS (16)
+
+/**
+ * @def RTOS_FRAME_R0
+ * @brief The index of r0 (the argument of the task) in the initial stack frame
+ */
+#define RTOS_FRAME_R0 (8)
+
+/**
+ * @def RTOS_FRAME_LR
+ * @brief The index of the link register (where the task returns to) in the initial stack frame
+ */
+#define RTOS_FRAME_LR (13)
+
+/**
+ * @def RTOS_FRAME_PC
+ * @brief The index of the program counter (the body of the task) in the initial stack frame
+ */
+#define RTOS_FRAME_PC (14)
+
+/**
+ * @def RTOS_FRAME_XPSR
+ * @brief The index of the xPSR in the initial stack frame
+ */
+#define RTOS_FRAME_XPSR (15)
+
+/**
+ * @def RTOS_STACK_MIN_WORDS
+ * @brief The smallest stack of a task, the initial frame and one exception frame
+ */
+#define RTOS_STACK_MIN_WORDS (32U)
+
+/**
+ * @def RTOS_PENDSV_PRIORITY
+ * @brief The priority of the context switch, the lowest one so that it never preempts an interrupt
+ */
+#define RTOS_PENDSV_PRIORITY (15)
+
+/**
+ * @def RTOS_INITIAL_XPSR
+ * @brief The xPSR of a new task (Thumb state)
+ */
+#define RTOS_INITIAL_XPSR ((t_u32)0x01000000U)
+
+/**
+ * @def RTOS_TICKLESS_MIN_TICKS
+ * @brief The shortest idle time worth stopping the tick for
+ */
+#define RTOS_TICKLESS_MIN_TICKS (2U)
+
+/**
+ * @def RTOS_TIME_REACHED
+ * @brief Check whether a tick count reached a certain tick, even if the tick counter wrapped around
+ * @param[in] NOW The current tick count
+ * @param[in] TICK The tick to check
+ */
+#define RTOS_TIME_REACHED(NOW, TICK) ((t_s32)((NOW) - (TICK)) >= 0)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _RTOS_PRIVATE_H_ */
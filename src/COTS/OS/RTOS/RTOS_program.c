@@ -0,0 +1,670 @@
+/**
+ * @file RTOS_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the RTOS module.
+ * @details This file contains the implementation for the RTOS module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "cortexm/ExceptionHandlers.h"
+#include "../../MCAL/NVIC/NVIC_interface.h"
+#include "../../MCAL/STK/STK_interface.h"
+#include "../STACK/STACK_interface.h"
+#include "RTOS_private.h"
+#include "RTOS_interface.h"
+#include "RTOS_config.h"
+
+STATIC_ASSERT((RTOS_PRIORITIES_COUNT >= 2) && (RTOS_PRIORITIES_COUNT <= 32), "RTOS_PRIORITIES_COUNT must be between 2 and 32");
+
+/**
+ * @brief The task control blocks, indexed by the priority
+ */
+STATIC t_RTOS_TCB atRTOSTasks[RTOS_PRIORITIES_COUNT];
+
+/**
+ * @brief The running task (written by the context switch only)
+ */
+STATIC P2VAR(t_RTOS_TCB) ptRTOSCurrentTCB USED = NULL;
+
+/**
+ * @brief The task to switch to on the next context switch
+ */
+STATIC P2VAR(t_RTOS_TCB) ptRTOSNextTCB USED = NULL;
+
+/**
+ * @brief The priorities of the ready tasks
+ */
+STATIC t_u32 u32RTOSReadyMap = 0;
+
+/**
+ * @brief The priorities of the tasks waiting for a tick
+ */
+STATIC t_u32 u32RTOSDelayedMap = 0;
+
+/**
+ * @brief The tick count
+ */
+STATIC VOLATILE t_u32 u32RTOSTicks = 0;
+
+/**
+ * @brief TRUE once the kernel switches the context
+ */
+STATIC t_bool bRTOSRunning = FALSE;
+
+/**
+ * @brief The stack of the idle task
+ */
+RTOS_STACK_DEFINE(au32RTOSIdleStack, RTOS_IDLE_STACK_WORDS);
+
+/**
+ * @brief This function selects the ready task of the highest priority and requests the context switch if needed
+ * @details The idle task is always ready, so the ready map is never empty
+ * @note This function must be called inside a kernel critical section, the switch happens once the section ends
+ */
+STATIC void RTOS_vSchedule(void)
+{
+	ptRTOSNextTCB = &atRTOSTasks[CPU_CLZ(u32RTOSReadyMap)];
+
+	if ((bRTOSRunning == TRUE) && (ptRTOSNextTCB != ptRTOSCurrentTCB))
+	{
+		NVIC_vSetPendingPendSV();
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function makes a waiting task ready
+ * @param[in] u8Priority The priority of the task
+ * @param[in] bTimedOut TRUE if the wait ended by its timeout
+ * @note This function must be called inside a kernel critical section
+ */
+STATIC void RTOS_vWake(t_u8 u8Priority, t_bool bTimedOut)
+{
+	P2VAR(t_RTOS_TCB) ptTask = &atRTOSTasks[u8Priority];
+
+	u32RTOSDelayedMap &= ~RTOS_PRIORITY_BIT(u8Priority);
+
+	if (ptTask->pu32WaitMap != NULL)
+	{
+		*ptTask->pu32WaitMap &= ~RTOS_PRIORITY_BIT(u8Priority);
+		ptTask->pu32WaitMap = NULL;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	ptTask->bTimedOut = bTimedOut;
+	u32RTOSReadyMap |= RTOS_PRIORITY_BIT(u8Priority);
+}
+
+/**
+ * @brief This function blocks the running task
+ * @param[in] pu32WaitMap The waiters map of the object to wait for, NULL to wait for the timeout only
+ * @param[in] pvWaitData The item sent or received through a queue
+ * @param[in] u32Timeout The number of the ticks to wait or RTOS_WAIT_FOREVER
+ * @note This function must be called inside a kernel critical section, the task is switched out once the section ends
+ */
+STATIC void RTOS_vBlock(P2VAR(t_u32) pu32WaitMap, P2VAR(void) pvWaitData, t_u32 u32Timeout)
+{
+	t_u8 u8Priority = (t_u8)(ptRTOSCurrentTCB - atRTOSTasks);
+
+	u32RTOSReadyMap &= ~RTOS_PRIORITY_BIT(u8Priority);
+	ptRTOSCurrentTCB->pu32WaitMap = pu32WaitMap;
+	ptRTOSCurrentTCB->pvWaitData = pvWaitData;
+	ptRTOSCurrentTCB->bTimedOut = FALSE;
+
+	if (pu32WaitMap != NULL)
+	{
+		*pu32WaitMap |= RTOS_PRIORITY_BIT(u8Priority);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (u32Timeout != RTOS_WAIT_FOREVER)
+	{
+		ptRTOSCurrentTCB->u32WakeTick = u32RTOSTicks + u32Timeout;
+		u32RTOSDelayedMap |= RTOS_PRIORITY_BIT(u8Priority);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	RTOS_vSchedule();
+}
+
+/**
+ * @brief This function copies an item
+ * @param[out] pu8Destination The destination
+ * @param[in] pu8Source The source
+ * @param[in] u16Size The number of the bytes
+ */
+STATIC void RTOS_vCopy(P2VAR(t_u8) pu8Destination, P2CONST(t_u8) pu8Source, t_u16 u16Size)
+{
+	t_u16 u16Index = 0;
+
+	for (u16Index = 0; u16Index < u16Size; u16Index++)
+	{
+		pu8Destination[u16Index] = pu8Source[u16Index];
+	}
+}
+
+/**
+ * @brief This function counts the elapsed ticks and releases the due tasks
+ * @details Only the delayed tasks are visited, in the order of their priority
+ * @param[in] u32Ticks The number of the elapsed ticks
+ * @note This function must be called inside a kernel critical section
+ */
+STATIC void RTOS_vAnnounceTicks(t_u32 u32Ticks)
+{
+	t_u32 u32Delayed = u32RTOSDelayedMap;
+	t_u8 u8Priority = 0;
+
+	u32RTOSTicks += u32Ticks;
+
+	while (u32Delayed != 0U)
+	{
+		u8Priority = CPU_CLZ(u32Delayed);
+		u32Delayed &= ~RTOS_PRIORITY_BIT(u8Priority);
+
+		if (RTOS_TIME_REACHED(u32RTOSTicks, atRTOSTasks[u8Priority].u32WakeTick))
+		{
+			RTOS_vWake(u8Priority, TRUE);
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	RTOS_vSchedule();
+}
+
+/**
+ * @brief This function counts a tick, it is the SysTick callback
+ */
+STATIC void RTOS_vTickHandler(void)
+{
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	RTOS_vAnnounceTicks(1U);
+	CPU_vSetBASEPRI(u32BASEPRI);
+}
+
+/**
+ * @brief This function gets the number of the ticks until the next delayed task is due
+ * @return The number of the ticks, limited by the longest sleep of the SysTick
+ */
+STATIC t_u32 RTOS_u32GetIdleTicks(void)
+{
+	t_u32 u32Idle = STK_u32GetMaxSleepTicks();
+	t_u32 u32Delayed = u32RTOSDelayedMap;
+	t_u32 u32Remaining = 0;
+	t_u8 u8Priority = 0;
+
+	while (u32Delayed != 0U)
+	{
+		u8Priority = CPU_CLZ(u32Delayed);
+		u32Delayed &= ~RTOS_PRIORITY_BIT(u8Priority);
+		u32Remaining = atRTOSTasks[u8Priority].u32WakeTick - u32RTOSTicks;
+
+		if ((t_s32)u32Remaining <= 0)
+		{
+			u32Idle = 0U;
+		}
+		else if (u32Remaining < u32Idle)
+		{
+			u32Idle = u32Remaining;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	return u32Idle;
+}
+
+/**
+ * @brief This function is the body of the idle task
+ * @details The check and the sleep are done with the interrupts disabled (PRIMASK) so that no task becomes ready
+ * in between, a pending interrupt still ends the sleep and is served once the interrupts are enabled again
+ * @param[in] pvArgument Not used
+ */
+STATIC void RTOS_vIdleTask(P2VAR(void) pvArgument)
+{
+	t_u32 u32PRIMASK = 0;
+	t_u32 u32Ticks = 0;
+
+	(void)pvArgument;
+
+	for (;;)
+	{
+		u32PRIMASK = CPU_u32EnterCritical();
+
+		if (u32RTOSReadyMap == RTOS_PRIORITY_BIT(RTOS_IDLE_PRIORITY))
+		{
+			u32Ticks = (RTOS_TICKLESS_IDLE == TRUE) ? RTOS_u32GetIdleTicks() : 0U;
+
+			if (u32Ticks >= RTOS_TICKLESS_MIN_TICKS)
+			{
+				RTOS_vAnnounceTicks(STK_u32SleepTicks(u32Ticks));
+			}
+			else
+			{
+				CPU_DSB();
+				CPU_WFI();
+			}
+		}
+		else
+		{
+			/* Do nothing, a task is about to be switched in */
+		}
+
+		CPU_vExitCritical(u32PRIMASK);
+	}
+}
+
+/**
+ * @brief This function deletes the running task, the tasks return to it
+ */
+STATIC void RTOS_vExitTask(void)
+{
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	ptRTOSCurrentTCB->u8State = RTOS_TASK_FREE;
+	u32RTOSReadyMap &= ~RTOS_PRIORITY_BIT(ptRTOSCurrentTCB - atRTOSTasks);
+	RTOS_vSchedule();
+	CPU_vSetBASEPRI(u32BASEPRI);
+
+	/* Never reached, the task is switched out for good */
+	for (;;)
+	{
+		/* Do nothing */
+	}
+}
+
+/**
+ * @brief This function fills a task control block and makes the task ready
+ * @details The stack is prepared as if the task was switched out right before its first instruction
+ * @param[in] u8Priority The priority of the task
+ * @param[in] pfTask The body of the task
+ * @param[in] pvArgument The argument of the task
+ * @param[in] pu32Stack The stack of the task
+ * @param[in] u16StackWords The number of the words of the stack
+ * @return TRUE if the task is created, FALSE if the priority is taken
+ */
+STATIC t_bool RTOS_bInitTask(t_u8 u8Priority, t_RTOS_TaskFunction pfTask, P2VAR(void) pvArgument, P2VAR(t_u32) pu32Stack, t_u16 u16StackWords)
+{
+	P2VAR(t_RTOS_TCB) ptTask = &atRTOSTasks[u8Priority];
+	P2VAR(t_u32) pu32Frame = NULL;
+	t_u8 u8Index = 0;
+	t_bool bStatus = FALSE;
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	if (ptTask->u8State == RTOS_TASK_FREE)
+	{
+		/* Paint the stack so that its high-water mark can be read by the STACK module */
+		STACK_vPaint(pu32Stack, u16StackWords);
+
+		/* The exception entry requires an 8-byte aligned stack */
+		pu32Frame = (P2VAR(t_u32))((t_u32)&pu32Stack[u16StackWords] & ~(t_u32)7U) - RTOS_STACK_FRAME_WORDS;
+
+		for (u8Index = 0; u8Index < RTOS_STACK_FRAME_WORDS; u8Index++)
+		{
+			pu32Frame[u8Index] = 0U;
+		}
+
+		pu32Frame[RTOS_FRAME_R0] = (t_u32)pvArgument;
+		pu32Frame[RTOS_FRAME_LR] = (t_u32)RTOS_vExitTask;
+		pu32Frame[RTOS_FRAME_PC] = (t_u32)pfTask & ~(t_u32)1U;
+		pu32Frame[RTOS_FRAME_XPSR] = RTOS_INITIAL_XPSR;
+
+		ptTask->pu32StackPointer = pu32Frame;
+		ptTask->pu32StackBase = pu32Stack;
+		ptTask->u16StackWords = u16StackWords;
+		ptTask->u8State = RTOS_TASK_CREATED;
+		ptTask->pu32WaitMap = NULL;
+		ptTask->pvWaitData = NULL;
+		u32RTOSReadyMap |= RTOS_PRIORITY_BIT(u8Priority);
+		RTOS_vSchedule();
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vSetBASEPRI(u32BASEPRI);
+
+	return bStatus;
+}
+
+void RTOS_vInit(void)
+{
+	t_u8 u8Priority = 0;
+
+	for (u8Priority = 0; u8Priority < RTOS_PRIORITIES_COUNT; u8Priority++)
+	{
+		atRTOSTasks[u8Priority].u8State = RTOS_TASK_FREE;
+	}
+
+	u32RTOSReadyMap = 0U;
+	u32RTOSDelayedMap = 0U;
+	bRTOSRunning = FALSE;
+}
+
+t_bool RTOS_bCreateTask(t_u8 u8Priority, t_RTOS_TaskFunction pfTask, P2VAR(void) pvArgument, P2VAR(t_u32) pu32Stack, t_u16 u16StackWords)
+{
+	t_bool bStatus = FALSE;
+
+	if ((u8Priority < RTOS_IDLE_PRIORITY) && (pfTask != NULL) && (u16StackWords >= RTOS_STACK_MIN_WORDS))
+	{
+		bStatus = RTOS_bInitTask(u8Priority, pfTask, pvArgument, pu32Stack, u16StackWords);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void RTOS_vStart(void)
+{
+	t_u32 u32BASEPRI = 0;
+
+	(void)RTOS_bInitTask(RTOS_IDLE_PRIORITY, RTOS_vIdleTask, NULL, au32RTOSIdleStack, RTOS_IDLE_STACK_WORDS);
+	(void)STACK_bRegister("idle", au32RTOSIdleStack, RTOS_IDLE_STACK_WORDS);
+	NVIC_vSetSystemHandlerPriority(NVIC_SystemHandlers_PendSV, RTOS_PENDSV_PRIORITY);
+	ptRTOSCurrentTCB = &atRTOSTasks[CPU_CLZ(u32RTOSReadyMap)];
+	ptRTOSNextTCB = ptRTOSCurrentTCB;
+
+	/* Keep the kernel interrupts masked until the first task runs, the supervisor call is not masked */
+	u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	if (STK_bStartPeriodic(RTOS_TICK_FREQUENCY, RTOS_vTickHandler) == TRUE)
+	{
+		bRTOSRunning = TRUE;
+		CPU_ENABLE_IRQ();
+		__asm volatile("svc 0" ::: "memory");
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vSetBASEPRI(u32BASEPRI);
+}
+
+t_u32 RTOS_u32GetTicks(void)
+{
+	return u32RTOSTicks;
+}
+
+t_u8 RTOS_u8GetCurrentPriority(void)
+{
+	return (t_u8)(ptRTOSCurrentTCB - atRTOSTasks);
+}
+
+void RTOS_vDelay(t_u32 u32Ticks)
+{
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	if (u32Ticks != 0U)
+	{
+		RTOS_vBlock(NULL, NULL, u32Ticks);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vSetBASEPRI(u32BASEPRI);
+}
+
+void RTOS_vDelayUntil(P2VAR(t_u32) pu32LastWake, t_u32 u32Period)
+{
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+	t_u32 u32Wait = 0;
+
+	*pu32LastWake += u32Period;
+	u32Wait = *pu32LastWake - u32RTOSTicks;
+
+	/* A late task runs again at once */
+	if ((t_s32)u32Wait > 0)
+	{
+		RTOS_vBlock(NULL, NULL, u32Wait);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vSetBASEPRI(u32BASEPRI);
+}
+
+void RTOS_vGiveSemaphore(P2VAR(t_RTOS_Semaphore) ptSemaphore)
+{
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	if (ptSemaphore->u32Waiters != 0U)
+	{
+		/* Hand the signal to the waiter of the highest priority */
+		RTOS_vWake(CPU_CLZ(ptSemaphore->u32Waiters), FALSE);
+		RTOS_vSchedule();
+	}
+	else if (ptSemaphore->u16Count < ptSemaphore->u16Max)
+	{
+		ptSemaphore->u16Count++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vSetBASEPRI(u32BASEPRI);
+}
+
+t_bool RTOS_bTakeSemaphore(P2VAR(t_RTOS_Semaphore) ptSemaphore, t_u32 u32Timeout)
+{
+	P2VAR(t_RTOS_TCB) ptTask = ptRTOSCurrentTCB;
+	t_bool bStatus = FALSE;
+	t_bool bWaited = FALSE;
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	if (ptSemaphore->u16Count != 0U)
+	{
+		ptSemaphore->u16Count--;
+		bStatus = TRUE;
+	}
+	else if (u32Timeout != 0U)
+	{
+		RTOS_vBlock(&ptSemaphore->u32Waiters, NULL, u32Timeout);
+		bWaited = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vSetBASEPRI(u32BASEPRI);
+
+	/* The task runs again once it got the signal or its timeout elapsed */
+	if (bWaited == TRUE)
+	{
+		bStatus = (ptTask->bTimedOut == TRUE) ? FALSE : TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+t_bool RTOS_bSendQueue(P2VAR(t_RTOS_Queue) ptQueue, P2CONST(void) pvItem, t_u32 u32Timeout)
+{
+	P2VAR(t_RTOS_TCB) ptTask = ptRTOSCurrentTCB;
+	t_bool bStatus = FALSE;
+	t_bool bWaited = FALSE;
+	t_u8 u8Priority = 0;
+	t_u16 u16Tail = 0;
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	if (ptQueue->u32Receivers != 0U)
+	{
+		/* Hand the item to the receiver of the highest priority */
+		u8Priority = CPU_CLZ(ptQueue->u32Receivers);
+		RTOS_vCopy((P2VAR(t_u8))atRTOSTasks[u8Priority].pvWaitData, (P2CONST(t_u8))pvItem, ptQueue->u16ItemSize);
+		RTOS_vWake(u8Priority, FALSE);
+		RTOS_vSchedule();
+		bStatus = TRUE;
+	}
+	else if (ptQueue->u16Count < ptQueue->u16Length)
+	{
+		u16Tail = (t_u16)((ptQueue->u16Head + ptQueue->u16Count) % ptQueue->u16Length);
+		RTOS_vCopy(&ptQueue->pu8Buffer[u16Tail * ptQueue->u16ItemSize], (P2CONST(t_u8))pvItem, ptQueue->u16ItemSize);
+		ptQueue->u16Count++;
+		bStatus = TRUE;
+	}
+	else if (u32Timeout != 0U)
+	{
+		RTOS_vBlock(&ptQueue->u32Senders, (P2VAR(void))pvItem, u32Timeout);
+		bWaited = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vSetBASEPRI(u32BASEPRI);
+
+	/* The task runs again once a receiver took its item or its timeout elapsed */
+	if (bWaited == TRUE)
+	{
+		bStatus = (ptTask->bTimedOut == TRUE) ? FALSE : TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+t_bool RTOS_bReceiveQueue(P2VAR(t_RTOS_Queue) ptQueue, P2VAR(void) pvItem, t_u32 u32Timeout)
+{
+	P2VAR(t_RTOS_TCB) ptTask = ptRTOSCurrentTCB;
+	t_bool bStatus = FALSE;
+	t_bool bWaited = FALSE;
+	t_u8 u8Priority = 0;
+	t_u16 u16Tail = 0;
+	t_u32 u32BASEPRI = CPU_u32RaiseBASEPRI(RTOS_KERNEL_BASEPRI);
+
+	if (ptQueue->u16Count != 0U)
+	{
+		RTOS_vCopy((P2VAR(t_u8))pvItem, &ptQueue->pu8Buffer[ptQueue->u16Head * ptQueue->u16ItemSize], ptQueue->u16ItemSize);
+		ptQueue->u16Head = (t_u16)((ptQueue->u16Head + 1U) % ptQueue->u16Length);
+		ptQueue->u16Count--;
+
+		/* The freed room goes to the sender of the highest priority */
+		if (ptQueue->u32Senders != 0U)
+		{
+			u8Priority = CPU_CLZ(ptQueue->u32Senders);
+			u16Tail = (t_u16)((ptQueue->u16Head + ptQueue->u16Count) % ptQueue->u16Length);
+			RTOS_vCopy(&ptQueue->pu8Buffer[u16Tail * ptQueue->u16ItemSize], (P2CONST(t_u8))atRTOSTasks[u8Priority].pvWaitData, ptQueue->u16ItemSize);
+			ptQueue->u16Count++;
+			RTOS_vWake(u8Priority, FALSE);
+			RTOS_vSchedule();
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		bStatus = TRUE;
+	}
+	else if (u32Timeout != 0U)
+	{
+		RTOS_vBlock(&ptQueue->u32Receivers, pvItem, u32Timeout);
+		bWaited = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vSetBASEPRI(u32BASEPRI);
+
+	/* The task runs again once a sender gave it an item or its timeout elapsed */
+	if (bWaited == TRUE)
+	{
+		bStatus = (ptTask->bTimedOut == TRUE) ? FALSE : TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+/**
+ * @brief Supervisor call handler, it starts the first task
+ * @details The main stack is reset to the top since the code that called RTOS_vStart() never runs again,
+ * then the first task is restored as if it was switched out and the handler returns to the thread mode on the process stack
+ */
+NAKED void SVC_Handler(void)
+{
+	__asm volatile(
+		"	ldr r0, =0xE000ED08		\n" /* VTOR */
+		"	ldr r0, [r0]			\n"
+		"	ldr r0, [r0]			\n" /* The initial main stack pointer */
+		"	msr msp, r0				\n"
+		"	ldr r3, =ptRTOSCurrentTCB	\n"
+		"	ldr r1, [r3]			\n"
+		"	ldr r0, [r1]			\n" /* The saved stack pointer of the task */
+		"	ldmia r0!, {r4-r11}		\n"
+		"	msr psp, r0				\n"
+		"	mov r0, #0				\n"
+		"	msr basepri, r0			\n"
+		"	mvn lr, #2				\n" /* EXC_RETURN: thread mode, process stack */
+		"	bx lr					\n"
+		"	.ltorg					\n");
+}
+
+/**
+ * @brief PendSV exception handler, it switches the context
+ * @details The exception entry already saved r0 to r3, r12, lr, pc and xPSR on the stack of the task, only r4 to r11
+ * are saved here. The switch costs about 40 cycles (12 cycles of entry, 12 instructions and 12 cycles of exit),
+ * that is 0.6 us at 72 MHz and 1.1 us at the 36 MHz of this board, less when the exception is tail-chained
+ */
+NAKED void PendSV_Handler(void)
+{
+	__asm volatile(
+		"	mrs r0, psp				\n"
+		"	ldr r3, =ptRTOSCurrentTCB	\n"
+		"	ldr r2, [r3]			\n"
+		"	stmdb r0!, {r4-r11}		\n"
+		"	str r0, [r2]			\n" /* Save the stack pointer of the switched out task */
+		"	ldr r1, =ptRTOSNextTCB	\n"
+		"	ldr r1, [r1]			\n"
+		"	str r1, [r3]			\n"
+		"	ldr r0, [r1]			\n" /* Restore the stack pointer of the switched in task */
+		"	ldmia r0!, {r4-r11}		\n"
+		"	msr psp, r0				\n"
+		"	bx lr					\n"
+		"	.ltorg					\n");
+}
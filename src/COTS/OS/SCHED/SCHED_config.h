@@ -0,0 +1,49 @@
+/**
+ * @file SCHED_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the SCHED module.
+ * @details This file contains the configuration parameters for the SCHED module.
+ * @date 2026-10-19
+ */
+
+#ifndef _SCHED_CONFIG_H_
+#define _SCHED_CONFIG_H_
+
+#include "SCHED_interface.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup sched_module
+ * @{
+ */
+
+/**
+ * @defgroup sched_config SCHED Configuration
+ * @brief This group contains the configuration parameters of the SCHED module
+ * @{
+ */
+
+/**
+ * @def SCHED_TASKS_MAX
+ * @brief This macro defines the size of the static task table
+ * @details Each entry costs about 40 bytes of RAM, the scan for the next task is linear in this size
+ */
+#define SCHED_TASKS_MAX (8)
+
+/**
+ * @def SCHED_TICK_FREQUENCY
+ * @brief This macro defines the number of the scheduler ticks per second
+ * @details The periods, offsets and deadlines of the tasks are expressed in ticks
+ */
+#define SCHED_TICK_FREQUENCY (1000)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _SCHED_CONFIG_H_ */
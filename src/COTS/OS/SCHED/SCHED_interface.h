@@ -0,0 +1,157 @@
+/**
+ * @file SCHED_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the SCHED module.
+ * @details This file contains the prototypes of the functions of the SCHED module.
+ * @date 2026-10-19
+ */
+
+#ifndef _SCHED_INTERFACE_H_
+#define _SCHED_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup sched_module
+ * @{
+ */
+
+/**
+ * @typedef t_SCHED_TaskFunction
+ * @brief SCHED Task Function
+ * @details This type is used to define the body of a task, it runs to completion on each release and must not block
+ */
+typedef P2FUNC(void, t_SCHED_TaskFunction)(void);
+
+/**
+ * @struct t_SCHED_Task
+ * @brief SCHED Task Descriptor
+ * @details This type is used to describe a task, the descriptors are meant to be constant tables of the applications
+ */
+typedef struct
+{
+	/**
+	 * @brief The body of the task
+	 */
+	t_SCHED_TaskFunction pfTask;
+	/**
+	 * @brief The number of the ticks between two releases, 0 for a task released by SCHED_vActivateTask() only
+	 */
+	t_u32 u32Period;
+	/**
+	 * @brief The number of the ticks from the start of the scheduler to the first release
+	 */
+	t_u32 u32Offset;
+	/**
+	 * @brief The number of the ticks from a release to the end of the run, 0 to use the period
+	 */
+	t_u32 u32Deadline;
+	/**
+	 * @brief The priority of the task, lower values mean higher priority (the order of addition breaks the ties)
+	 */
+	t_u8 u8Priority;
+	/**
+	 * @brief Unused, it completes the structure to a multiple of 4 bytes without any implicit padding
+	 */
+	t_u8 au8Reserved[3];
+} t_SCHED_Task;
+
+/**
+ * @struct t_SCHED_TaskStats
+ * @brief SCHED Task Statistics
+ * @details This type is used to report where the cycles of the CPU go, the cycles include the interrupts served while the task runs
+ */
+typedef struct
+{
+	/**
+	 * @brief The number of the completed runs
+	 */
+	t_u32 u32Runs;
+	/**
+	 * @brief The number of the runs that completed after their deadline or were skipped because the previous run was late
+	 */
+	t_u32 u32DeadlineMisses;
+	/**
+	 * @brief The number of the cycles of the last run
+	 */
+	t_u32 u32LastCycles;
+	/**
+	 * @brief The number of the cycles of the longest run
+	 */
+	t_u32 u32MaxCycles;
+	/**
+	 * @brief The number of the cycles of all the runs (wraps around after 2^32 cycles)
+	 */
+	t_u32 u32TotalCycles;
+} t_SCHED_TaskStats;
+
+/**
+ * @brief This function initializes the scheduler
+ * @details This function empties the task table and starts the DWT cycle counter used by the statistics
+ */
+void SCHED_vInit(void);
+
+/**
+ * @brief This function adds a task to the task table
+ * @param[in] ptTask The task descriptor, it must stay valid while the scheduler runs
+ * @param[out] pu8TaskId The identifier of the added task (can be NULL)
+ * @return TRUE if the task is added, FALSE if the task table is full or the task has no body
+ * @see t_SCHED_Task SCHED_TASKS_MAX
+ */
+t_bool SCHED_bAddTask(P2CONST(t_SCHED_Task) ptTask, P2VAR(t_u8) pu8TaskId);
+
+/**
+ * @brief This function releases a task now
+ * @details This function can be called from an interrupt, several activations before the task runs are served by as many runs
+ * @param[in] u8TaskId The identifier of the task
+ */
+void SCHED_vActivateTask(t_u8 u8TaskId);
+
+/**
+ * @brief This function starts the scheduler
+ * @details This function starts the tick and runs the released task of the highest priority, one run at a time.
+ * The core sleeps (WFI) whenever no task is released
+ * @note This function returns only if the tick frequency cannot be reached by the SysTick
+ * @see SCHED_TICK_FREQUENCY
+ */
+void SCHED_vStart(void);
+
+/**
+ * @brief This function gets the number of the ticks since the start of the scheduler
+ * @return The number of the ticks (wraps around after 2^32 ticks)
+ */
+t_u32 SCHED_u32GetTicks(void);
+
+/**
+ * @brief This function gets the statistics of a task
+ * @param[in] u8TaskId The identifier of the task
+ * @param[out] ptStats The statistics of the task since the last reset
+ * @return TRUE if the task exists, FALSE otherwise
+ * @see t_SCHED_TaskStats SCHED_vResetStats
+ */
+t_bool SCHED_bGetTaskStats(t_u8 u8TaskId, P2VAR(t_SCHED_TaskStats) ptStats);
+
+/**
+ * @brief This function gets the number of the ticks since the last reset of the statistics
+ * @details The load of a task is its total cycles divided by these ticks times the core cycles of one tick,
+ * the time left by all the tasks is spent sleeping
+ * @return The number of the ticks since the last reset of the statistics
+ */
+t_u32 SCHED_u32GetStatsTicks(void);
+
+/**
+ * @brief This function resets the statistics of all the tasks
+ */
+void SCHED_vResetStats(void);
+
+/** @} */
+/** @} */
+
+#endif /* _SCHED_INTERFACE_H_ */
@@ -0,0 +1,57 @@
+/**
+ * @file SCHED_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros for the SCHED module.
+ * @details This file contains the private macros for the SCHED module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir OS/SCHED
+ * @brief SCHED Module
+ * @details This module contains all the APIs related to the cooperative run-to-completion task scheduler
+ */
+
+#ifndef _SCHED_PRIVATE_H_
+#define _SCHED_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @defgroup sched_module SCHED Module
+ * @brief SCHED Module
+ * @details This module contains all the APIs related to the cooperative run-to-completion task scheduler
+ * @{
+ */
+
+/**
+ * @defgroup sched_constants SCHED Constants
+ * @brief SCHED Constants
+ * @{
+ */
+
+/**
+ * @def SCHED_NO_TASK
+ * @brief The task index returned when no task is released
+ */
+#define SCHED_NO_TASK (SCHED_TASKS_MAX)
+
+/**
+ * @def SCHED_TIME_REACHED
+ * @brief Check whether a tick count reached a certain tick, even if the tick counter wrapped around
+ * @param[in] NOW The current tick count
+ * @param[in] TICK The tick to check
+ */
+#define SCHED_TIME_REACHED(NOW, TICK) ((t_s32)((NOW) - (TICK)) >= 0)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _SCHED_PRIVATE_H_ */
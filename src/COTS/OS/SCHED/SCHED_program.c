@@ -0,0 +1,336 @@
+/**
+ * @file SCHED_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the SCHED module.
+ * @details This file contains the implementation for the SCHED module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../../MCAL/DWT/DWT_interface.h"
+#include "../../MCAL/STK/STK_interface.h"
+#include "SCHED_private.h"
+#include "SCHED_interface.h"
+#include "SCHED_config.h"
+
+/**
+ * @brief The descriptors of the tasks
+ */
+STATIC P2CONST(t_SCHED_Task) aptSCHEDTasks[SCHED_TASKS_MAX] = {NULL};
+
+/**
+ * @brief The number of the added tasks
+ */
+STATIC t_u8 u8SCHEDTasksCount = 0;
+
+/**
+ * @brief The ticks of the next periodic releases
+ */
+STATIC t_u32 au32SCHEDNextReleases[SCHED_TASKS_MAX] = {0};
+
+/**
+ * @brief The ticks of the pending releases, the deadlines are counted from them
+ */
+STATIC t_u32 au32SCHEDReleaseTicks[SCHED_TASKS_MAX] = {0};
+
+/**
+ * @brief The pending periodic releases
+ */
+STATIC t_bool abSCHEDReleased[SCHED_TASKS_MAX] = {FALSE};
+
+/**
+ * @brief The number of the activations of each task (written by SCHED_vActivateTask() only)
+ */
+STATIC VOLATILE t_u8 au8SCHEDActivations[SCHED_TASKS_MAX] = {0};
+
+/**
+ * @brief The number of the served activations of each task (written by the scheduler only)
+ */
+STATIC t_u8 au8SCHEDServedActivations[SCHED_TASKS_MAX] = {0};
+
+/**
+ * @brief The ticks of the last activations
+ */
+STATIC VOLATILE t_u32 au32SCHEDActivationTicks[SCHED_TASKS_MAX] = {0};
+
+/**
+ * @brief The total number of the activations, it tells the idle loop that a task was activated before sleeping
+ */
+STATIC VOLATILE t_u32 u32SCHEDActivations = 0;
+
+/**
+ * @brief The statistics of the tasks
+ */
+STATIC t_SCHED_TaskStats atSCHEDStats[SCHED_TASKS_MAX];
+
+/**
+ * @brief The tick count
+ */
+STATIC VOLATILE t_u32 u32SCHEDTicks = 0;
+
+/**
+ * @brief The tick of the last reset of the statistics
+ */
+STATIC t_u32 u32SCHEDStatsStartTick = 0;
+
+/**
+ * @brief This function counts the ticks, it is the SysTick callback
+ */
+STATIC void SCHED_vTickHandler(void)
+{
+	u32SCHEDTicks++;
+}
+
+/**
+ * @brief This function releases the due tasks and selects the task to run
+ * @details A periodic task that is due while its previous release did not run yet misses its deadline, the late release
+ * is kept and the next one is skipped so that the task does not run several times in a row to catch up
+ * @param[in] u32Now The current tick count
+ * @return The identifier of the released task of the highest priority, SCHED_NO_TASK if no task is released
+ */
+STATIC t_u8 SCHED_u8SelectTask(t_u32 u32Now)
+{
+	t_u8 u8Task = 0;
+	t_u8 u8Selected = SCHED_NO_TASK;
+	t_bool bReleased = FALSE;
+
+	for (u8Task = 0; u8Task < u8SCHEDTasksCount; u8Task++)
+	{
+		if ((aptSCHEDTasks[u8Task]->u32Period != 0U) && (SCHED_TIME_REACHED(u32Now, au32SCHEDNextReleases[u8Task])))
+		{
+			if (abSCHEDReleased[u8Task] == TRUE)
+			{
+				atSCHEDStats[u8Task].u32DeadlineMisses++;
+			}
+			else
+			{
+				abSCHEDReleased[u8Task] = TRUE;
+				au32SCHEDReleaseTicks[u8Task] = au32SCHEDNextReleases[u8Task];
+			}
+
+			au32SCHEDNextReleases[u8Task] += aptSCHEDTasks[u8Task]->u32Period;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		bReleased = ((abSCHEDReleased[u8Task] == TRUE) || (au8SCHEDActivations[u8Task] != au8SCHEDServedActivations[u8Task])) ? TRUE : FALSE;
+
+		if ((bReleased == TRUE) && ((u8Selected == SCHED_NO_TASK) || (aptSCHEDTasks[u8Task]->u8Priority < aptSCHEDTasks[u8Selected]->u8Priority)))
+		{
+			u8Selected = u8Task;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	return u8Selected;
+}
+
+/**
+ * @brief This function runs a released task once and updates its statistics
+ * @param[in] u8Task The identifier of the task
+ */
+STATIC void SCHED_vRunTask(t_u8 u8Task)
+{
+	P2CONST(t_SCHED_Task) ptTask = aptSCHEDTasks[u8Task];
+	P2VAR(t_SCHED_TaskStats) ptStats = &atSCHEDStats[u8Task];
+	t_u32 u32Deadline = (ptTask->u32Deadline != 0U) ? ptTask->u32Deadline : ptTask->u32Period;
+	t_u32 u32ReleaseTick = 0;
+	t_u32 u32Cycles = 0;
+
+	/* The periodic release is served first, then the activations */
+	if (abSCHEDReleased[u8Task] == TRUE)
+	{
+		abSCHEDReleased[u8Task] = FALSE;
+		u32ReleaseTick = au32SCHEDReleaseTicks[u8Task];
+	}
+	else
+	{
+		au8SCHEDServedActivations[u8Task]++;
+		u32ReleaseTick = au32SCHEDActivationTicks[u8Task];
+	}
+
+	u32Cycles = DWT_u32GetCycleCount();
+	ptTask->pfTask();
+	u32Cycles = DWT_u32GetCycleCount() - u32Cycles;
+
+	ptStats->u32Runs++;
+	ptStats->u32LastCycles = u32Cycles;
+	ptStats->u32TotalCycles += u32Cycles;
+
+	if (u32Cycles > ptStats->u32MaxCycles)
+	{
+		ptStats->u32MaxCycles = u32Cycles;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if ((u32Deadline != 0U) && ((u32SCHEDTicks - u32ReleaseTick) > u32Deadline))
+	{
+		ptStats->u32DeadlineMisses++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+void SCHED_vInit(void)
+{
+	u8SCHEDTasksCount = 0U;
+	DWT_vInit();
+	SCHED_vResetStats();
+}
+
+t_bool SCHED_bAddTask(P2CONST(t_SCHED_Task) ptTask, P2VAR(t_u8) pu8TaskId)
+{
+	t_bool bStatus = FALSE;
+
+	if ((u8SCHEDTasksCount < SCHED_TASKS_MAX) && (ptTask->pfTask != NULL))
+	{
+		aptSCHEDTasks[u8SCHEDTasksCount] = ptTask;
+		abSCHEDReleased[u8SCHEDTasksCount] = FALSE;
+		au8SCHEDServedActivations[u8SCHEDTasksCount] = au8SCHEDActivations[u8SCHEDTasksCount];
+
+		if (pu8TaskId != NULL)
+		{
+			*pu8TaskId = u8SCHEDTasksCount;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+
+		u8SCHEDTasksCount++;
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+void SCHED_vActivateTask(t_u8 u8TaskId)
+{
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	if (u8TaskId < u8SCHEDTasksCount)
+	{
+		au32SCHEDActivationTicks[u8TaskId] = u32SCHEDTicks;
+		au8SCHEDActivations[u8TaskId]++;
+		u32SCHEDActivations++;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+}
+
+void SCHED_vStart(void)
+{
+	t_u8 u8Task = 0;
+	t_u32 u32Now = 0;
+	t_u32 u32Activations = 0;
+	t_u32 u32PRIMASK = 0;
+
+	/* The first releases are counted from the current tick */
+	for (u8Task = 0; u8Task < u8SCHEDTasksCount; u8Task++)
+	{
+		au32SCHEDNextReleases[u8Task] = u32SCHEDTicks + aptSCHEDTasks[u8Task]->u32Offset;
+	}
+
+	u32SCHEDStatsStartTick = u32SCHEDTicks;
+
+	if (STK_bStartPeriodic(SCHED_TICK_FREQUENCY, SCHED_vTickHandler) == TRUE)
+	{
+		for (;;)
+		{
+			u32Activations = u32SCHEDActivations;
+			u32Now = u32SCHEDTicks;
+			u8Task = SCHED_u8SelectTask(u32Now);
+
+			if (u8Task != SCHED_NO_TASK)
+			{
+				SCHED_vRunTask(u8Task);
+			}
+			else
+			{
+				/* Sleep with the interrupts masked, a pending interrupt still wakes the core up and is served right after.
+				 * Nothing can be released unless a tick or an activation happened since the scan */
+				u32PRIMASK = CPU_u32EnterCritical();
+
+				if ((u32Now == u32SCHEDTicks) && (u32Activations == u32SCHEDActivations))
+				{
+					CPU_WFI();
+				}
+				else
+				{
+					/* Do nothing */
+				}
+
+				CPU_vExitCritical(u32PRIMASK);
+			}
+		}
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_u32 SCHED_u32GetTicks(void)
+{
+	return u32SCHEDTicks;
+}
+
+t_bool SCHED_bGetTaskStats(t_u8 u8TaskId, P2VAR(t_SCHED_TaskStats) ptStats)
+{
+	t_bool bStatus = FALSE;
+
+	if (u8TaskId < u8SCHEDTasksCount)
+	{
+		*ptStats = atSCHEDStats[u8TaskId];
+		bStatus = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bStatus;
+}
+
+t_u32 SCHED_u32GetStatsTicks(void)
+{
+	return u32SCHEDTicks - u32SCHEDStatsStartTick;
+}
+
+void SCHED_vResetStats(void)
+{
+	t_u8 u8Task = 0;
+
+	for (u8Task = 0; u8Task < SCHED_TASKS_MAX; u8Task++)
+	{
+		atSCHEDStats[u8Task].u32Runs = 0U;
+		atSCHEDStats[u8Task].u32DeadlineMisses = 0U;
+		atSCHEDStats[u8Task].u32LastCycles = 0U;
+		atSCHEDStats[u8Task].u32MaxCycles = 0U;
+		atSCHEDStats[u8Task].u32TotalCycles = 0U;
+	}
+
+	u32SCHEDStatsStartTick = u32SCHEDTicks;
+}
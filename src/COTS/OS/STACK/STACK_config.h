@@ -0,0 +1,47 @@
+/**
+ * @file STACK_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the STACK module.
+ * @details This file contains the configuration parameters for the STACK module.
+ * @date 2026-10-19
+ */
+
+#ifndef _STACK_CONFIG_H_
+#define _STACK_CONFIG_H_
+
+#include "STACK_interface.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup stack_module
+ * @{
+ */
+
+/**
+ * @defgroup stack_config STACK Configuration
+ * @brief This group contains the configuration parameters of the STACK module
+ * @{
+ */
+
+/**
+ * @def STACK_MONITORED_MAX
+ * @brief This macro defines the number of the stacks that can be registered besides the main stack
+ */
+#define STACK_MONITORED_MAX (8)
+
+/**
+ * @def STACK_WARNING_PERCENT
+ * @brief This macro defines the usage from which a stack is flagged in the report
+ */
+#define STACK_WARNING_PERCENT (75U)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _STACK_CONFIG_H_ */
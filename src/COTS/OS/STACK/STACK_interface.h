@@ -0,0 +1,82 @@
+/**
+ * @file STACK_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the STACK module.
+ * @details This file contains the prototypes of the functions of the STACK module.
+ * @date 2026-10-19
+ */
+
+#ifndef _STACK_INTERFACE_H_
+#define _STACK_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup stack_module
+ * @{
+ */
+
+/**
+ * @def STACK_PAINT_PATTERN
+ * @brief The word written to the unused stacks, a stack is used up to its last word that changed
+ * @note The startup code paints the main stack with the same word (OS_STARTUP_STACK_PAINT_VALUE)
+ */
+#define STACK_PAINT_PATTERN ((t_u32)0xA5A5A5A5U)
+
+/**
+ * @brief This function paints a stack
+ * @param[out] pu32Base The lowest address of the stack
+ * @param[in] u32Words The number of the words of the stack
+ * @warning The stack must not be in use
+ */
+void STACK_vPaint(P2VAR(t_u32) pu32Base, t_u32 u32Words);
+
+/**
+ * @brief This function gets the high-water mark of a painted stack
+ * @details The stacks grow down, so the scan goes up from the lowest address to the first word that changed
+ * @param[in] pu32Base The lowest address of the stack
+ * @param[in] u32Words The number of the words of the stack
+ * @return The largest number of the words used since the stack was painted, equal to u32Words if the stack may have overflowed
+ */
+t_u32 STACK_u32GetUsedWords(P2CONST(t_u32) pu32Base, t_u32 u32Words);
+
+/**
+ * @brief This function gets the size of the main stack
+ * @return The number of the words reserved for the main stack by the linker script
+ */
+t_u32 STACK_u32GetMainWords(void);
+
+/**
+ * @brief This function gets the high-water mark of the main stack
+ * @details The main stack is painted by the startup code, so the mark covers everything since the reset
+ * @return The largest number of the words of the main stack used since the reset
+ */
+t_u32 STACK_u32GetMainUsedWords(void);
+
+/**
+ * @brief This function adds a stack to the report
+ * @param[in] pcName The name of the stack in the report, it must stay valid
+ * @param[in] pu32Base The lowest address of the stack, it must be painted before its first use
+ * @param[in] u32Words The number of the words of the stack
+ * @return TRUE if the stack is added, FALSE if the table is full
+ * @see STACK_MONITORED_MAX
+ */
+t_bool STACK_bRegister(P2CONST(char) pcName, P2CONST(t_u32) pu32Base, t_u32 u32Words);
+
+/**
+ * @brief This function prints the high-water marks of the main stack and of the registered stacks through the trace
+ * @details The stacks used above STACK_WARNING_PERCENT are flagged
+ */
+void STACK_vReport(void);
+
+/** @} */
+/** @} */
+
+#endif /* _STACK_INTERFACE_H_ */
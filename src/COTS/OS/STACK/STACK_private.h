@@ -0,0 +1,67 @@
+/**
+ * @file STACK_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros for the STACK module.
+ * @details This file contains the private macros for the STACK module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir OS/STACK
+ * @brief STACK Module
+ * @details This module contains all the APIs related to the stack usage monitor
+ */
+
+#ifndef _STACK_PRIVATE_H_
+#define _STACK_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @defgroup stack_module STACK Module
+ * @brief STACK Module
+ * @details This module contains all the APIs related to the stack usage monitor
+ * @{
+ */
+
+/**
+ * @defgroup stack_constants STACK Constants
+ * @brief STACK Constants
+ * @{
+ */
+
+/**
+ * @def STACK_MAIN_NAME
+ * @brief The name of the main stack in the reports
+ */
+#define STACK_MAIN_NAME "main"
+
+/** @} */
+
+/**
+ * @defgroup stack_linker_symbols STACK Linker Symbols
+ * @brief The symbols of the main stack defined by the linker script
+ * @{
+ */
+
+/**
+ * @brief The lowest address of the main stack
+ */
+extern t_u32 _Main_Stack_Limit;
+
+/**
+ * @brief The address right after the top of the main stack
+ */
+extern t_u32 _estack;
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _STACK_PRIVATE_H_ */
@@ -0,0 +1,117 @@
+/**
+ * @file STACK_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the STACK module.
+ * @details This file contains the implementation for the STACK module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "diag/Trace.h"
+#include "STACK_private.h"
+#include "STACK_interface.h"
+#include "STACK_config.h"
+
+/**
+ * @brief The names of the registered stacks
+ */
+STATIC P2CONST(char) apcSTACKNames[STACK_MONITORED_MAX] = {NULL};
+
+/**
+ * @brief The lowest addresses of the registered stacks
+ */
+STATIC P2CONST(t_u32) apu32STACKBases[STACK_MONITORED_MAX] = {NULL};
+
+/**
+ * @brief The sizes of the registered stacks in words
+ */
+STATIC t_u32 au32STACKWords[STACK_MONITORED_MAX] = {0};
+
+/**
+ * @brief The number of the registered stacks
+ */
+STATIC t_u8 u8STACKCount = 0;
+
+/**
+ * @brief This function prints the high-water mark of a stack
+ * @param[in] pcName The name of the stack
+ * @param[in] u32UsedWords The high-water mark in words
+ * @param[in] u32Words The size of the stack in words
+ */
+STATIC void STACK_vReportStack(P2CONST(char) pcName, t_u32 u32UsedWords, t_u32 u32Words)
+{
+	trace_printf("stack %-10s %5lu / %5lu words%s\n", pcName, (unsigned long)u32UsedWords, (unsigned long)u32Words,
+				 ((u32UsedWords * 100U) >= (u32Words * STACK_WARNING_PERCENT)) ? " <- high" : "");
+}
+
+void STACK_vPaint(P2VAR(t_u32) pu32Base, t_u32 u32Words)
+{
+	t_u32 u32Index = 0;
+
+	for (u32Index = 0; u32Index < u32Words; u32Index++)
+	{
+		pu32Base[u32Index] = STACK_PAINT_PATTERN;
+	}
+}
+
+t_u32 STACK_u32GetUsedWords(P2CONST(t_u32) pu32Base, t_u32 u32Words)
+{
+	t_u32 u32Free = 0;
+
+	while ((u32Free < u32Words) && (pu32Base[u32Free] == STACK_PAINT_PATTERN))
+	{
+		u32Free++;
+	}
+
+	return u32Words - u32Free;
+}
+
+t_u32 STACK_u32GetMainWords(void)
+{
+	return (t_u32)(&_estack - &_Main_Stack_Limit);
+}
+
+t_u32 STACK_u32GetMainUsedWords(void)
+{
+	return STACK_u32GetUsedWords(&_Main_Stack_Limit, STACK_u32GetMainWords());
+}
+
+t_bool STACK_bRegister(P2CONST(char) pcName, P2CONST(t_u32) pu32Base, t_u32 u32Words)
+{
+	t_bool bResult = FALSE;
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	if (u8STACKCount < STACK_MONITORED_MAX)
+	{
+		apcSTACKNames[u8STACKCount] = pcName;
+		apu32STACKBases[u8STACKCount] = pu32Base;
+		au32STACKWords[u8STACKCount] = u32Words;
+		u8STACKCount++;
+		bResult = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+
+	return bResult;
+}
+
+void STACK_vReport(void)
+{
+	t_u8 u8Index = 0;
+
+	STACK_vReportStack(STACK_MAIN_NAME, STACK_u32GetMainUsedWords(), STACK_u32GetMainWords());
+
+	for (u8Index = 0; u8Index < u8STACKCount; u8Index++)
+	{
+		STACK_vReportStack(apcSTACKNames[u8Index], STACK_u32GetUsedWords(apu32STACKBases[u8Index], au32STACKWords[u8Index]),
+						   au32STACKWords[u8Index]);
+	}
+}
@@ -0,0 +1,56 @@
+/**
+ * @file WDGM_config.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the configuration parameters for the WDGM module.
+ * @details This file contains the configuration parameters for the WDGM module.
+ * @date 2026-10-19
+ */
+
+#ifndef _WDGM_CONFIG_H_
+#define _WDGM_CONFIG_H_
+
+#include "WDGM_interface.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup wdgm_module
+ * @{
+ */
+
+/**
+ * @defgroup wdgm_config WDGM Configuration
+ * @brief This group contains the configuration parameters of the WDGM module
+ * @{
+ */
+
+/**
+ * @def WDGM_ENTITIES_MAX
+ * @brief This macro defines the largest number of the supervised tasks
+ */
+#define WDGM_ENTITIES_MAX (8)
+
+/**
+ * @def WDGM_PERIOD_MS
+ * @brief This macro defines the period of the calls to WDGM_vMainFunction() in milliseconds
+ * @details The deadlines are counted in these periods, so it is also the resolution of the supervision
+ */
+#define WDGM_PERIOD_MS (10U)
+
+/**
+ * @def WDGM_TIMEOUT_MS
+ * @brief This macro defines the timeout of the independent watchdog in milliseconds
+ * @details A stalled task resets the microcontroller after its deadline plus this timeout. It must leave room for the
+ * LSI tolerance (down to 0.67 times the nominal timeout) above WDGM_PERIOD_MS
+ */
+#define WDGM_TIMEOUT_MS (100U)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _WDGM_CONFIG_H_ */
@@ -0,0 +1,103 @@
+/**
+ * @file WDGM_interface.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file is the interface file for the WDGM module.
+ * @details This file contains the prototypes of the functions of the WDGM module.
+ * @date 2026-10-19
+ */
+
+#ifndef _WDGM_INTERFACE_H_
+#define _WDGM_INTERFACE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @addtogroup wdgm_module
+ * @{
+ */
+
+/**
+ * @struct t_WDGM_Stats
+ * @brief WDGM Entity Statistics
+ * @details This type is used to read the supervision state of a task
+ * @see WDGM_bGetStats
+ */
+typedef struct
+{
+	/**
+	 * @brief The deadline of the task in milliseconds (rounded up to WDGM_PERIOD_MS)
+	 */
+	t_u32 u32DeadlineMs;
+	/**
+	 * @brief The longest gap between two check-ins in milliseconds, a value close to the deadline shows a slow task
+	 */
+	t_u32 u32MaxGapMs;
+	/**
+	 * @brief The number of the check-ins
+	 */
+	t_u32 u32CheckIns;
+	/**
+	 * @brief TRUE once the task missed its deadline, the watchdog is no longer refreshed
+	 */
+	t_bool bExpired;
+	/**
+	 * @brief Unused, it completes the structure to a multiple of 4 bytes without any implicit padding
+	 */
+	t_u8 au8Reserved[3];
+} t_WDGM_Stats;
+
+/**
+ * @brief This function starts the independent watchdog and clears the supervised tasks
+ * @return TRUE if the watchdog is started, FALSE if WDGM_TIMEOUT_MS is out of its range
+ * @see WDGM_TIMEOUT_MS
+ */
+t_bool WDGM_bInit(void);
+
+/**
+ * @brief This function adds a task to the supervision
+ * @param[in] pcName The name of the task, used by WDGM_vReport()
+ * @param[in] u32DeadlineMs The longest time between two check-ins of the task in milliseconds
+ * @param[out] pu8EntityId The identifier to pass to WDGM_vCheckIn()
+ * @return TRUE if the task is added, FALSE if the table is full or the deadline is 0
+ * @note The first deadline starts with the registration
+ */
+t_bool WDGM_bRegister(P2CONST(char) pcName, t_u32 u32DeadlineMs, P2VAR(t_u8) pu8EntityId);
+
+/**
+ * @brief This function tells the supervision that a task made progress
+ * @param[in] u8EntityId The identifier given by WDGM_bRegister()
+ * @note This function can be called from any task or interrupt, it only sets a flag
+ */
+void WDGM_vCheckIn(t_u8 u8EntityId);
+
+/**
+ * @brief This function checks the deadlines of the tasks and refreshes the watchdog if none is missed
+ * @details This function must be called every WDGM_PERIOD_MS milliseconds (e.g. from a periodic SCHED task or a timer
+ * callback). A missed deadline is final, the watchdog then resets the microcontroller within WDGM_TIMEOUT_MS
+ */
+void WDGM_vMainFunction(void);
+
+/**
+ * @brief This function gets the supervision state of a task
+ * @param[in] u8EntityId The identifier given by WDGM_bRegister()
+ * @param[out] ptStats The supervision state
+ * @return TRUE if the state is read, FALSE if the identifier is not registered
+ */
+t_bool WDGM_bGetStats(t_u8 u8EntityId, P2VAR(t_WDGM_Stats) ptStats);
+
+/**
+ * @brief This function prints the supervision state of all the tasks through the trace
+ */
+void WDGM_vReport(void);
+
+/** @} */
+/** @} */
+
+#endif /* _WDGM_INTERFACE_H_ */
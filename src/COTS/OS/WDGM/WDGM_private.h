@@ -0,0 +1,53 @@
+/**
+ * @file WDGM_private.h
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the private macros for the WDGM module.
+ * @details This file contains the private macros for the WDGM module.
+ * @date 2026-10-19
+ */
+
+/**
+ * @dir OS/WDGM
+ * @brief WDGM Module
+ * @details This module contains all the APIs related to the watchdog manager that supervises the liveness of the tasks
+ */
+
+#ifndef _WDGM_PRIVATE_H_
+#define _WDGM_PRIVATE_H_
+
+#include "../../LIB/LSTD_TYPES.h"
+
+/**
+ * @addtogroup os
+ * @{
+ */
+
+/**
+ * @defgroup wdgm_module WDGM Module
+ * @brief WDGM Module
+ * @details This module contains all the APIs related to the watchdog manager that supervises the liveness of the tasks.
+ * Each supervised task checks in with WDGM_vCheckIn() and the periodic WDGM_vMainFunction() refreshes the independent
+ * watchdog only while every task checked in within its own deadline. A task that stalls or slows down beyond its deadline
+ * stops the refreshes, so the watchdog resets the microcontroller even if the main loop is still running
+ * @{
+ */
+
+/**
+ * @defgroup wdgm_constants WDGM Constants
+ * @brief WDGM Constants
+ * @{
+ */
+
+/**
+ * @def WDGM_MS_TO_CYCLES
+ * @brief Convert a duration in milliseconds to supervision cycles, rounded up
+ * @param[in] MS The duration in milliseconds
+ */
+#define WDGM_MS_TO_CYCLES(MS) (((MS) + WDGM_PERIOD_MS - 1U) / WDGM_PERIOD_MS)
+
+/** @} */
+/** @} */
+/** @} */
+
+#endif /* _WDGM_PRIVATE_H_ */
@@ -0,0 +1,208 @@
+/**
+ * @file WDGM_program.c
+ * @author Mohamed Alaa
+ * @version 1.0.0
+ * @brief This file contains the implementation for the WDGM module.
+ * @details This file contains the implementation for the WDGM module.
+ * @date 2026-10-19
+ */
+
+#include "../../LIB/LSTD_TYPES.h"
+#include "../../LIB/LSTD_COMPILER.h"
+#include "../../LIB/LSTD_VALUES.h"
+#include "../../LIB/LSTD_CPU.h"
+#include "../../MCAL/IWDG/IWDG_interface.h"
+#include "diag/Trace.h"
+#include "WDGM_private.h"
+#include "WDGM_interface.h"
+#include "WDGM_config.h"
+
+STATIC_ASSERT(((WDGM_TIMEOUT_MS * 2U) / 3U) > WDGM_PERIOD_MS, "The watchdog timeout must exceed the supervision period even with the slowest LSI");
+
+/**
+ * @brief The names of the supervised tasks
+ */
+STATIC P2CONST(char) apcWDGMNames[WDGM_ENTITIES_MAX] = {NULL};
+
+/**
+ * @brief The deadlines of the supervised tasks in supervision cycles
+ */
+STATIC t_u32 au32WDGMDeadlines[WDGM_ENTITIES_MAX] = {0};
+
+/**
+ * @brief The number of the supervision cycles since the last check-in of each task
+ */
+STATIC t_u32 au32WDGMElapsed[WDGM_ENTITIES_MAX] = {0};
+
+/**
+ * @brief The longest gap between two check-ins of each task in supervision cycles
+ */
+STATIC t_u32 au32WDGMMaxGaps[WDGM_ENTITIES_MAX] = {0};
+
+/**
+ * @brief The number of the check-ins of each task
+ */
+STATIC VOLATILE t_u32 au32WDGMCheckIns[WDGM_ENTITIES_MAX] = {0};
+
+/**
+ * @brief The check-in flags, set by the tasks and cleared by the supervision
+ */
+STATIC VOLATILE t_bool abWDGMAlive[WDGM_ENTITIES_MAX] = {FALSE};
+
+/**
+ * @brief The tasks that missed their deadline
+ */
+STATIC t_bool abWDGMExpired[WDGM_ENTITIES_MAX] = {FALSE};
+
+/**
+ * @brief The number of the supervised tasks
+ */
+STATIC t_u8 u8WDGMCount = 0;
+
+/**
+ * @brief Whether any task missed its deadline, the refreshes stop for good
+ */
+STATIC t_bool bWDGMExpired = FALSE;
+
+t_bool WDGM_bInit(void)
+{
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	u8WDGMCount = 0U;
+	bWDGMExpired = FALSE;
+
+	CPU_vExitCritical(u32PRIMASK);
+
+	return IWDG_bStart(WDGM_TIMEOUT_MS);
+}
+
+t_bool WDGM_bRegister(P2CONST(char) pcName, t_u32 u32DeadlineMs, P2VAR(t_u8) pu8EntityId)
+{
+	t_bool bResult = FALSE;
+	t_u32 u32PRIMASK = CPU_u32EnterCritical();
+
+	if ((u8WDGMCount < WDGM_ENTITIES_MAX) && (u32DeadlineMs != 0U))
+	{
+		apcWDGMNames[u8WDGMCount] = pcName;
+		au32WDGMDeadlines[u8WDGMCount] = WDGM_MS_TO_CYCLES(u32DeadlineMs);
+		au32WDGMElapsed[u8WDGMCount] = 0U;
+		au32WDGMMaxGaps[u8WDGMCount] = 0U;
+		au32WDGMCheckIns[u8WDGMCount] = 0U;
+		abWDGMAlive[u8WDGMCount] = FALSE;
+		abWDGMExpired[u8WDGMCount] = FALSE;
+		*pu8EntityId = u8WDGMCount;
+		u8WDGMCount++;
+		bResult = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	CPU_vExitCritical(u32PRIMASK);
+
+	return bResult;
+}
+
+void WDGM_vCheckIn(t_u8 u8EntityId)
+{
+	t_u32 u32PRIMASK = 0;
+
+	if (u8EntityId < u8WDGMCount)
+	{
+		u32PRIMASK = CPU_u32EnterCritical();
+
+		abWDGMAlive[u8EntityId] = TRUE;
+		au32WDGMCheckIns[u8EntityId]++;
+
+		CPU_vExitCritical(u32PRIMASK);
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+void WDGM_vMainFunction(void)
+{
+	t_u8 u8Entity = 0;
+	t_bool bAlive = FALSE;
+	t_u32 u32PRIMASK = 0;
+
+	for (u8Entity = 0; u8Entity < u8WDGMCount; u8Entity++)
+	{
+		/* Take the flag and clear it at once, so that a check-in in between is not lost */
+		u32PRIMASK = CPU_u32EnterCritical();
+		bAlive = abWDGMAlive[u8Entity];
+		abWDGMAlive[u8Entity] = FALSE;
+		CPU_vExitCritical(u32PRIMASK);
+
+		au32WDGMElapsed[u8Entity]++;
+
+		if (bAlive == TRUE)
+		{
+			if (au32WDGMElapsed[u8Entity] > au32WDGMMaxGaps[u8Entity])
+			{
+				au32WDGMMaxGaps[u8Entity] = au32WDGMElapsed[u8Entity];
+			}
+			else
+			{
+				/* Do nothing */
+			}
+
+			au32WDGMElapsed[u8Entity] = 0U;
+		}
+		else if (au32WDGMElapsed[u8Entity] > au32WDGMDeadlines[u8Entity])
+		{
+			/* A late check-in does not undo the miss, the task is degraded even if it recovers */
+			abWDGMExpired[u8Entity] = TRUE;
+			bWDGMExpired = TRUE;
+		}
+		else
+		{
+			/* Do nothing */
+		}
+	}
+
+	if (bWDGMExpired == FALSE)
+	{
+		IWDG_vRefresh();
+	}
+	else
+	{
+		/* Do nothing */
+	}
+}
+
+t_bool WDGM_bGetStats(t_u8 u8EntityId, P2VAR(t_WDGM_Stats) ptStats)
+{
+	t_bool bResult = FALSE;
+
+	if (u8EntityId < u8WDGMCount)
+	{
+		ptStats->u32DeadlineMs = au32WDGMDeadlines[u8EntityId] * WDGM_PERIOD_MS;
+		ptStats->u32MaxGapMs = au32WDGMMaxGaps[u8EntityId] * WDGM_PERIOD_MS;
+		ptStats->u32CheckIns = au32WDGMCheckIns[u8EntityId];
+		ptStats->bExpired = abWDGMExpired[u8EntityId];
+		bResult = TRUE;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	return bResult;
+}
+
+void WDGM_vReport(void)
+{
+	t_u8 u8Entity = 0;
+	t_WDGM_Stats tStats = {0};
+
+	for (u8Entity = 0; u8Entity < u8WDGMCount; u8Entity++)
+	{
+		(void)WDGM_bGetStats(u8Entity, &tStats);
+		trace_printf("wdgm %-10s gap %5lu / %5lu ms, %8lu check-ins%s\n", apcWDGMNames[u8Entity], (unsigned long)tStats.u32MaxGapMs,
+					 (unsigned long)tStats.u32DeadlineMs, (unsigned long)tStats.u32CheckIns, (tStats.bExpired == TRUE) ? " <- expired" : "");
+	}
+}
@@ -0,0 +1,9 @@
+/**
+ * @dir OS OS Services
+ * @brief OS Services
+ */
+
+/**
+ * @defgroup os OS Services
+ * @brief Execution services that share the CPU between the applications
+ */
@@ -101,6 +101,8 @@ extern "C"
   HardFault_Handler_C (ExceptionStackFrame* frame, uint32_t lr);
 
 #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
+  void
+  MemManage_Handler_C (ExceptionStackFrame* frame, uint32_t lr);
   void
   UsageFault_Handler_C (ExceptionStackFrame* frame, uint32_t lr);
   void
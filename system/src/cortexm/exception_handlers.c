@@ -39,6 +39,12 @@ extern void
 __attribute__((noreturn,weak))
 _start (void);
 
+// Writes the post-mortem record and resets, when the application links
+// the CRASH module (src/COTS/OS/CRASH).
+extern void
+__attribute__((weak))
+CRASH_vRecordFault (const uint32_t* frame, uint32_t lr);
+
 // ----------------------------------------------------------------------------
 // Default exception handlers. Override the ones here by defining your own
 // handler routines in your application code.
@@ -402,6 +408,10 @@ HardFault_Handler_C (ExceptionStackFrame* frame __attribute__((unused)),
 #if defined(DEBUG)
   __DEBUG_BKPT();
 #endif
+  if (CRASH_vRecordFault != 0)
+    {
+      CRASH_vRecordFault ((const uint32_t*) frame, lr);
+    }
   while (1)
     {
     }
@@ -467,12 +477,44 @@ HardFault_Handler_C (ExceptionStackFrame* frame __attribute__((unused)),
 
 #if defined(__ARM_ARCH_7M__) || defined(__ARM_ARCH_7EM__)
 
-void __attribute__ ((section(".after_vectors"),weak))
+void __attribute__ ((section(".after_vectors"),weak,naked))
 MemManage_Handler (void)
 {
+  asm volatile(
+      " tst lr,#4       \n"
+      " ite eq          \n"
+      " mrseq r0,msp    \n"
+      " mrsne r0,psp    \n"
+      " mov r1,lr       \n"
+      " ldr r2,=MemManage_Handler_C \n"
+      " bx r2"
+
+      : /* Outputs */
+      : /* Inputs */
+      : /* Clobbers */
+  );
+}
+
+void __attribute__ ((section(".after_vectors"),weak,used))
+MemManage_Handler_C (ExceptionStackFrame* frame __attribute__((unused)),
+                     uint32_t lr __attribute__((unused)))
+{
+#if defined(TRACE)
+  uint32_t mmfar = SCB->MMFAR; // MemManage Fault Address
+  uint32_t bfar = SCB->BFAR; // Bus Fault Address
+  uint32_t cfsr = SCB->CFSR; // Configurable Fault Status Registers
+
+  trace_printf ("[MemManage]\n");
+  dumpExceptionStack (frame, cfsr, mmfar, bfar, lr);
+#endif // defined(TRACE)
+
 #if defined(DEBUG)
   __DEBUG_BKPT();
 #endif
+  if (CRASH_vRecordFault != 0)
+    {
+      CRASH_vRecordFault ((const uint32_t*) frame, lr);
+    }
   while (1)
     {
     }
@@ -512,6 +554,10 @@ BusFault_Handler_C (ExceptionStackFrame* frame __attribute__((unused)),
 #if defined(DEBUG)
   __DEBUG_BKPT();
 #endif
+  if (CRASH_vRecordFault != 0)
+    {
+      CRASH_vRecordFault ((const uint32_t*) frame, lr);
+    }
   while (1)
     {
     }
@@ -566,6 +612,10 @@ UsageFault_Handler_C (ExceptionStackFrame* frame __attribute__((unused)),
 #if defined(DEBUG)
   __DEBUG_BKPT();
 #endif
+  if (CRASH_vRecordFault != 0)
+    {
+      CRASH_vRecordFault ((const uint32_t*) frame, lr);
+    }
   while (1)
     {
     }
@@ -56,6 +56,14 @@
 
 // ----------------------------------------------------------------------------
 
+// Logs each write as an event of the post-mortem record, when the application
+// links the CRASH module (src/COTS/OS/CRASH).
+extern void
+__attribute__((weak))
+CRASH_vLogTrace (const char* buf, uint32_t nbyte);
+
+// ----------------------------------------------------------------------------
+
 // Forward definitions.
 
 #if defined(OS_USE_TRACE_ITM)
@@ -90,6 +98,11 @@ ssize_t
 trace_write (const char* buf __attribute__((unused)),
 	     size_t nbyte __attribute__((unused)))
 {
+  if (CRASH_vLogTrace != 0)
+    {
+      CRASH_vLogTrace (buf, (uint32_t) nbyte);
+    }
+
 #if defined(OS_USE_TRACE_ITM)
   return _trace_write_itm (buf, nbyte);
 #elif defined(OS_USE_TRACE_SEMIHOSTING_STDOUT)
@@ -33,8 +33,10 @@
 // Control reaches here from the reset handler via jump or call.
 //
 // The actual steps performed by _start are:
+// - copy the RAM-resident code (.ramfunc)
 // - copy the initialised data region(s)
 // - clear the BSS region(s)
+// - paint the unused main stack (for the high-water mark)
 // - initialise the system
 // - run the preinit/init array (for the C++ static constructors)
 // - initialise the arc/argv
@@ -64,6 +66,36 @@
 
 // ----------------------------------------------------------------------------
 
+// Copy .data and clear .bss with 4-word ldm/stm bursts.
+#if !defined(OS_INCLUDE_STARTUP_BURST_INIT)
+#define OS_INCLUDE_STARTUP_BURST_INIT (1)
+#endif
+
+// Clear the .noinit section as well. It is skipped by default so that
+// its content survives a warm reset (watchdog, software or pin reset),
+// it is only meaningful once it has been written after a power-on.
+#if !defined(OS_INCLUDE_STARTUP_INIT_NOINIT)
+#define OS_INCLUDE_STARTUP_INIT_NOINIT (0)
+#endif
+
+// Count the core cycles from the reset to main() with the DWT cycle
+// counter; the count is left in __startup_cycles.
+#if !defined(OS_INCLUDE_STARTUP_CYCLE_COUNT)
+#define OS_INCLUDE_STARTUP_CYCLE_COUNT (1)
+#endif
+
+#if !defined(OS_INCLUDE_STARTUP_STACK_PAINTING)
+#define OS_INCLUDE_STARTUP_STACK_PAINTING (1)
+#endif
+
+// The word used to paint the unused main stack, it must be kept in sync
+// with STACK_PAINT_PATTERN of the STACK module.
+#if !defined(OS_STARTUP_STACK_PAINT_VALUE)
+#define OS_STARTUP_STACK_PAINT_VALUE (0xA5A5A5A5)
+#endif
+
+// ----------------------------------------------------------------------------
+
 #if !defined(OS_INCLUDE_STARTUP_INIT_MULTIPLE_RAM_SECTIONS)
 // Begin address for the initialisation values of the .data section.
 // defined in linker script
@@ -90,6 +122,40 @@ extern unsigned int __bss_regions_array_start;
 extern unsigned int __bss_regions_array_end;
 #endif
 
+// Begin address for the load image of the .ramfunc section; defined
+// in linker script
+extern unsigned int _siramfunc;
+// Begin address for the .ramfunc section; defined in linker script
+extern unsigned int _sramfunc;
+// End address for the .ramfunc section; defined in linker script
+extern unsigned int _eramfunc;
+
+#if (OS_INCLUDE_STARTUP_INIT_NOINIT)
+// Begin address for the .noinit section; defined in linker script
+extern unsigned int _noinit;
+// End address for the .noinit section; defined in linker script
+extern unsigned int _end_noinit;
+#endif
+
+#if (OS_INCLUDE_STARTUP_STACK_PAINTING)
+// Lowest address of the main stack; defined in linker script
+extern unsigned int _Main_Stack_Limit;
+#endif
+
+#if (OS_INCLUDE_STARTUP_CYCLE_COUNT)
+// DWT registers used to count the startup cycles.
+#define STARTUP_DEMCR (*(volatile uint32_t*) 0xE000EDFC)
+#define STARTUP_DEMCR_TRCENA (1U << 24)
+#define STARTUP_DWT_CTRL (*(volatile uint32_t*) 0xE0001000)
+#define STARTUP_DWT_CTRL_CYCCNTENA (1U << 0)
+#define STARTUP_DWT_CYCCNT (*(volatile uint32_t*) 0xE0001004)
+#endif
+
+// The number of the core cycles from the reset to main(), 0 when
+// OS_INCLUDE_STARTUP_CYCLE_COUNT is disabled. It is written after
+// the .bss section is cleared.
+unsigned int __startup_cycles;
+
 extern void
 __initialize_args (int*, char***);
 
@@ -120,6 +186,9 @@ __initialize_data (unsigned int* from, unsigned int* region_begin,
 void
 __initialize_bss (unsigned int* region_begin, unsigned int* region_end);
 
+void
+__initialize_stack (unsigned int* region_begin);
+
 void
 __run_init_array (void);
 
@@ -139,9 +208,28 @@ __attribute__((always_inline))
 __initialize_data (unsigned int* from, unsigned int* region_begin,
 		   unsigned int* region_end)
 {
-  // Iterate and copy word by word.
   // It is assumed that the pointers are word aligned.
   unsigned int *p = region_begin;
+
+#if (OS_INCLUDE_STARTUP_BURST_INIT)
+  // Copy 4 words per ldm/stm pair; each one costs 1 cycle plus 1 per
+  // word instead of 2 per word for single loads and stores, and the
+  // loop overhead is paid once per 4 words.
+  unsigned int bursts = (unsigned int) (region_end - p) / 4;
+  __asm volatile (
+      "   cmp %[n], #0                       \n"
+      "   beq 2f                             \n"
+      "1: ldmia %[src]!, {r4, r5, r6, r8}    \n"
+      "   stmia %[dst]!, {r4, r5, r6, r8}    \n"
+      "   subs %[n], %[n], #1                \n"
+      "   bne 1b                             \n"
+      "2:                                    \n"
+      : [src] "+r" (from), [dst] "+r" (p), [n] "+r" (bursts)
+      :
+      : "r4", "r5", "r6", "r8", "cc", "memory");
+#endif
+
+  // Iterate and copy word by word (the remaining words).
   while (p < region_end)
     *p++ = *from++;
 }
@@ -150,13 +238,47 @@ inline void
 __attribute__((always_inline))
 __initialize_bss (unsigned int* region_begin, unsigned int* region_end)
 {
-  // Iterate and clear word by word.
   // It is assumed that the pointers are word aligned.
   unsigned int *p = region_begin;
+
+#if (OS_INCLUDE_STARTUP_BURST_INIT)
+  // Clear 4 words per stm.
+  unsigned int bursts = (unsigned int) (region_end - p) / 4;
+  __asm volatile (
+      "   movs r4, #0                        \n"
+      "   movs r5, #0                        \n"
+      "   movs r6, #0                        \n"
+      "   mov r8, r4                         \n"
+      "   cmp %[n], #0                       \n"
+      "   beq 2f                             \n"
+      "1: stmia %[dst]!, {r4, r5, r6, r8}    \n"
+      "   subs %[n], %[n], #1                \n"
+      "   bne 1b                             \n"
+      "2:                                    \n"
+      : [dst] "+r" (p), [n] "+r" (bursts)
+      :
+      : "r4", "r5", "r6", "r8", "cc", "memory");
+#endif
+
+  // Iterate and clear word by word (the remaining words).
   while (p < region_end)
     *p++ = 0;
 }
 
+inline void
+__attribute__((always_inline))
+__initialize_stack (unsigned int* region_begin)
+{
+  // Paint from the stack limit up to the current stack pointer; the
+  // words below the stack pointer are not in use yet.
+  unsigned int *sp;
+  __asm volatile ("mov %0, sp" : "=r" (sp));
+
+  unsigned int *p = region_begin;
+  while (p < sp)
+    *p++ = OS_STARTUP_STACK_PAINT_VALUE;
+}
+
 // These magic symbols are provided by the linker.
 extern void
 (*__preinit_array_start[]) (void) __attribute__((weak));
@@ -245,6 +367,14 @@ void __attribute__ ((section(".after_vectors"),noreturn,weak))
 _start (void)
 {
 
+#if (OS_INCLUDE_STARTUP_CYCLE_COUNT)
+  // Start the cycle counter first, the few cycles from the reset
+  // vector to here are not counted.
+  STARTUP_DEMCR |= STARTUP_DEMCR_TRCENA;
+  STARTUP_DWT_CYCCNT = 0;
+  STARTUP_DWT_CTRL |= STARTUP_DWT_CTRL_CYCCNTENA;
+#endif
+
   // Initialise hardware right after reset, to switch clock to higher
   // frequency and have the rest of the initialisations run faster.
   //
@@ -264,6 +394,9 @@ _start (void)
   __data_end_guard = DATA_GUARD_BAD_VALUE;
 #endif
 
+  // Copy the RAM-resident code from Flash to RAM (inlined).
+  __initialize_data(&_siramfunc, &_sramfunc, &_eramfunc);
+
 #if !defined(OS_INCLUDE_STARTUP_INIT_MULTIPLE_RAM_SECTIONS)
   // Copy the DATA segment from Flash to RAM (inlined).
   __initialize_data(&_sidata, &_sdata, &_edata);
@@ -319,6 +452,17 @@ _start (void)
     }
 #endif
 
+#if (OS_INCLUDE_STARTUP_INIT_NOINIT)
+  // Zero fill the NOINIT section (inlined).
+  __initialize_bss(&_noinit, &_end_noinit);
+#endif
+
+#if (OS_INCLUDE_STARTUP_STACK_PAINTING)
+  // Paint the unused main stack (inlined), the STACK module reads
+  // its high-water mark.
+  __initialize_stack (&_Main_Stack_Limit);
+#endif
+
   // Hook to continue the initialisations. Usually compute and store the
   // clock frequency in the global CMSIS variable, cleared above.
   __initialize_hardware ();
@@ -332,6 +476,10 @@ _start (void)
   // execute the constructors for the static objects).
   __run_init_array ();
 
+#if (OS_INCLUDE_STARTUP_CYCLE_COUNT)
+  __startup_cycles = STARTUP_DWT_CYCCNT;
+#endif
+
   // Call the main entry point, and save the exit code.
   int code = main (argc, argv);
 
@@ -0,0 +1,51 @@
+/**
+ * @file LSTD_CPU_stub.h
+ * @author Mohamed Alaa
+ * @brief This file replaces the CPU intrinsics used by the ring buffers for the host test
+ * @version 1.0.0
+ * @date 2026-10-19
+ */
+
+#ifndef _LSTD_CPU_STUB_H_
+#define _LSTD_CPU_STUB_H_
+
+/* Keep the target header (inline assembly) out of the host build */
+#define _LSTD_CPU_H_
+
+#include "LSTD_TYPES.h"
+#include "LSTD_COMPILER.h"
+
+/**
+ * @def CPU_DMB()
+ * @brief The host test runs on a single thread, no barrier is needed
+ */
+#define CPU_DMB() ((void)0)
+
+/**
+ * @def CPU_CLREX()
+ * @brief Drop the reservation of the simulated exclusive monitor
+ */
+#define CPU_CLREX() CPU_vStubCLREX()
+
+/**
+ * @brief Load a word and take the reservation of the simulated exclusive monitor
+ * @param[in] pu32Address The address of the word
+ * @return The word
+ */
+t_u32 CPU_u32LDREX(P2VAR(VOLATILE t_u32) pu32Address);
+
+/**
+ * @brief Store a word if the reservation of the simulated exclusive monitor still holds
+ * @details The test can run a simulated interrupt right before the store, which drops the reservation
+ * @param[in] u32Value The word to store
+ * @param[out] pu32Address The address of the word
+ * @return `0` if the word is stored, `1` if the reservation was lost
+ */
+t_u32 CPU_u32STREX(t_u32 u32Value, P2VAR(VOLATILE t_u32) pu32Address);
+
+/**
+ * @brief Drop the reservation of the simulated exclusive monitor
+ */
+void CPU_vStubCLREX(void);
+
+#endif /* _LSTD_CPU_STUB_H_ */
@@ -0,0 +1,336 @@
+/**
+ * @file test_ring.c
+ * @author Mohamed Alaa
+ * @brief This file contains the host test of the ring buffers
+ * @details The ring buffers are built for the host against the stubbed CPU intrinsics of LSTD_CPU_stub.h,
+ * the exclusive monitor is simulated so that an interrupt can be injected inside a reservation
+ * @version 1.0.0
+ * @date 2026-10-19
+ */
+
+#include "LSTD_TYPES.h"
+#include "LSTD_COMPILER.h"
+#include "LSTD_VALUES.h"
+#include "LSTD_RING.h"
+/* The host headers come last, they redefine NULL with the same value */
+#include <stdio.h>
+#include <string.h>
+
+/**
+ * @def TEST_CHECK
+ * @brief Count and report a failed condition
+ * @param[in] CONDITION The condition that must hold
+ */
+#define TEST_CHECK(CONDITION)                                               \
+	do                                                                      \
+	{                                                                       \
+		if (!(CONDITION))                                                   \
+		{                                                                   \
+			printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #CONDITION); \
+			u32TestFailures++;                                              \
+		}                                                                   \
+		else                                                                \
+		{                                                                   \
+			/* Do nothing */                                                \
+		}                                                                   \
+	} while (0)
+
+/**
+ * @def TEST_RING_SIZE
+ * @brief The number of the bytes of the tested storage
+ */
+#define TEST_RING_SIZE (8U)
+
+/**
+ * @brief The number of the failed checks
+ */
+STATIC t_u32 u32TestFailures = 0;
+
+/**
+ * @brief The address reserved by the simulated exclusive monitor (NULL if none)
+ */
+STATIC P2VAR(VOLATILE t_u32) pu32TestReservation = NULL;
+
+/**
+ * @brief The simulated interrupt run right before the next store to its address (NULL if none)
+ */
+STATIC P2FUNC(void, pfTestInterrupt)(void) = NULL;
+
+/**
+ * @brief The address that triggers the simulated interrupt
+ */
+STATIC P2VAR(VOLATILE t_u32) pu32TestInterruptAddress = NULL;
+
+/**
+ * @brief The storage of the tested ring buffer
+ */
+STATIC t_u8 au8TestStorage[TEST_RING_SIZE];
+
+/**
+ * @brief The tested ring buffer
+ */
+STATIC t_RING tTestRing;
+
+t_u32 CPU_u32LDREX(P2VAR(VOLATILE t_u32) pu32Address)
+{
+	pu32TestReservation = pu32Address;
+
+	return *pu32Address;
+}
+
+t_u32 CPU_u32STREX(t_u32 u32Value, P2VAR(VOLATILE t_u32) pu32Address)
+{
+	t_u32 u32Result = 1U;
+	P2FUNC(void, pfInterrupt)(void) = pfTestInterrupt;
+
+	if ((pfInterrupt != NULL) && (pu32Address == pu32TestInterruptAddress))
+	{
+		/* The interrupt runs once, the exception entry and return drop the reservation */
+		pfTestInterrupt = NULL;
+		pfInterrupt();
+		pu32TestReservation = NULL;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	if (pu32TestReservation == pu32Address)
+	{
+		*pu32Address = u32Value;
+		u32Result = 0U;
+	}
+	else
+	{
+		/* Do nothing */
+	}
+
+	pu32TestReservation = NULL;
+
+	return u32Result;
+}
+
+void CPU_vStubCLREX(void)
+{
+	pu32TestReservation = NULL;
+}
+
+/**
+ * @brief This function empties the tested ring buffer and moves its free running indexes
+ * @param[in] u32Index The value of all the indexes
+ */
+STATIC void vTestResetRing(t_u32 u32Index)
+{
+	(void)RING_bInit(&tTestRing, au8TestStorage, TEST_RING_SIZE);
+	memset(au8TestStorage, 0, sizeof(au8TestStorage));
+	tTestRing.u32Head = u32Index;
+	tTestRing.u32Commit = u32Index;
+	tTestRing.u32Tail = u32Index;
+}
+
+/**
+ * @brief This function checks the rejected sizes of the storage
+ */
+STATIC void vTestInit(void)
+{
+	TEST_CHECK(RING_bInit(&tTestRing, au8TestStorage, 0U) == FALSE);
+	TEST_CHECK(RING_bInit(&tTestRing, au8TestStorage, 6U) == FALSE);
+	TEST_CHECK(RING_bInit(&tTestRing, au8TestStorage, TEST_RING_SIZE) == TRUE);
+}
+
+/**
+ * @brief This function checks the full and empty boundaries
+ */
+STATIC void vTestFullEmpty(void)
+{
+	t_u8 au8Data[TEST_RING_SIZE + 2U] = {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U, 9U};
+	t_u8 au8Read[TEST_RING_SIZE + 2U] = {0U};
+	P2VAR(t_u8) pu8Span = NULL;
+
+	vTestResetRing(0U);
+
+	TEST_CHECK(RING_u32GetCount(&tTestRing) == 0U);
+	TEST_CHECK(RING_u32GetFree(&tTestRing) == TEST_RING_SIZE);
+	TEST_CHECK(RING_u32Read(&tTestRing, au8Read, 1U) == 0U);
+	TEST_CHECK(RING_u32GetReadSpan(&tTestRing, &pu8Span) == 0U);
+
+	/* The whole storage is usable, the extra bytes are refused */
+	TEST_CHECK(RING_u32Write(&tTestRing, au8Data, TEST_RING_SIZE + 2U) == TEST_RING_SIZE);
+	TEST_CHECK(RING_u32GetCount(&tTestRing) == TEST_RING_SIZE);
+	TEST_CHECK(RING_u32GetFree(&tTestRing) == 0U);
+	TEST_CHECK(RING_u32Write(&tTestRing, au8Data, 1U) == 0U);
+	TEST_CHECK(RING_u32GetWriteSpan(&tTestRing, &pu8Span) == 0U);
+	TEST_CHECK(RING_bWriteMulti(&tTestRing, au8Data, 1U) == FALSE);
+
+	TEST_CHECK(RING_u32Read(&tTestRing, au8Read, TEST_RING_SIZE + 2U) == TEST_RING_SIZE);
+	TEST_CHECK(memcmp(au8Read, au8Data, TEST_RING_SIZE) == 0);
+	TEST_CHECK(RING_u32GetCount(&tTestRing) == 0U);
+	TEST_CHECK(RING_u32GetFree(&tTestRing) == TEST_RING_SIZE);
+}
+
+/**
+ * @brief This function checks the wrap around of the storage and of the free running indexes
+ */
+STATIC void vTestWrapAround(void)
+{
+	t_u8 au8Data[6] = {10U, 11U, 12U, 13U, 14U, 15U};
+	t_u8 au8Read[6] = {0U};
+	t_u32 u32Round = 0;
+
+	/* The indexes overflow in the middle of the bytes, which also cross the end of the storage */
+	vTestResetRing(0xFFFFFFFDU);
+
+	for (u32Round = 0; u32Round < 4U; u32Round++)
+	{
+		TEST_CHECK(RING_u32Write(&tTestRing, au8Data, sizeof(au8Data)) == sizeof(au8Data));
+		TEST_CHECK(RING_u32GetCount(&tTestRing) == sizeof(au8Data));
+		TEST_CHECK(RING_u32GetFree(&tTestRing) == (TEST_RING_SIZE - sizeof(au8Data)));
+
+		memset(au8Read, 0, sizeof(au8Read));
+		TEST_CHECK(RING_u32Read(&tTestRing, au8Read, sizeof(au8Read)) == sizeof(au8Read));
+		TEST_CHECK(memcmp(au8Read, au8Data, sizeof(au8Data)) == 0);
+		TEST_CHECK(RING_u32GetCount(&tTestRing) == 0U);
+	}
+
+	/* 4 rounds of 6 bytes from 0xFFFFFFFD end at 21 */
+	TEST_CHECK(tTestRing.u32Tail == 21U);
+}
+
+/**
+ * @brief This function checks that the spans stop at the end of the storage
+ */
+STATIC void vTestSpans(void)
+{
+	t_u8 au8Data[6] = {20U, 21U, 22U, 23U, 24U, 25U};
+	t_u8 au8Read[6] = {0U};
+	P2VAR(t_u8) pu8Span = NULL;
+
+	vTestResetRing(0U);
+
+	/* Move the indexes to offset 6, 2 bytes before the end of the storage */
+	(void)RING_u32Write(&tTestRing, au8Data, sizeof(au8Data));
+	(void)RING_u32Read(&tTestRing, au8Read, sizeof(au8Read));
+
+	/* The write span stops at the end even though the whole storage is free */
+	TEST_CHECK(RING_u32GetWriteSpan(&tTestRing, &pu8Span) == 2U);
+	TEST_CHECK(pu8Span == &au8TestStorage[6]);
+	pu8Span[0] = 30U;
+	pu8Span[1] = 31U;
+	RING_vCommitWrite(&tTestRing, 2U);
+
+	/* The next write span restarts at the beginning of the storage */
+	TEST_CHECK(RING_u32GetWriteSpan(&tTestRing, &pu8Span) == 6U);
+	TEST_CHECK(pu8Span == &au8TestStorage[0]);
+	pu8Span[0] = 32U;
+	pu8Span[1] = 33U;
+	pu8Span[2] = 34U;
+	RING_vCommitWrite(&tTestRing, 3U);
+	TEST_CHECK(RING_u32GetCount(&tTestRing) == 5U);
+
+	/* The read span stops at the end, then the rest is read from the beginning */
+	TEST_CHECK(RING_u32GetReadSpan(&tTestRing, &pu8Span) == 2U);
+	TEST_CHECK(pu8Span == &au8TestStorage[6]);
+	TEST_CHECK((pu8Span[0] == 30U) && (pu8Span[1] == 31U));
+	RING_vCommitRead(&tTestRing, 2U);
+
+	TEST_CHECK(RING_u32GetReadSpan(&tTestRing, &pu8Span) == 3U);
+	TEST_CHECK(pu8Span == &au8TestStorage[0]);
+	TEST_CHECK((pu8Span[0] == 32U) && (pu8Span[1] == 33U) && (pu8Span[2] == 34U));
+	RING_vCommitRead(&tTestRing, 3U);
+	TEST_CHECK(RING_u32GetCount(&tTestRing) == 0U);
+}
+
+/**
+ * @brief This function checks that a multi-producer write is all or nothing
+ */
+STATIC void vTestWriteMultiAllOrNothing(void)
+{
+	t_u8 au8Data[5] = {40U, 41U, 42U, 43U, 44U};
+	t_u8 au8Read[TEST_RING_SIZE] = {0U};
+
+	vTestResetRing(0xFFFFFFFEU);
+
+	TEST_CHECK(RING_bWriteMulti(&tTestRing, au8Data, sizeof(au8Data)) == TRUE);
+	TEST_CHECK(RING_u32GetFree(&tTestRing) == 3U);
+
+	/* The failed reservation leaves no byte, no index and no writer behind */
+	TEST_CHECK(RING_bWriteMulti(&tTestRing, au8Data, 4U) == FALSE);
+	TEST_CHECK(RING_u32GetCount(&tTestRing) == sizeof(au8Data));
+	TEST_CHECK(tTestRing.u32Head == tTestRing.u32Commit);
+	TEST_CHECK(tTestRing.u32Writers == 0U);
+
+	/* The exact remaining room is accepted */
+	TEST_CHECK(RING_bWriteMulti(&tTestRing, au8Data, 3U) == TRUE);
+	TEST_CHECK(RING_u32GetFree(&tTestRing) == 0U);
+
+	TEST_CHECK(RING_u32Read(&tTestRing, au8Read, sizeof(au8Read)) == TEST_RING_SIZE);
+	TEST_CHECK(memcmp(au8Read, au8Data, sizeof(au8Data)) == 0);
+	TEST_CHECK(memcmp(&au8Read[5], au8Data, 3U) == 0);
+}
+
+/**
+ * @brief This function is the producer of the simulated interrupt
+ */
+STATIC void vTestInterruptProducer(void)
+{
+	STATIC CONST t_u8 au8Data[2] = {'X', 'Y'};
+
+	TEST_CHECK(RING_bWriteMulti(&tTestRing, au8Data, sizeof(au8Data)) == TRUE);
+	/* The interrupted producer is still copying, the bytes of both are not published yet */
+	TEST_CHECK(tTestRing.u32Commit != tTestRing.u32Head);
+}
+
+/**
+ * @brief This function checks a multi-producer write whose reservation is taken away by an interrupt
+ */
+STATIC void vTestWriteMultiInterrupted(void)
+{
+	STATIC CONST t_u8 au8Data[3] = {'a', 'b', 'c'};
+	t_u8 au8Read[TEST_RING_SIZE] = {0U};
+
+	vTestResetRing(6U);
+
+	/* The interrupt comes between the reservation and its store */
+	pfTestInterrupt = vTestInterruptProducer;
+	pu32TestInterruptAddress = &tTestRing.u32Head;
+
+	TEST_CHECK(RING_bWriteMulti(&tTestRing, au8Data, sizeof(au8Data)) == TRUE);
+	TEST_CHECK(pfTestInterrupt == NULL);
+	TEST_CHECK(tTestRing.u32Writers == 0U);
+
+	/* The interrupted write is reserved after the interrupt one, each stays together */
+	TEST_CHECK(RING_u32Read(&tTestRing, au8Read, sizeof(au8Read)) == 5U);
+	TEST_CHECK(memcmp(au8Read, "XYabc", 5U) == 0);
+
+	/* No room left for the interrupted write once the interrupt one is in */
+	vTestResetRing(0U);
+	(void)RING_u32Write(&tTestRing, au8Read, 4U);
+	pfTestInterrupt = vTestInterruptProducer;
+	pu32TestInterruptAddress = &tTestRing.u32Head;
+
+	TEST_CHECK(RING_bWriteMulti(&tTestRing, au8Data, sizeof(au8Data)) == FALSE);
+	TEST_CHECK(RING_u32GetCount(&tTestRing) == 6U);
+	TEST_CHECK(tTestRing.u32Head == tTestRing.u32Commit);
+	TEST_CHECK(tTestRing.u32Writers == 0U);
+}
+
+int main(void)
+{
+	vTestInit();
+	vTestFullEmpty();
+	vTestWrapAround();
+	vTestSpans();
+	vTestWriteMultiAllOrNothing();
+	vTestWriteMultiInterrupted();
+
+	if (u32TestFailures == 0U)
+	{
+		printf("LSTD_RING: all checks passed\n");
+	}
+	else
+	{
+		printf("LSTD_RING: %u check(s) failed\n", u32TestFailures);
+	}
+
+	return (u32TestFailures == 0U) ? 0 : 1;
+}